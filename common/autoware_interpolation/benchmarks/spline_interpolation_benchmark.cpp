@@ -0,0 +1,94 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/interpolation/spline_interpolation.hpp"
+
+#include <autoware/universe_utils/system/stop_watch.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using autoware::universe_utils::StopWatch;
+
+int main()
+{
+  constexpr auto nb_iterations = 100;
+  std::default_random_engine engine(0);
+  std::uniform_real_distribution<double> interval_dist(0.5, 1.5);
+  std::uniform_real_distribution<double> curvature_dist(-0.05, 0.05);
+  StopWatch<std::chrono::microseconds> stopwatch;
+
+  std::cout << "#Size spline[us] spline_batch[us] akima[us] akima_batch[us]\n";
+  for (const size_t size : {10lu, 100lu, 1000lu, 10000lu}) {
+    // base keys are the arc lengths of a random curve, and x, y and z share them
+    std::vector<double> base_keys{0.0};
+    std::vector<std::vector<double>> base_values(3, std::vector<double>{0.0});
+    double yaw = 0.0;
+    for (size_t i = 1; i < size; ++i) {
+      const double interval = interval_dist(engine);
+      yaw += curvature_dist(engine);
+      base_keys.push_back(base_keys.back() + interval);
+      base_values.at(0).push_back(base_values.at(0).back() + interval * std::cos(yaw));
+      base_values.at(1).push_back(base_values.at(1).back() + interval * std::sin(yaw));
+      base_values.at(2).push_back(0.01 * static_cast<double>(i));
+    }
+
+    // resample with twice the density
+    std::vector<double> query_keys;
+    for (double s = 0.0; s < base_keys.back(); s += 0.5) {
+      query_keys.push_back(s);
+    }
+    query_keys.push_back(base_keys.back());
+
+    double spline_time = 0.0;
+    double spline_batch_time = 0.0;
+    double akima_time = 0.0;
+    double akima_batch_time = 0.0;
+    for (auto i = 0; i < nb_iterations; ++i) {
+      stopwatch.tic("spline");
+      for (const auto & values : base_values) {
+        // cppcheck-suppress unreadVariable
+        const auto result = autoware::interpolation::spline(base_keys, values, query_keys);
+      }
+      spline_time += stopwatch.toc("spline");
+
+      stopwatch.tic("spline_batch");
+      // cppcheck-suppress unreadVariable
+      const auto spline_result =
+        autoware::interpolation::splineBatch(base_keys, base_values, query_keys);
+      spline_batch_time += stopwatch.toc("spline_batch");
+
+      stopwatch.tic("akima");
+      for (const auto & values : base_values) {
+        // cppcheck-suppress unreadVariable
+        const auto result = autoware::interpolation::splineByAkima(base_keys, values, query_keys);
+      }
+      akima_time += stopwatch.toc("akima");
+
+      stopwatch.tic("akima_batch");
+      // cppcheck-suppress unreadVariable
+      const auto akima_result =
+        autoware::interpolation::splineByAkimaBatch(base_keys, base_values, query_keys);
+      akima_batch_time += stopwatch.toc("akima_batch");
+    }
+
+    std::cout << size << " " << spline_time / nb_iterations << " "
+              << spline_batch_time / nb_iterations << " " << akima_time / nb_iterations << " "
+              << akima_batch_time / nb_iterations << "\n";
+  }
+  return 0;
+}
@@ -36,6 +36,27 @@ std::vector<double> splineByAkima(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
   const std::vector<double> & query_keys);
 
+// batched static spline interpolation functions
+// NOTE: The values sharing the same base_keys, e.g. x, y and z of points, are interpolated
+//       together. The query_keys are located only once with a monotone cursor, and each value is
+//       evaluated in a branch-free loop. The results are the same as calling spline() or
+//       splineByAkima() for each of the values.
+std::vector<std::vector<double>> splineBatch(
+  const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values,
+  const std::vector<double> & query_keys);
+std::vector<std::vector<double>> splineByAkimaBatch(
+  const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values,
+  const std::vector<double> & query_keys);
+
+// calculate the coefficients of Akima spline, which is
+// d[i] + (c[i] + (b[i] + a[i] * ds) * ds) * ds with ds = key - base_keys[i] on the i-th segment
+// NOTE: The coefficients are written into the given vectors, which are resized in place so that
+//       their capacity is reused by repeated calls.
+void calcAkimaCoefficients(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values,
+  std::vector<double> & a, std::vector<double> & b, std::vector<double> & c,
+  std::vector<double> & d);
+
 // non-static 1-dimensional spline interpolation
 //
 // Usage:
@@ -58,6 +79,12 @@ public:
     calcSplineCoefficients(base_keys, base_values);
   }
 
+  //!< @brief create the spline interpolations of the values sharing the same base keys at once
+  //!< @details The tridiagonal matrix depends only on the base keys, so that it is solved with
+  //            a single forward sweep for all the values, e.g. x, y and z of points
+  static std::vector<SplineInterpolation> createBatch(
+    const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values);
+
   //!< @brief get values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
@@ -89,8 +116,6 @@ private:
 
   void calcSplineCoefficients(
     const std::vector<double> & base_keys, const std::vector<double> & base_values);
-
-  Eigen::Index get_index(const double & key) const;
 };
 }  // namespace autoware::interpolation
 
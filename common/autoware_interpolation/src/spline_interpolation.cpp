@@ -19,109 +19,194 @@
 
 namespace autoware::interpolation
 {
-Eigen::VectorXd solve_tridiagonal_matrix_algorithm(
+namespace
+{
+// coefficients of the cubic polynomials, whose columns are the values sharing the same base keys
+struct SplineCoefficients
+{
+  Eigen::MatrixXd a;
+  Eigen::MatrixXd b;
+  Eigen::MatrixXd c;
+  Eigen::MatrixXd d;
+};
+
+// NOTE: The query keys are sorted in ascending order, so that the segment is searched forward from
+//       the previous one instead of a binary search per query. The result is the same as the
+//       lower bound of the key minus one, clamped to the valid segments.
+Eigen::Index findSegmentIndex(
+  const std::vector<double> & base_keys, const double key, const Eigen::Index start_idx)
+{
+  const auto last_idx = static_cast<Eigen::Index>(base_keys.size()) - 2;
+  Eigen::Index idx = start_idx;
+  while (idx < last_idx && base_keys[idx + 1] < key) {
+    ++idx;
+  }
+  return idx;
+}
+
+Eigen::MatrixXd solve_tridiagonal_matrix_algorithm(
   const Eigen::Ref<const Eigen::VectorXd> & a, const Eigen::Ref<const Eigen::VectorXd> & b,
-  const Eigen::Ref<const Eigen::VectorXd> & c, const Eigen::Ref<const Eigen::VectorXd> & d)
+  const Eigen::Ref<const Eigen::VectorXd> & c, const Eigen::Ref<const Eigen::MatrixXd> & d)
 {
-  const auto n = d.size();
+  // NOTE: The matrix depends only on a, b and c, so that all the columns of d are solved with the
+  //       same forward sweep.
+  const auto n = d.rows();
 
   if (n == 1) {
-    return d.array() / b.array();
+    return d.array() / b(0);
   }
 
   Eigen::VectorXd c_prime = Eigen::VectorXd::Zero(n);
-  Eigen::VectorXd d_prime = Eigen::VectorXd::Zero(n);
-  Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+  Eigen::MatrixXd d_prime = Eigen::MatrixXd::Zero(n, d.cols());
+  Eigen::MatrixXd x = Eigen::MatrixXd::Zero(n, d.cols());
 
   // Forward sweep
   c_prime(0) = c(0) / b(0);
-  d_prime(0) = d(0) / b(0);
+  d_prime.row(0) = d.row(0) / b(0);
 
   for (auto i = 1; i < n; i++) {
     const double m = 1.0 / (b(i) - a(i - 1) * c_prime(i - 1));
     c_prime(i) = i < n - 1 ? c(i) * m : 0;
-    d_prime(i) = (d(i) - a(i - 1) * d_prime(i - 1)) * m;
+    d_prime.row(i) = (d.row(i) - a(i - 1) * d_prime.row(i - 1)) * m;
   }
 
   // Back substitution
-  x(n - 1) = d_prime(n - 1);
+  x.row(n - 1) = d_prime.row(n - 1);
 
   for (int64_t i = n - 2; i >= 0; i--) {
-    x(i) = d_prime(i) - c_prime(i) * x(i + 1);
+    x.row(i) = d_prime.row(i) - c_prime(i) * x.row(i + 1);
   }
 
   return x;
 }
 
-std::vector<double> spline(
-  const std::vector<double> & base_keys, const std::vector<double> & base_values,
-  const std::vector<double> & query_keys)
+SplineCoefficients calcSplineCoefficientsMatrix(
+  const std::vector<double> & base_keys, const Eigen::Ref<const Eigen::MatrixXd> & y)
 {
-  // calculate spline coefficients
-  SplineInterpolation interpolator(base_keys, base_values);
+  const Eigen::VectorXd x = Eigen::Map<const Eigen::VectorXd>(
+    base_keys.data(), static_cast<Eigen::Index>(base_keys.size()));
 
-  // interpolate base_keys at query_keys
-  return interpolator.getSplineInterpolatedValues(query_keys);
+  const auto n = x.size();
+  const auto m = y.cols();
+
+  SplineCoefficients coefficients;
+  if (n == 2) {
+    coefficients.a = Eigen::MatrixXd::Zero(1, m);
+    coefficients.b = Eigen::MatrixXd::Zero(1, m);
+    coefficients.c = (y.row(1) - y.row(0)) / (x[1] - x[0]);
+    coefficients.d = y.row(0);
+    return coefficients;
+  }
+
+  // Create Tridiagonal matrix
+  Eigen::MatrixXd v(n, m);
+  const Eigen::VectorXd h = x.segment(1, n - 1) - x.segment(0, n - 1);
+  const Eigen::VectorXd a = h.segment(1, n - 3);
+  const Eigen::VectorXd b = 2 * (h.segment(0, n - 2) + h.segment(1, n - 2));
+  const Eigen::VectorXd c = h.segment(1, n - 3);
+  const Eigen::MatrixXd y_diff = y.middleRows(1, n - 1) - y.middleRows(0, n - 1);
+  const Eigen::MatrixXd d =
+    6 * (y_diff.middleRows(1, n - 2).array().colwise() / h.tail(n - 2).array() -
+         y_diff.middleRows(0, n - 2).array().colwise() / h.head(n - 2).array());
+
+  // Solve tridiagonal matrix
+  v.middleRows(1, n - 2) = solve_tridiagonal_matrix_algorithm(a, b, c, d);
+  v.row(0).setZero();
+  v.row(n - 1).setZero();
+
+  // Calculate spline coefficients
+  const Eigen::ArrayXd dx = (x.tail(n - 1) - x.head(n - 1)).array();
+  coefficients.a = ((v.bottomRows(n - 1) - v.topRows(n - 1)).array() / 6.0).colwise() / dx;
+  coefficients.b = v.topRows(n - 1) / 2.0;
+  coefficients.c =
+    y_diff.array().colwise() / dx -
+    (2 * v.topRows(n - 1).array() + v.bottomRows(n - 1).array()).colwise() * dx / 6.0;
+  coefficients.d = y.topRows(n - 1);
+  return coefficients;
 }
+}  // namespace
 
-std::vector<double> splineByAkima(
+void calcAkimaCoefficients(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
-  const std::vector<double> & query_keys)
+  std::vector<double> & a, std::vector<double> & b, std::vector<double> & c,
+  std::vector<double> & d)
 {
+  // throw exception for invalid arguments
+  autoware::interpolation::validateKeysAndValues(base_keys, base_values);
+
   constexpr double epsilon = 1e-5;
+  const size_t n = base_keys.size();
 
+  // NOTE: m is kept in b and s in c until the cubic coefficients are calculated, so that no
+  //       buffer other than the outputs is needed.
   // calculate m
-  std::vector<double> m_values;
-  for (size_t i = 0; i < base_keys.size() - 1; ++i) {
-    const double m_val =
-      (base_values.at(i + 1) - base_values.at(i)) / (base_keys.at(i + 1) - base_keys.at(i));
-    m_values.push_back(m_val);
+  std::vector<double> & m_values = b;
+  m_values.resize(n - 1);
+  for (size_t i = 0; i < n - 1; ++i) {
+    m_values[i] = (base_values[i + 1] - base_values[i]) / (base_keys[i + 1] - base_keys[i]);
   }
 
   // calculate s
-  std::vector<double> s_values;
-  for (size_t i = 0; i < base_keys.size(); ++i) {
+  std::vector<double> & s_values = c;
+  s_values.resize(n);
+  for (size_t i = 0; i < n; ++i) {
     if (i == 0) {
-      s_values.push_back(m_values.front());
+      s_values[i] = m_values.front();
       continue;
-    } else if (i == base_keys.size() - 1) {
-      s_values.push_back(m_values.back());
+    } else if (i == n - 1) {
+      s_values[i] = m_values.back();
       continue;
-    } else if (i == 1 || i == base_keys.size() - 2) {
-      const double s_val = (m_values.at(i - 1) + m_values.at(i)) / 2.0;
-      s_values.push_back(s_val);
+    } else if (i == 1 || i == n - 2) {
+      s_values[i] = (m_values[i - 1] + m_values[i]) / 2.0;
       continue;
     }
 
-    const double denom = std::abs(m_values.at(i + 1) - m_values.at(i)) +
-                         std::abs(m_values.at(i - 1) - m_values.at(i - 2));
+    const double denom =
+      std::abs(m_values[i + 1] - m_values[i]) + std::abs(m_values[i - 1] - m_values[i - 2]);
     if (std::abs(denom) < epsilon) {
-      const double s_val = (m_values.at(i - 1) + m_values.at(i)) / 2.0;
-      s_values.push_back(s_val);
+      s_values[i] = (m_values[i - 1] + m_values[i]) / 2.0;
       continue;
     }
 
-    const double s_val = (std::abs(m_values.at(i + 1) - m_values.at(i)) * m_values.at(i - 1) +
-                          std::abs(m_values.at(i - 1) - m_values.at(i - 2)) * m_values.at(i)) /
-                         denom;
-    s_values.push_back(s_val);
+    s_values[i] = (std::abs(m_values[i + 1] - m_values[i]) * m_values[i - 1] +
+                   std::abs(m_values[i - 1] - m_values[i - 2]) * m_values[i]) /
+                  denom;
   }
 
+  // calculate cubic coefficients
+  a.resize(n - 1);
+  d.resize(n - 1);
+  for (size_t i = 0; i < n - 1; ++i) {
+    const double m_val = m_values[i];
+    a[i] = (s_values[i] + s_values[i + 1] - 2.0 * m_val) /
+           std::pow(base_keys[i + 1] - base_keys[i], 2);
+    b[i] = (3.0 * m_val - 2.0 * s_values[i] - s_values[i + 1]) / (base_keys[i + 1] - base_keys[i]);
+    d[i] = base_values[i];
+  }
+  c.resize(n - 1);
+}
+
+std::vector<double> spline(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values,
+  const std::vector<double> & query_keys)
+{
+  // calculate spline coefficients
+  SplineInterpolation interpolator(base_keys, base_values);
+
+  // interpolate base_keys at query_keys
+  return interpolator.getSplineInterpolatedValues(query_keys);
+}
+
+std::vector<double> splineByAkima(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values,
+  const std::vector<double> & query_keys)
+{
   // calculate cubic coefficients
   std::vector<double> a;
   std::vector<double> b;
   std::vector<double> c;
   std::vector<double> d;
-  for (size_t i = 0; i < base_keys.size() - 1; ++i) {
-    a.push_back(
-      (s_values.at(i) + s_values.at(i + 1) - 2.0 * m_values.at(i)) /
-      std::pow(base_keys.at(i + 1) - base_keys.at(i), 2));
-    b.push_back(
-      (3.0 * m_values.at(i) - 2.0 * s_values.at(i) - s_values.at(i + 1)) /
-      (base_keys.at(i + 1) - base_keys.at(i)));
-    c.push_back(s_values.at(i));
-    d.push_back(base_values.at(i));
-  }
+  calcAkimaCoefficients(base_keys, base_values, a, b, c, d);
 
   // interpolate
   std::vector<double> res;
@@ -137,59 +222,134 @@ std::vector<double> splineByAkima(
   return res;
 }
 
-Eigen::Index SplineInterpolation::get_index(const double & key) const
+std::vector<std::vector<double>> splineBatch(
+  const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values,
+  const std::vector<double> & query_keys)
 {
-  const auto it = std::lower_bound(base_keys_.begin(), base_keys_.end(), key);
-  return std::clamp(
-    static_cast<int>(std::distance(base_keys_.begin(), it)) - 1, 0,
-    static_cast<int>(base_keys_.size()) - 2);
+  // throw exceptions for invalid arguments
+  autoware::interpolation::validateKeys(base_keys, query_keys);
+  for (const auto & values : base_values) {
+    autoware::interpolation::validateKeysAndValues(base_keys, values);
+  }
+
+  // calculate spline coefficients of all the values at once
+  Eigen::MatrixXd y(static_cast<Eigen::Index>(base_keys.size()), base_values.size());
+  for (size_t i = 0; i < base_values.size(); ++i) {
+    y.col(i) = Eigen::Map<const Eigen::VectorXd>(
+      base_values.at(i).data(), static_cast<Eigen::Index>(base_values.at(i).size()));
+  }
+  const auto coefficients = calcSplineCoefficientsMatrix(base_keys, y);
+
+  // locate the segments of the query keys once for all the values
+  std::vector<Eigen::Index> indices(query_keys.size());
+  std::vector<double> dxs(query_keys.size());
+  Eigen::Index idx = 0;
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    idx = findSegmentIndex(base_keys, query_keys[i], idx);
+    indices[i] = idx;
+    dxs[i] = query_keys[i] - base_keys[idx];
+  }
+
+  // interpolate without branches so that the loop can be vectorized
+  std::vector<std::vector<double>> interpolated_values(
+    base_values.size(), std::vector<double>(query_keys.size()));
+  for (size_t i = 0; i < base_values.size(); ++i) {
+    const double * a = coefficients.a.col(i).data();
+    const double * b = coefficients.b.col(i).data();
+    const double * c = coefficients.c.col(i).data();
+    const double * d = coefficients.d.col(i).data();
+    double * values = interpolated_values[i].data();
+    for (size_t j = 0; j < query_keys.size(); ++j) {
+      const auto k = indices[j];
+      const double dx = dxs[j];
+      values[j] = a[k] * dx * dx * dx + b[k] * dx * dx + c[k] * dx + d[k];
+    }
+  }
+  return interpolated_values;
 }
 
-void SplineInterpolation::calcSplineCoefficients(
-  const std::vector<double> & base_keys, const std::vector<double> & base_values)
+std::vector<std::vector<double>> splineByAkimaBatch(
+  const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values,
+  const std::vector<double> & query_keys)
 {
   // throw exceptions for invalid arguments
-  autoware::interpolation::validateKeysAndValues(base_keys, base_values);
-  const Eigen::VectorXd x = Eigen::Map<const Eigen::VectorXd>(
-    base_keys.data(), static_cast<Eigen::Index>(base_keys.size()));
-  const Eigen::VectorXd y = Eigen::Map<const Eigen::VectorXd>(
-    base_values.data(), static_cast<Eigen::Index>(base_values.size()));
+  for (const auto & values : base_values) {
+    autoware::interpolation::validateKeysAndValues(base_keys, values);
+  }
 
-  const auto n = x.size();
+  // locate the segments of the query keys once for all the values
+  std::vector<size_t> indices(query_keys.size());
+  std::vector<double> dss(query_keys.size());
+  size_t idx = 0;
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    while (base_keys.at(idx + 1) < query_keys[i]) {
+      ++idx;
+    }
+    indices[i] = idx;
+    dss[i] = query_keys[i] - base_keys[idx];
+  }
 
-  if (n == 2) {
-    a_ = Eigen::VectorXd::Zero(1);
-    b_ = Eigen::VectorXd::Zero(1);
-    c_ = Eigen::VectorXd::Zero(1);
-    d_ = Eigen::VectorXd::Zero(1);
-    c_[0] = (y[1] - y[0]) / (x[1] - x[0]);
-    d_[0] = y[0];
-    base_keys_ = base_keys;
-    return;
+  std::vector<std::vector<double>> interpolated_values(
+    base_values.size(), std::vector<double>(query_keys.size()));
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> c;
+  std::vector<double> d;
+  for (size_t i = 0; i < base_values.size(); ++i) {
+    calcAkimaCoefficients(base_keys, base_values.at(i), a, b, c, d);
+
+    // interpolate without branches so that the loop can be vectorized
+    double * values = interpolated_values[i].data();
+    for (size_t j = 0; j < query_keys.size(); ++j) {
+      const auto k = indices[j];
+      const double ds = dss[j];
+      values[j] = d[k] + (c[k] + (b[k] + a[k] * ds) * ds) * ds;
+    }
   }
+  return interpolated_values;
+}
 
-  // Create Tridiagonal matrix
-  Eigen::VectorXd v(n);
-  const Eigen::VectorXd h = x.segment(1, n - 1) - x.segment(0, n - 1);
-  const Eigen::VectorXd a = h.segment(1, n - 3);
-  const Eigen::VectorXd b = 2 * (h.segment(0, n - 2) + h.segment(1, n - 2));
-  const Eigen::VectorXd c = h.segment(1, n - 3);
-  const Eigen::VectorXd y_diff = y.segment(1, n - 1) - y.segment(0, n - 1);
-  const Eigen::VectorXd d = 6 * (y_diff.segment(1, n - 2).array() / h.tail(n - 2).array() -
-                                 y_diff.segment(0, n - 2).array() / h.head(n - 2).array());
+std::vector<SplineInterpolation> SplineInterpolation::createBatch(
+  const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values)
+{
+  // throw exceptions for invalid arguments
+  Eigen::MatrixXd y(static_cast<Eigen::Index>(base_keys.size()), base_values.size());
+  for (size_t i = 0; i < base_values.size(); ++i) {
+    autoware::interpolation::validateKeysAndValues(base_keys, base_values.at(i));
+    y.col(i) = Eigen::Map<const Eigen::VectorXd>(
+      base_values.at(i).data(), static_cast<Eigen::Index>(base_values.at(i).size()));
+  }
+  if (base_values.empty()) {
+    return {};
+  }
 
-  // Solve tridiagonal matrix
-  v.segment(1, n - 2) = solve_tridiagonal_matrix_algorithm(a, b, c, d);
-  v[0] = 0;
-  v[n - 1] = 0;
+  const auto coefficients = calcSplineCoefficientsMatrix(base_keys, y);
 
-  // Calculate spline coefficients
-  a_ = (v.tail(n - 1) - v.head(n - 1)).array() / 6.0 / (x.tail(n - 1) - x.head(n - 1)).array();
-  b_ = v.segment(0, n - 1) / 2.0;
-  c_ = (y.tail(n - 1) - y.head(n - 1)).array() / (x.tail(n - 1) - x.head(n - 1)).array() -
-       (x.tail(n - 1) - x.head(n - 1)).array() *
-         (2 * v.segment(0, n - 1).array() + v.segment(1, n - 1).array()) / 6.0;
-  d_ = y.head(n - 1);
+  std::vector<SplineInterpolation> splines(base_values.size());
+  for (size_t i = 0; i < base_values.size(); ++i) {
+    auto & spline = splines.at(i);
+    spline.a_ = coefficients.a.col(i);
+    spline.b_ = coefficients.b.col(i);
+    spline.c_ = coefficients.c.col(i);
+    spline.d_ = coefficients.d.col(i);
+    spline.base_keys_ = base_keys;
+  }
+  return splines;
+}
+
+void SplineInterpolation::calcSplineCoefficients(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values)
+{
+  // throw exceptions for invalid arguments
+  autoware::interpolation::validateKeysAndValues(base_keys, base_values);
+  const Eigen::Map<const Eigen::VectorXd> y(
+    base_values.data(), static_cast<Eigen::Index>(base_values.size()));
+
+  const auto coefficients = calcSplineCoefficientsMatrix(base_keys, y);
+  a_ = coefficients.a.col(0);
+  b_ = coefficients.b.col(0);
+  c_ = coefficients.c.col(0);
+  d_ = coefficients.d.col(0);
   base_keys_ = base_keys;
 }
 
@@ -201,8 +361,9 @@ std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
   std::vector<double> interpolated_values;
   interpolated_values.reserve(query_keys.size());
 
+  Eigen::Index idx = 0;
   for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
+    idx = findSegmentIndex(base_keys_, key, idx);
     const auto dx = key - base_keys_[idx];
     interpolated_values.emplace_back(
       a_[idx] * dx * dx * dx + b_[idx] * dx * dx + c_[idx] * dx + d_[idx]);
@@ -219,8 +380,9 @@ std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
   std::vector<double> interpolated_diff_values;
   interpolated_diff_values.reserve(query_keys.size());
 
+  Eigen::Index idx = 0;
   for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
+    idx = findSegmentIndex(base_keys_, key, idx);
     const auto dx = key - base_keys_[idx];
     interpolated_diff_values.emplace_back(3 * a_[idx] * dx * dx + 2 * b_[idx] * dx + c_[idx]);
   }
@@ -236,8 +398,9 @@ std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
   std::vector<double> interpolated_quad_diff_values;
   interpolated_quad_diff_values.reserve(query_keys.size());
 
+  Eigen::Index idx = 0;
   for (const auto & key : query_keys) {
-    const auto idx = get_index(key);
+    idx = findSegmentIndex(base_keys_, key, idx);
     const auto dx = key - base_keys_[idx];
     interpolated_quad_diff_values.emplace_back(6 * a_[idx] * dx + 2 * b_[idx]);
   }
@@ -14,6 +14,8 @@
 
 #include "autoware/interpolation/spline_interpolation_points_2d.hpp"
 
+#include <iterator>
+#include <utility>
 #include <vector>
 
 namespace autoware::interpolation
@@ -137,10 +139,14 @@ double SplineInterpolationPoints2d::getSplineInterpolatedYaw(const size_t idx, c
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedYaws() const
 {
+  // NOTE: The base keys are sorted, so that they are interpolated in a single pass.
+  const auto diff_x = spline_x_.getSplineInterpolatedDiffValues(base_s_vec_);
+  const auto diff_y = spline_y_.getSplineInterpolatedDiffValues(base_s_vec_);
+
   std::vector<double> yaw_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double yaw = getSplineInterpolatedYaw(i, 0.0);
-    yaw_vec.push_back(yaw);
+  yaw_vec.reserve(base_s_vec_.size());
+  for (size_t i = 0; i < base_s_vec_.size(); ++i) {
+    yaw_vec.push_back(std::atan2(diff_y.at(i), diff_x.at(i)));
   }
   return yaw_vec;
 }
@@ -167,10 +173,18 @@ double SplineInterpolationPoints2d::getSplineInterpolatedCurvature(
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedCurvatures() const
 {
+  // NOTE: The base keys are sorted, so that they are interpolated in a single pass.
+  const auto diff_x = spline_x_.getSplineInterpolatedDiffValues(base_s_vec_);
+  const auto diff_y = spline_y_.getSplineInterpolatedDiffValues(base_s_vec_);
+  const auto quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues(base_s_vec_);
+  const auto quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues(base_s_vec_);
+
   std::vector<double> curvature_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double curvature = getSplineInterpolatedCurvature(i, 0.0);
-    curvature_vec.push_back(curvature);
+  curvature_vec.reserve(base_s_vec_.size());
+  for (size_t i = 0; i < base_s_vec_.size(); ++i) {
+    curvature_vec.push_back(
+      (diff_x.at(i) * quad_diff_y.at(i) - quad_diff_x.at(i) * diff_y.at(i)) /
+      std::pow(std::pow(diff_x.at(i), 2) + std::pow(diff_y.at(i), 2), 1.5));
   }
   return curvature_vec;
 }
@@ -197,16 +211,16 @@ double SplineInterpolationPoints2d::getAccumulatedLength(const size_t idx) const
 void SplineInterpolationPoints2d::calcSplineCoefficientsInner(
   const std::vector<geometry_msgs::msg::Point> & points)
 {
-  const auto base = getBaseValues(points);
+  auto base = getBaseValues(points);
 
-  base_s_vec_ = base.at(0);
-  const auto & base_x_vec = base.at(1);
-  const auto & base_y_vec = base.at(2);
-  const auto & base_z_vec = base.at(3);
+  base_s_vec_ = std::move(base.at(0));
+  const std::vector<std::vector<double>> base_xyz_vec(
+    std::make_move_iterator(base.begin() + 1), std::make_move_iterator(base.end()));
 
-  // calculate spline coefficients
-  spline_x_ = SplineInterpolation(base_s_vec_, base_x_vec);
-  spline_y_ = SplineInterpolation(base_s_vec_, base_y_vec);
-  spline_z_ = SplineInterpolation(base_s_vec_, base_z_vec);
+  // calculate spline coefficients of x, y and z at once
+  auto splines = SplineInterpolation::createBatch(base_s_vec_, base_xyz_vec);
+  spline_x_ = std::move(splines.at(0));
+  spline_y_ = std::move(splines.at(1));
+  spline_z_ = std::move(splines.at(2));
 }
 }  // namespace autoware::interpolation
@@ -230,6 +230,60 @@ TEST(spline_interpolation, splineByAkima)
   }
 }
 
+TEST(spline_interpolation, splineBatch)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<std::vector<double>> base_values{
+    {-1.2, 0.5, 1.0, 1.2, 2.0, 1.0},
+    {0.0, 1.5, 3.0, 4.5, 6.0, 7.5},
+    {3.0, -2.0, 4.0, 0.0, 1.0, 2.0}};
+  const std::vector<double> query_keys{-1.5, 0.0, 1.0, 1.0, 8.0, 12.0, 18.0, 20.0};
+
+  {  // same as spline of each value
+    const auto query_values =
+      autoware::interpolation::splineBatch(base_keys, base_values, query_keys);
+    ASSERT_EQ(query_values.size(), base_values.size());
+    for (size_t i = 0; i < base_values.size(); ++i) {
+      EXPECT_EQ(
+        query_values.at(i),
+        autoware::interpolation::spline(base_keys, base_values.at(i), query_keys));
+    }
+  }
+
+  {  // same as splineByAkima of each value
+    const auto query_values =
+      autoware::interpolation::splineByAkimaBatch(base_keys, base_values, query_keys);
+    ASSERT_EQ(query_values.size(), base_values.size());
+    for (size_t i = 0; i < base_values.size(); ++i) {
+      EXPECT_EQ(
+        query_values.at(i),
+        autoware::interpolation::splineByAkima(base_keys, base_values.at(i), query_keys));
+    }
+  }
+
+  {  // same as SplineInterpolation of each value
+    const auto splines = SplineInterpolation::createBatch(base_keys, base_values);
+    ASSERT_EQ(splines.size(), base_values.size());
+    for (size_t i = 0; i < base_values.size(); ++i) {
+      const SplineInterpolation s(base_keys, base_values.at(i));
+      EXPECT_EQ(
+        splines.at(i).getSplineInterpolatedValues(query_keys),
+        s.getSplineInterpolatedValues(query_keys));
+      EXPECT_EQ(
+        splines.at(i).getSplineInterpolatedDiffValues(query_keys),
+        s.getSplineInterpolatedDiffValues(query_keys));
+    }
+  }
+
+  // size of base_keys and base_values are not the same
+  EXPECT_THROW(
+    autoware::interpolation::splineBatch(base_keys, {{0.0, 1.0}}, query_keys),
+    std::invalid_argument);
+  EXPECT_THROW(
+    autoware::interpolation::splineByAkimaBatch(base_keys, {{0.0, 1.0}}, query_keys),
+    std::invalid_argument);
+}
+
 TEST(spline_interpolation, SplineInterpolation)
 {
   {
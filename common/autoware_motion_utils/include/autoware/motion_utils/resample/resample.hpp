@@ -23,6 +23,38 @@
 
 namespace autoware::motion_utils
 {
+/**
+ * @brief Scratch buffers of the resampling functions taking a workspace. A caller keeps one,
+ *        e.g. as a member of its node, and passes it to every call, so that the buffers grown in
+ *        the previous calls are reused and the resampling does not allocate once the sizes of the
+ *        inputs settle. The members are internal to the resampling and hold no meaningful value
+ *        between the calls.
+ * NOTE: Only the interpolation buffers are kept. The output and any conversion of the input made
+ *       by the caller are still allocated by the caller. A workspace must not be used by two
+ *       threads at the same time.
+ */
+struct ResampleWorkspace
+{
+  // arc length of the resampled points, computed by the overloads taking an interval
+  std::vector<double> resampling_arclength;
+
+  // arc length of the input points
+  std::vector<double> input_arclength;
+
+  // position of the input points and the coefficients of the Akima splines of x and y
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+  std::vector<double> x_a;
+  std::vector<double> x_b;
+  std::vector<double> x_c;
+  std::vector<double> x_d;
+  std::vector<double> y_a;
+  std::vector<double> y_b;
+  std::vector<double> y_c;
+  std::vector<double> y_d;
+};
+
 /**
  * @brief A resampling function for a path(points). Note that in a default setting, position xy are
  *        resampled by spline interpolation, position z are resampled by linear interpolation, and
@@ -163,6 +195,28 @@ autoware_planning_msgs::msg::Path resamplePath(
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy = false,
   const bool use_lerp_for_z = true, const bool use_zero_order_hold_for_v = true);
 
+/**
+ * @brief Same as resamplePath() above, but the buffers of the workspace and the output path are
+ *        reused, and all the fields of a resampled point are interpolated in a single pass. Once
+ *        their capacity is enough, it does not allocate unless use_lerp_for_z is false.
+ * @param input_path input path to resample
+ * @param resampled_arclength arclength that contains length of each resampling points from initial
+ *        point
+ * @param workspace scratch buffers reused across the calls
+ * @param output_path resampled path, which must not be input_path
+ * @param use_akima_spline_for_xy If true, it uses linear interpolation to resample position x and
+ *        y. Otherwise, it uses spline interpolation
+ * @param use_lerp_for_z If true, it uses linear interpolation to resample position z.
+ *        Otherwise, it uses spline interpolation
+ * @param use_zero_order_hold_for_v If true, it uses zero_order_hold to resample
+ *        longitudinal and lateral velocity. Otherwise, it uses linear interpolation
+ */
+void resamplePath(
+  const autoware_planning_msgs::msg::Path & input_path,
+  const std::vector<double> & resampled_arclength, ResampleWorkspace & workspace,
+  autoware_planning_msgs::msg::Path & output_path, const bool use_akima_spline_for_xy = false,
+  const bool use_lerp_for_z = true, const bool use_zero_order_hold_for_v = true);
+
 /**
  * @brief A resampling function for a path. Note that in a default setting, position xy
  *        are resampled by spline interpolation, position z are resampled by linear interpolation,
@@ -209,6 +263,30 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy = false,
   const bool use_lerp_for_z = true, const bool use_zero_order_hold_for_twist = true);
 
+/**
+ * @brief Same as resampleTrajectory() above, but the buffers of the workspace and the output
+ *        trajectory are reused, and all the fields of a resampled point are interpolated in a
+ *        single pass. Once their capacity is enough, it does not allocate unless use_lerp_for_z is
+ *        false.
+ * @param input_trajectory input trajectory to resample
+ * @param resampled_arclength arclength that contains length of each resampling points from initial
+ *        point
+ * @param workspace scratch buffers reused across the calls
+ * @param output_trajectory resampled trajectory, which must not be input_trajectory
+ * @param use_akima_spline_for_xy If true, it uses linear interpolation to resample position x and
+ *        y. Otherwise, it uses spline interpolation
+ * @param use_lerp_for_z If true, it uses linear interpolation to resample position z.
+ *        Otherwise, it uses spline interpolation
+ * @param use_zero_order_hold_for_twist If true, it uses zero_order_hold to resample
+ *        longitudinal, lateral velocity and acceleration. Otherwise, it uses linear interpolation
+ */
+void resampleTrajectory(
+  const autoware_planning_msgs::msg::Trajectory & input_trajectory,
+  const std::vector<double> & resampled_arclength, ResampleWorkspace & workspace,
+  autoware_planning_msgs::msg::Trajectory & output_trajectory,
+  const bool use_akima_spline_for_xy = false, const bool use_lerp_for_z = true,
+  const bool use_zero_order_hold_for_twist = true);
+
 /**
  * @brief A resampling function for a trajectory. This function resamples closest stop point,
  *        terminal point and points by resample interval. Note that in a default setting, position
@@ -234,6 +312,30 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
   const bool use_akima_spline_for_xy = false, const bool use_lerp_for_z = true,
   const bool use_zero_order_hold_for_twist = true,
   const bool resample_input_trajectory_stop_point = true);
+
+/**
+ * @brief Same as resampleTrajectory() above, but the buffers of the workspace and the output
+ *        trajectory are reused. Once their capacity is enough, it does not allocate unless
+ *        use_lerp_for_z is false.
+ * @param input_trajectory input trajectory to resample
+ * @param resampled_interval resampling interval
+ * @param workspace scratch buffers reused across the calls
+ * @param output_trajectory resampled trajectory, which must not be input_trajectory
+ * @param use_akima_spline_for_xy If true, it uses linear interpolation to resample position x and
+ *        y. Otherwise, it uses spline interpolation
+ * @param use_lerp_for_z If true, it uses linear interpolation to resample position z.
+ *        Otherwise, it uses spline interpolation
+ * @param use_zero_order_hold_for_twist If true, it uses zero_order_hold to resample
+ *        longitudinal, lateral velocity and acceleration. Otherwise, it uses linear interpolation
+ * @param resample_input_trajectory_stop_point If true, resample closest stop point in input
+ *        trajectory
+ */
+void resampleTrajectory(
+  const autoware_planning_msgs::msg::Trajectory & input_trajectory, const double resample_interval,
+  ResampleWorkspace & workspace, autoware_planning_msgs::msg::Trajectory & output_trajectory,
+  const bool use_akima_spline_for_xy = false, const bool use_lerp_for_z = true,
+  const bool use_zero_order_hold_for_twist = true,
+  const bool resample_input_trajectory_stop_point = true);
 }  // namespace autoware::motion_utils
 
 #endif  // AUTOWARE__MOTION_UTILS__RESAMPLE__RESAMPLE_HPP_
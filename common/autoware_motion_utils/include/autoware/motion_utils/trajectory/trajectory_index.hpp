@@ -0,0 +1,261 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__MOTION_UTILS__TRAJECTORY__TRAJECTORY_INDEX_HPP_
+#define AUTOWARE__MOTION_UTILS__TRAJECTORY__TRAJECTORY_INDEX_HPP_
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace autoware::motion_utils
+{
+/**
+ * @brief Precomputed index of points container for repeated queries on the same trajectory, path,
+ * ...
+ * The cumulative arc lengths and a uniform grid of the points are built once, so that the nearest
+ * index search takes only the points around the query and the arc length between two indices is
+ * obtained in constant time. The results are the same as the corresponding free functions in
+ * trajectory.hpp.
+ * NOTE: The index holds a copy of the point positions, and has to be rebuilt when the points are
+ * modified.
+ */
+class TrajectoryIndex
+{
+public:
+  /**
+   * @brief build the index of points container
+   * @param points points of trajectory, path, ...
+   */
+  template <class T>
+  explicit TrajectoryIndex(const T & points)
+  {
+    std::vector<geometry_msgs::msg::Pose> poses;
+    poses.reserve(points.size());
+    for (const auto & point : points) {
+      poses.push_back(autoware::universe_utils::getPose(point));
+    }
+    build(poses);
+  }
+
+  size_t size() const { return xs_.size(); }
+  bool empty() const { return xs_.empty(); }
+
+  /**
+   * @brief find nearest point index for a given point. Same as findNearestIndex(points, point).
+   * @param point given point
+   * @return index of nearest point
+   */
+  size_t findNearestIndex(const geometry_msgs::msg::Point & point) const;
+
+  /**
+   * @brief find nearest point index for a given pose with distance and yaw thresholds. Same as
+   * findNearestIndex(points, pose, max_dist, max_yaw).
+   * @param pose given pose
+   * @param max_dist max distance used to get squared distance for finding the nearest point
+   * @param max_yaw max yaw used for finding nearest point
+   * @return index of nearest point (index or none if not found)
+   */
+  std::optional<size_t> findNearestIndex(
+    const geometry_msgs::msg::Pose & pose,
+    const double max_dist = std::numeric_limits<double>::max(),
+    const double max_yaw = std::numeric_limits<double>::max()) const;
+
+  /**
+   * @brief calculate longitudinal offset from seg_idx point to the nearest point to p_target on the
+   * segment. Same as calcLongitudinalOffsetToSegment(points, seg_idx, p_target, throw_exception).
+   * @param seg_idx segment index of point at beginning of length
+   * @param p_target target point at end of length
+   * @param throw_exception flag to enable/disable exception throwing
+   * @return signed length
+   */
+  double calcLongitudinalOffsetToSegment(
+    const size_t seg_idx, const geometry_msgs::msg::Point & p_target,
+    const bool throw_exception = false) const;
+
+  /**
+   * @brief find nearest segment index to point. Same as findNearestSegmentIndex(points, point).
+   * @param point point to which to find nearest segment index
+   * @return nearest index
+   */
+  size_t findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const;
+
+  /**
+   * @brief find nearest segment index to pose. Same as findNearestSegmentIndex(points, pose,
+   * max_dist, max_yaw).
+   * @param pose pose to which to find nearest segment index
+   * @param max_dist max distance used for finding the nearest index to given pose
+   * @param max_yaw max yaw used for finding nearest index to given pose
+   * @return nearest index
+   */
+  std::optional<size_t> findNearestSegmentIndex(
+    const geometry_msgs::msg::Pose & pose,
+    const double max_dist = std::numeric_limits<double>::max(),
+    const double max_yaw = std::numeric_limits<double>::max()) const;
+
+  /**
+   * @brief calculate signed arc length between two indices in constant time
+   * @param src_idx index of start point
+   * @param dst_idx index of end point
+   * @return signed arc length, which is positive if dst_idx is greater than src_idx
+   */
+  double calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const;
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const;
+  double calcSignedArcLength(
+    const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const;
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point,
+    const geometry_msgs::msg::Point & dst_point) const;
+
+private:
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  std::vector<double> yaws_;
+  std::vector<double> arc_lengths_;  // arc length from the first point
+  // index of the first point after each point which does not overlap with it, or size() if none
+  std::vector<size_t> next_distinct_indices_;
+
+  // uniform grid of the point indices
+  double cell_size_{1.0};
+  int64_t min_cell_x_{0};
+  int64_t min_cell_y_{0};
+  int64_t max_cell_x_{0};
+  int64_t max_cell_y_{0};
+  std::unordered_map<uint64_t, std::vector<uint32_t>> cells_;
+
+  void build(const std::vector<geometry_msgs::msg::Pose> & poses);
+  int64_t toCellIndex(const double v) const;
+  static uint64_t toCellKey(const int64_t ix, const int64_t iy);
+
+  template <class Predicate>
+  std::optional<size_t> findNearestIndexIf(
+    const double x, const double y, const double max_squared_dist,
+    const Predicate & is_valid) const;
+};
+
+/**
+ * @brief overloads of the free functions in trajectory.hpp using the precomputed index.
+ * The index is used only when it was built from the same number of points, otherwise they fall back
+ * to the linear search.
+ */
+template <class T>
+size_t findNearestIndex(
+  const T & points, const geometry_msgs::msg::Point & point, const TrajectoryIndex & index)
+{
+  if (index.size() != points.size()) {
+    return findNearestIndex(points, point);
+  }
+  validateNonEmpty(points);
+  return index.findNearestIndex(point);
+}
+
+template <class T>
+std::optional<size_t> findNearestIndex(
+  const T & points, const geometry_msgs::msg::Pose & pose, const TrajectoryIndex & index,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max())
+{
+  if (index.size() != points.size()) {
+    return findNearestIndex(points, pose, max_dist, max_yaw);
+  }
+  return index.findNearestIndex(pose, max_dist, max_yaw);
+}
+
+template <class T>
+double calcLongitudinalOffsetToSegment(
+  const T & points, const size_t seg_idx, const geometry_msgs::msg::Point & p_target,
+  const TrajectoryIndex & index, const bool throw_exception = false)
+{
+  if (index.size() != points.size()) {
+    return calcLongitudinalOffsetToSegment(points, seg_idx, p_target, throw_exception);
+  }
+  return index.calcLongitudinalOffsetToSegment(seg_idx, p_target, throw_exception);
+}
+
+template <class T>
+size_t findNearestSegmentIndex(
+  const T & points, const geometry_msgs::msg::Point & point, const TrajectoryIndex & index)
+{
+  if (index.size() != points.size()) {
+    return findNearestSegmentIndex(points, point);
+  }
+  validateNonEmpty(points);
+  return index.findNearestSegmentIndex(point);
+}
+
+template <class T>
+std::optional<size_t> findNearestSegmentIndex(
+  const T & points, const geometry_msgs::msg::Pose & pose, const TrajectoryIndex & index,
+  const double max_dist = std::numeric_limits<double>::max(),
+  const double max_yaw = std::numeric_limits<double>::max())
+{
+  if (index.size() != points.size()) {
+    return findNearestSegmentIndex(points, pose, max_dist, max_yaw);
+  }
+  return index.findNearestSegmentIndex(pose, max_dist, max_yaw);
+}
+
+template <class T>
+double calcSignedArcLength(
+  const T & points, const size_t src_idx, const size_t dst_idx, const TrajectoryIndex & index)
+{
+  if (index.size() != points.size()) {
+    return calcSignedArcLength(points, src_idx, dst_idx);
+  }
+  return index.calcSignedArcLength(src_idx, dst_idx);
+}
+
+template <class T>
+double calcSignedArcLength(
+  const T & points, const geometry_msgs::msg::Point & src_point, const size_t dst_idx,
+  const TrajectoryIndex & index)
+{
+  if (index.size() != points.size()) {
+    return calcSignedArcLength(points, src_point, dst_idx);
+  }
+  return index.calcSignedArcLength(src_point, dst_idx);
+}
+
+template <class T>
+double calcSignedArcLength(
+  const T & points, const size_t src_idx, const geometry_msgs::msg::Point & dst_point,
+  const TrajectoryIndex & index)
+{
+  if (index.size() != points.size()) {
+    return calcSignedArcLength(points, src_idx, dst_point);
+  }
+  return index.calcSignedArcLength(src_idx, dst_point);
+}
+
+template <class T>
+double calcSignedArcLength(
+  const T & points, const geometry_msgs::msg::Point & src_point,
+  const geometry_msgs::msg::Point & dst_point, const TrajectoryIndex & index)
+{
+  if (index.size() != points.size()) {
+    return calcSignedArcLength(points, src_point, dst_point);
+  }
+  return index.calcSignedArcLength(src_point, dst_point);
+}
+}  // namespace autoware::motion_utils
+
+#endif  // AUTOWARE__MOTION_UTILS__TRAJECTORY__TRAJECTORY_INDEX_HPP_
@@ -22,12 +22,192 @@
 #include "autoware/universe_utils/geometry/geometry.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 
 namespace autoware::motion_utils
 {
+namespace
+{
+// Interpolation of the input points at the resampled arc lengths. The resampled arc lengths are
+// located one by one in ascending order with monotone cursors, so that all the fields of a
+// resampled point are interpolated at once. The results are the same as lerp(),
+// zero_order_hold() and splineByAkima() of autoware_interpolation.
+template <class T>
+class PointResampler
+{
+public:
+  PointResampler(
+    const std::vector<T> & input_points, const std::vector<double> & resampled_arclength,
+    const bool use_akima_spline_for_xy, const bool use_lerp_for_z, ResampleWorkspace & workspace)
+  : resampled_arclength_(resampled_arclength),
+    use_akima_spline_for_xy_(use_akima_spline_for_xy),
+    use_lerp_for_z_(use_lerp_for_z),
+    workspace_(workspace)
+  {
+    auto & input_arclength = workspace_.input_arclength;
+    input_arclength.resize(input_points.size());
+    workspace_.x.resize(input_points.size());
+    workspace_.y.resize(input_points.size());
+    workspace_.z.resize(input_points.size());
+    input_arclength.at(0) = 0.0;
+    for (size_t i = 0; i < input_points.size(); ++i) {
+      const auto & curr_pt = autoware::universe_utils::getPoint(input_points.at(i));
+      if (i != 0) {
+        const auto & prev_pt = autoware::universe_utils::getPoint(input_points.at(i - 1));
+        const double ds = autoware::universe_utils::calcDistance2d(prev_pt, curr_pt);
+        input_arclength.at(i) = ds + input_arclength.at(i - 1);
+      }
+      workspace_.x.at(i) = curr_pt.x;
+      workspace_.y.at(i) = curr_pt.y;
+      workspace_.z.at(i) = curr_pt.z;
+    }
+
+    // throw exception for invalid arguments as the linear interpolation does
+    if (!autoware::interpolation::isNotDecreasing(resampled_arclength)) {
+      throw std::invalid_argument("Either base_keys or query_keys is not sorted.");
+    }
+    constexpr double epsilon = 1e-3;
+    if (
+      resampled_arclength.front() < input_arclength.front() - epsilon ||
+      input_arclength.back() + epsilon < resampled_arclength.back()) {
+      throw std::invalid_argument("query_keys is out of base_keys");
+    }
+
+    if (!use_akima_spline_for_xy_) {
+      autoware::interpolation::calcAkimaCoefficients(
+        input_arclength, workspace_.x, workspace_.x_a, workspace_.x_b, workspace_.x_c,
+        workspace_.x_d);
+      autoware::interpolation::calcAkimaCoefficients(
+        input_arclength, workspace_.y, workspace_.y_a, workspace_.y_b, workspace_.y_c,
+        workspace_.y_d);
+    }
+    if (!use_lerp_for_z_) {
+      interpolated_z_ =
+        autoware::interpolation::spline(input_arclength, workspace_.z, resampled_arclength);
+    }
+  }
+
+  // locate the i-th resampled arc length, where i must not decrease between the calls
+  void locate(const size_t i)
+  {
+    const auto & base_keys = workspace_.input_arclength;
+    const double query_key = resampled_arclength_.at(i);
+    query_idx_ = i;
+
+    // NOTE: The linear interpolation and zero order hold crop the first and last query keys into
+    //       the base keys as validateKeys() does, while the Akima spline does not.
+    double validated_query_key = query_key;
+    if (i == 0) {
+      validated_query_key = std::max(validated_query_key, base_keys.front());
+    }
+    if (i == resampled_arclength_.size() - 1) {
+      validated_query_key = std::min(validated_query_key, base_keys.back());
+    }
+
+    while (base_keys.at(lerp_idx_ + 1) < validated_query_key) {
+      ++lerp_idx_;
+    }
+    ratio_ = (validated_query_key - base_keys.at(lerp_idx_)) /
+             (base_keys.at(lerp_idx_ + 1) - base_keys.at(lerp_idx_));
+
+    // NOTE: upper_idx_ is the last index j such that base_keys[j - 1] - threshold < query key,
+    //       which is the segment calc_closest_segment_indices() searches backward for.
+    if (base_keys.back() - zero_order_hold_overlap_threshold < validated_query_key) {
+      closest_idx_ = base_keys.size() - 1;
+    } else {
+      while (upper_idx_ + 1 < base_keys.size() &&
+             base_keys.at(upper_idx_) - zero_order_hold_overlap_threshold < validated_query_key) {
+        ++upper_idx_;
+      }
+      if (closest_idx_ < upper_idx_) {
+        closest_idx_ = upper_idx_ - 1;
+      }
+    }
+
+    while (base_keys.at(spline_idx_ + 1) < query_key) {
+      ++spline_idx_;
+    }
+    spline_ds_ = query_key - base_keys.at(spline_idx_);
+  }
+
+  // interpolate the values given by the function of the input point index
+  template <class F>
+  double lerp(const F & values) const
+  {
+    return autoware::interpolation::lerp(values(lerp_idx_), values(lerp_idx_ + 1), ratio_);
+  }
+
+  template <class F>
+  double zeroOrderHold(const F & values) const
+  {
+    return values(closest_idx_);
+  }
+
+  geometry_msgs::msg::Point position() const
+  {
+    const auto lerp_values = [this](const std::vector<double> & values) {
+      return lerp([&values](const size_t idx) { return values.at(idx); });
+    };
+    const auto spline_values = [this](
+                                 const std::vector<double> & a, const std::vector<double> & b,
+                                 const std::vector<double> & c, const std::vector<double> & d) {
+      const size_t j = spline_idx_;
+      const double ds = spline_ds_;
+      return d.at(j) + (c.at(j) + (b.at(j) + a.at(j) * ds) * ds) * ds;
+    };
+
+    geometry_msgs::msg::Point point;
+    if (use_akima_spline_for_xy_) {
+      point.x = lerp_values(workspace_.x);
+      point.y = lerp_values(workspace_.y);
+    } else {
+      point.x = spline_values(workspace_.x_a, workspace_.x_b, workspace_.x_c, workspace_.x_d);
+      point.y = spline_values(workspace_.y_a, workspace_.y_b, workspace_.y_c, workspace_.y_d);
+    }
+    point.z = use_lerp_for_z_ ? lerp_values(workspace_.z) : interpolated_z_.at(query_idx_);
+    return point;
+  }
+
+private:
+  static constexpr double zero_order_hold_overlap_threshold = 1e-3;
+
+  const std::vector<double> & resampled_arclength_;
+  const bool use_akima_spline_for_xy_;
+  const bool use_lerp_for_z_;
+  ResampleWorkspace & workspace_;
+  std::vector<double> interpolated_z_;
+
+  size_t query_idx_{0};
+  size_t lerp_idx_{0};
+  double ratio_{0.0};
+  size_t upper_idx_{1};
+  size_t closest_idx_{0};
+  size_t spline_idx_{0};
+  double spline_ds_{0.0};
+};
+
+// insert the orientation of the resampled points in the same way as resamplePoseVector()
+template <class T>
+void insertResampledOrientation(
+  const std::vector<T> & input_points, const std::vector<double> & resampled_arclength,
+  std::vector<T> & output_points)
+{
+  const bool is_driving_forward =
+    autoware::universe_utils::isDrivingForward(input_points.at(0), input_points.at(1));
+  autoware::motion_utils::insertOrientation(output_points, is_driving_forward);
+
+  // Initial orientation is depend on the initial value of the resampled_arclength
+  // when backward driving
+  if (!is_driving_forward && resampled_arclength.front() < 1e-3) {
+    output_points.at(0).pose.orientation = input_points.at(0).pose.orientation;
+  }
+}
+}  // namespace
+
 std::vector<geometry_msgs::msg::Point> resamplePointVector(
   const std::vector<geometry_msgs::msg::Point> & points,
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy,
@@ -40,25 +220,24 @@ std::vector<geometry_msgs::msg::Point> resamplePointVector(
 
   // Input Path Information
   std::vector<double> input_arclength;
-  std::vector<double> x;
-  std::vector<double> y;
+  std::vector<std::vector<double>> xy(2);
   std::vector<double> z;
   input_arclength.reserve(points.size());
-  x.reserve(points.size());
-  y.reserve(points.size());
+  xy.at(0).reserve(points.size());
+  xy.at(1).reserve(points.size());
   z.reserve(points.size());
 
   input_arclength.push_back(0.0);
-  x.push_back(points.front().x);
-  y.push_back(points.front().y);
+  xy.at(0).push_back(points.front().x);
+  xy.at(1).push_back(points.front().y);
   z.push_back(points.front().z);
   for (size_t i = 1; i < points.size(); ++i) {
     const auto & prev_pt = points.at(i - 1);
     const auto & curr_pt = points.at(i);
     const double ds = autoware::universe_utils::calcDistance2d(prev_pt, curr_pt);
     input_arclength.push_back(ds + input_arclength.back());
-    x.push_back(curr_pt.x);
-    y.push_back(curr_pt.y);
+    xy.at(0).push_back(curr_pt.x);
+    xy.at(1).push_back(curr_pt.y);
     z.push_back(curr_pt.z);
   }
 
@@ -69,12 +248,15 @@ std::vector<geometry_msgs::msg::Point> resamplePointVector(
   const auto spline = [&](const auto & input) {
     return autoware::interpolation::spline(input_arclength, input, resampled_arclength);
   };
-  const auto spline_by_akima = [&](const auto & input) {
-    return autoware::interpolation::splineByAkima(input_arclength, input, resampled_arclength);
-  };
 
-  const auto interpolated_x = use_akima_spline_for_xy ? lerp(x) : spline_by_akima(x);
-  const auto interpolated_y = use_akima_spline_for_xy ? lerp(y) : spline_by_akima(y);
+  // NOTE: x and y share the arc length, so that the spline locates the resampled arc length only
+  //       once for both of them.
+  const auto interpolated_xy =
+    use_akima_spline_for_xy
+      ? std::vector<std::vector<double>>{lerp(xy.at(0)), lerp(xy.at(1))}
+      : autoware::interpolation::splineByAkimaBatch(input_arclength, xy, resampled_arclength);
+  const auto & interpolated_x = interpolated_xy.at(0);
+  const auto & interpolated_y = interpolated_xy.at(1);
   const auto interpolated_z = use_lerp_for_z ? lerp(z) : spline(z);
 
   std::vector<geometry_msgs::msg::Point> resampled_points;
@@ -429,84 +611,58 @@ autoware_planning_msgs::msg::Path resamplePath(
   const autoware_planning_msgs::msg::Path & input_path,
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy,
   const bool use_lerp_for_z, const bool use_zero_order_hold_for_v)
+{
+  ResampleWorkspace workspace;
+  autoware_planning_msgs::msg::Path resampled_path;
+  resamplePath(
+    input_path, resampled_arclength, workspace, resampled_path, use_akima_spline_for_xy,
+    use_lerp_for_z, use_zero_order_hold_for_v);
+  return resampled_path;
+}
+
+void resamplePath(
+  const autoware_planning_msgs::msg::Path & input_path,
+  const std::vector<double> & resampled_arclength, ResampleWorkspace & workspace,
+  autoware_planning_msgs::msg::Path & output_path, const bool use_akima_spline_for_xy,
+  const bool use_lerp_for_z, const bool use_zero_order_hold_for_v)
 {
   // validate arguments
   if (!resample_utils::validate_arguments(input_path.points, resampled_arclength)) {
-    return input_path;
+    output_path = input_path;
+    return;
   }
 
-  // Input Path Information
-  std::vector<double> input_arclength;
-  std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
-  input_arclength.reserve(input_path.points.size());
-  input_pose.reserve(input_path.points.size());
-  v_lon.reserve(input_path.points.size());
-  v_lat.reserve(input_path.points.size());
-  heading_rate.reserve(input_path.points.size());
-
-  input_arclength.push_back(0.0);
-  input_pose.push_back(input_path.points.front().pose);
-  v_lon.push_back(input_path.points.front().longitudinal_velocity_mps);
-  v_lat.push_back(input_path.points.front().lateral_velocity_mps);
-  heading_rate.push_back(input_path.points.front().heading_rate_rps);
-  for (size_t i = 1; i < input_path.points.size(); ++i) {
-    const auto & prev_pt = input_path.points.at(i - 1);
-    const auto & curr_pt = input_path.points.at(i);
-    const double ds =
-      autoware::universe_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
-    input_arclength.push_back(ds + input_arclength.back());
-    input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
-  }
-
-  // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
+  const auto & input_points = input_path.points;
+  const auto v_lon = [&](const size_t idx) {
+    return input_points.at(idx).longitudinal_velocity_mps;
   };
-
-  std::vector<size_t> closest_segment_indices;
-  if (use_zero_order_hold_for_v) {
-    closest_segment_indices =
-      autoware::interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
-  }
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
+  const auto v_lat = [&](const size_t idx) { return input_points.at(idx).lateral_velocity_mps; };
+  const auto heading_rate = [&](const size_t idx) {
+    return input_points.at(idx).heading_rate_rps;
   };
 
-  const auto interpolated_pose =
-    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-
-  if (interpolated_pose.size() != resampled_arclength.size()) {
-    std::cerr
-      << "[autoware_motion_utils]: Resampled pose size is different from resampled arclength"
-      << std::endl;
-    return input_path;
-  }
+  // Interpolate
+  PointResampler resampler(
+    input_points, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z, workspace);
+  const auto lerp_or_zoh = [&](const auto & values, const bool use_zero_order_hold) {
+    return use_zero_order_hold ? resampler.zeroOrderHold(values) : resampler.lerp(values);
+  };
 
-  autoware_planning_msgs::msg::Path resampled_path;
-  resampled_path.header = input_path.header;
-  resampled_path.left_bound = input_path.left_bound;
-  resampled_path.right_bound = input_path.right_bound;
-  resampled_path.points.resize(interpolated_pose.size());
-  for (size_t i = 0; i < resampled_path.points.size(); ++i) {
+  output_path.header = input_path.header;
+  output_path.left_bound = input_path.left_bound;
+  output_path.right_bound = input_path.right_bound;
+  output_path.points.resize(resampled_arclength.size());
+  for (size_t i = 0; i < output_path.points.size(); ++i) {
+    resampler.locate(i);
     autoware_planning_msgs::msg::PathPoint path_point;
-    path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    resampled_path.points.at(i) = path_point;
+    path_point.pose.position = resampler.position();
+    path_point.longitudinal_velocity_mps = lerp_or_zoh(v_lon, use_zero_order_hold_for_v);
+    path_point.lateral_velocity_mps = lerp_or_zoh(v_lat, use_zero_order_hold_for_v);
+    path_point.heading_rate_rps = resampler.lerp(heading_rate);
+    output_path.points.at(i) = path_point;
   }
 
-  return resampled_path;
+  insertResampledOrientation(input_points, resampled_arclength, output_path.points);
 }
 
 autoware_planning_msgs::msg::Path resamplePath(
@@ -572,145 +728,123 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
   const autoware_planning_msgs::msg::Trajectory & input_trajectory,
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy,
   const bool use_lerp_for_z, const bool use_zero_order_hold_for_twist)
+{
+  ResampleWorkspace workspace;
+  autoware_planning_msgs::msg::Trajectory resampled_trajectory;
+  resampleTrajectory(
+    input_trajectory, resampled_arclength, workspace, resampled_trajectory,
+    use_akima_spline_for_xy, use_lerp_for_z, use_zero_order_hold_for_twist);
+  return resampled_trajectory;
+}
+
+void resampleTrajectory(
+  const autoware_planning_msgs::msg::Trajectory & input_trajectory,
+  const std::vector<double> & resampled_arclength, ResampleWorkspace & workspace,
+  autoware_planning_msgs::msg::Trajectory & output_trajectory, const bool use_akima_spline_for_xy,
+  const bool use_lerp_for_z, const bool use_zero_order_hold_for_twist)
 {
   // validate arguments
   if (!resample_utils::validate_arguments(input_trajectory.points, resampled_arclength)) {
-    return input_trajectory;
+    output_trajectory = input_trajectory;
+    return;
   }
 
-  // Input Trajectory Information
-  std::vector<double> input_arclength;
-  std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
-  std::vector<double> acceleration;
-  std::vector<double> front_wheel_angle;
-  std::vector<double> rear_wheel_angle;
-  std::vector<double> time_from_start;
-  input_arclength.reserve(input_trajectory.points.size());
-  input_pose.reserve(input_trajectory.points.size());
-  v_lon.reserve(input_trajectory.points.size());
-  v_lat.reserve(input_trajectory.points.size());
-  heading_rate.reserve(input_trajectory.points.size());
-  acceleration.reserve(input_trajectory.points.size());
-  front_wheel_angle.reserve(input_trajectory.points.size());
-  rear_wheel_angle.reserve(input_trajectory.points.size());
-  time_from_start.reserve(input_trajectory.points.size());
-
-  input_arclength.push_back(0.0);
-  input_pose.push_back(input_trajectory.points.front().pose);
-  v_lon.push_back(input_trajectory.points.front().longitudinal_velocity_mps);
-  v_lat.push_back(input_trajectory.points.front().lateral_velocity_mps);
-  heading_rate.push_back(input_trajectory.points.front().heading_rate_rps);
-  acceleration.push_back(input_trajectory.points.front().acceleration_mps2);
-  front_wheel_angle.push_back(input_trajectory.points.front().front_wheel_angle_rad);
-  rear_wheel_angle.push_back(input_trajectory.points.front().rear_wheel_angle_rad);
-  time_from_start.push_back(
-    rclcpp::Duration(input_trajectory.points.front().time_from_start).seconds());
-
-  for (size_t i = 1; i < input_trajectory.points.size(); ++i) {
-    const auto & prev_pt = input_trajectory.points.at(i - 1);
-    const auto & curr_pt = input_trajectory.points.at(i);
-    const double ds =
-      autoware::universe_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
-
-    input_arclength.push_back(ds + input_arclength.back());
-    input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
-    acceleration.push_back(curr_pt.acceleration_mps2);
-    front_wheel_angle.push_back(curr_pt.front_wheel_angle_rad);
-    rear_wheel_angle.push_back(curr_pt.rear_wheel_angle_rad);
-    time_from_start.push_back(rclcpp::Duration(curr_pt.time_from_start).seconds());
-  }
+  const auto & input_points = input_trajectory.points;
 
   // Set Zero Velocity After Stop Point
   // If the longitudinal velocity is zero, set the velocity to zero after that point.
-  bool stop_point_found_in_v_lon = false;
   constexpr double epsilon = 1e-4;
-  for (size_t i = 0; i < v_lon.size(); ++i) {
-    if (std::abs(v_lon.at(i)) < epsilon) {
-      stop_point_found_in_v_lon = true;
-    }
-    if (stop_point_found_in_v_lon) {
-      v_lon.at(i) = 0.0;
+  size_t stop_idx = input_points.size();
+  for (size_t i = 0; i < input_points.size(); ++i) {
+    if (std::abs(input_points.at(i).longitudinal_velocity_mps) < epsilon) {
+      stop_idx = i;
+      break;
     }
   }
 
-  // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return autoware::interpolation::lerp(input_arclength, input, resampled_arclength);
+  const auto v_lon = [&](const size_t idx) {
+    return idx < stop_idx ? input_points.at(idx).longitudinal_velocity_mps : 0.0;
   };
-
-  std::vector<size_t> closest_segment_indices;
-  if (use_zero_order_hold_for_twist) {
-    closest_segment_indices =
-      autoware::interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
-  }
-  const auto zoh = [&](const auto & input) {
-    return autoware::interpolation::zero_order_hold(
-      input_arclength, input, closest_segment_indices);
+  const auto v_lat = [&](const size_t idx) { return input_points.at(idx).lateral_velocity_mps; };
+  const auto heading_rate = [&](const size_t idx) {
+    return input_points.at(idx).heading_rate_rps;
+  };
+  const auto acceleration = [&](const size_t idx) {
+    return input_points.at(idx).acceleration_mps2;
+  };
+  const auto front_wheel_angle = [&](const size_t idx) {
+    return input_points.at(idx).front_wheel_angle_rad;
+  };
+  const auto rear_wheel_angle = [&](const size_t idx) {
+    return input_points.at(idx).rear_wheel_angle_rad;
+  };
+  const auto time_from_start = [&](const size_t idx) {
+    return rclcpp::Duration(input_points.at(idx).time_from_start).seconds();
   };
 
-  const auto interpolated_pose =
-    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_twist ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_acceleration =
-    use_zero_order_hold_for_twist ? zoh(acceleration) : lerp(acceleration);
-  const auto interpolated_front_wheel_angle = lerp(front_wheel_angle);
-  const auto interpolated_rear_wheel_angle = lerp(rear_wheel_angle);
-  const auto interpolated_time_from_start = lerp(time_from_start);
-
-  if (interpolated_pose.size() != resampled_arclength.size()) {
-    std::cerr
-      << "[autoware_motion_utils]: Resampled pose size is different from resampled arclength"
-      << std::endl;
-    return input_trajectory;
-  }
+  // Interpolate
+  PointResampler resampler(
+    input_points, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z, workspace);
+  const auto lerp_or_zoh = [&](const auto & values, const bool use_zero_order_hold) {
+    return use_zero_order_hold ? resampler.zeroOrderHold(values) : resampler.lerp(values);
+  };
 
-  autoware_planning_msgs::msg::Trajectory resampled_trajectory;
-  resampled_trajectory.header = input_trajectory.header;
-  resampled_trajectory.points.resize(interpolated_pose.size());
-  for (size_t i = 0; i < resampled_trajectory.points.size(); ++i) {
+  output_trajectory.header = input_trajectory.header;
+  output_trajectory.points.resize(resampled_arclength.size());
+  for (size_t i = 0; i < output_trajectory.points.size(); ++i) {
+    resampler.locate(i);
     autoware_planning_msgs::msg::TrajectoryPoint traj_point;
-    traj_point.pose = interpolated_pose.at(i);
-    traj_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    traj_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    traj_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    traj_point.acceleration_mps2 = interpolated_acceleration.at(i);
-    traj_point.front_wheel_angle_rad = interpolated_front_wheel_angle.at(i);
-    traj_point.rear_wheel_angle_rad = interpolated_rear_wheel_angle.at(i);
-    traj_point.time_from_start = rclcpp::Duration::from_seconds(interpolated_time_from_start.at(i));
-    resampled_trajectory.points.at(i) = traj_point;
-  }
+    traj_point.pose.position = resampler.position();
+    traj_point.longitudinal_velocity_mps = lerp_or_zoh(v_lon, use_zero_order_hold_for_twist);
+    traj_point.lateral_velocity_mps = lerp_or_zoh(v_lat, use_zero_order_hold_for_twist);
+    traj_point.heading_rate_rps = resampler.lerp(heading_rate);
+    traj_point.acceleration_mps2 = lerp_or_zoh(acceleration, use_zero_order_hold_for_twist);
+    traj_point.front_wheel_angle_rad = resampler.lerp(front_wheel_angle);
+    traj_point.rear_wheel_angle_rad = resampler.lerp(rear_wheel_angle);
+    traj_point.time_from_start = rclcpp::Duration::from_seconds(resampler.lerp(time_from_start));
+    output_trajectory.points.at(i) = traj_point;
+  }
+
+  insertResampledOrientation(input_points, resampled_arclength, output_trajectory.points);
+}
 
+autoware_planning_msgs::msg::Trajectory resampleTrajectory(
+  const autoware_planning_msgs::msg::Trajectory & input_trajectory, const double resample_interval,
+  const bool use_akima_spline_for_xy, const bool use_lerp_for_z,
+  const bool use_zero_order_hold_for_twist, const bool resample_input_trajectory_stop_point)
+{
+  ResampleWorkspace workspace;
+  autoware_planning_msgs::msg::Trajectory resampled_trajectory;
+  resampleTrajectory(
+    input_trajectory, resample_interval, workspace, resampled_trajectory, use_akima_spline_for_xy,
+    use_lerp_for_z, use_zero_order_hold_for_twist, resample_input_trajectory_stop_point);
   return resampled_trajectory;
 }
 
-autoware_planning_msgs::msg::Trajectory resampleTrajectory(
+void resampleTrajectory(
   const autoware_planning_msgs::msg::Trajectory & input_trajectory, const double resample_interval,
+  ResampleWorkspace & workspace, autoware_planning_msgs::msg::Trajectory & output_trajectory,
   const bool use_akima_spline_for_xy, const bool use_lerp_for_z,
   const bool use_zero_order_hold_for_twist, const bool resample_input_trajectory_stop_point)
 {
   // validate arguments
   if (!resample_utils::validate_arguments(input_trajectory.points, resample_interval)) {
-    return input_trajectory;
+    output_trajectory = input_trajectory;
+    return;
   }
 
   const double input_trajectory_len =
     autoware::motion_utils::calcArcLength(input_trajectory.points);
 
-  std::vector<double> resampling_arclength;
+  auto & resampling_arclength = workspace.resampling_arclength;
+  resampling_arclength.clear();
   for (double s = 0.0; s < input_trajectory_len; s += resample_interval) {
     resampling_arclength.push_back(s);
   }
   if (resampling_arclength.empty()) {
     std::cerr << "[autoware_motion_utils]: resampling arclength is empty" << std::endl;
-    return input_trajectory;
+    output_trajectory = input_trajectory;
+    return;
   }
 
   // Insert terminal point
@@ -748,9 +882,9 @@ autoware_planning_msgs::msg::Trajectory resampleTrajectory(
     }
   }
 
-  return resampleTrajectory(
-    input_trajectory, resampling_arclength, use_akima_spline_for_xy, use_lerp_for_z,
-    use_zero_order_hold_for_twist);
+  resampleTrajectory(
+    input_trajectory, resampling_arclength, workspace, output_trajectory, use_akima_spline_for_xy,
+    use_lerp_for_z, use_zero_order_hold_for_twist);
 }
 
 }  // namespace autoware::motion_utils
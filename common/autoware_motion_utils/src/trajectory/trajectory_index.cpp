@@ -0,0 +1,350 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/trajectory_index.hpp"
+
+#include "autoware/universe_utils/math/normalization.hpp"
+#include "autoware/universe_utils/system/backtrace.hpp"
+
+#include <Eigen/Core>
+#include <tf2/utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::motion_utils
+{
+void TrajectoryIndex::build(const std::vector<geometry_msgs::msg::Pose> & poses)
+{
+  const size_t num_points = poses.size();
+  xs_.reserve(num_points);
+  ys_.reserve(num_points);
+  yaws_.reserve(num_points);
+  arc_lengths_.reserve(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    xs_.push_back(poses.at(i).position.x);
+    ys_.push_back(poses.at(i).position.y);
+    yaws_.push_back(tf2::getYaw(poses.at(i).orientation));
+    if (i == 0) {
+      arc_lengths_.push_back(0.0);
+    } else {
+      const double dist = std::hypot(xs_.at(i) - xs_.at(i - 1), ys_.at(i) - ys_.at(i - 1));
+      arc_lengths_.push_back(arc_lengths_.back() + dist);
+    }
+  }
+  if (num_points == 0) {
+    return;
+  }
+
+  // NOTE: same overlap criterion as removeOverlapPoints()
+  constexpr double eps = 1.0E-08;
+  next_distinct_indices_.resize(num_points, num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    for (size_t j = i + 1; j < num_points; ++j) {
+      if (std::abs(xs_.at(i) - xs_.at(j)) >= eps || std::abs(ys_.at(i) - ys_.at(j)) >= eps) {
+        next_distinct_indices_.at(i) = j;
+        break;
+      }
+    }
+  }
+
+  // A cell spans a couple of points so that the nearest search usually visits only a few cells
+  if (1 < num_points && 0.0 < arc_lengths_.back()) {
+    cell_size_ = 2.0 * arc_lengths_.back() / static_cast<double>(num_points - 1);
+  }
+
+  min_cell_x_ = max_cell_x_ = toCellIndex(xs_.front());
+  min_cell_y_ = max_cell_y_ = toCellIndex(ys_.front());
+  for (size_t i = 0; i < num_points; ++i) {
+    const int64_t ix = toCellIndex(xs_.at(i));
+    const int64_t iy = toCellIndex(ys_.at(i));
+    min_cell_x_ = std::min(min_cell_x_, ix);
+    min_cell_y_ = std::min(min_cell_y_, iy);
+    max_cell_x_ = std::max(max_cell_x_, ix);
+    max_cell_y_ = std::max(max_cell_y_, iy);
+    cells_[toCellKey(ix, iy)].push_back(static_cast<uint32_t>(i));
+  }
+}
+
+int64_t TrajectoryIndex::toCellIndex(const double v) const
+{
+  return static_cast<int64_t>(std::floor(v / cell_size_));
+}
+
+uint64_t TrajectoryIndex::toCellKey(const int64_t ix, const int64_t iy)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(ix)) << 32) |
+         static_cast<uint64_t>(static_cast<uint32_t>(iy));
+}
+
+template <class Predicate>
+std::optional<size_t> TrajectoryIndex::findNearestIndexIf(
+  const double x, const double y, const double max_squared_dist, const Predicate & is_valid) const
+{
+  if (empty()) {
+    return std::nullopt;
+  }
+
+  double min_squared_dist = std::numeric_limits<double>::max();
+  std::optional<size_t> min_idx;
+
+  // NOTE: The smaller index is taken among the points of the same distance as the linear search.
+  const auto update_nearest = [&](const size_t i) {
+    const double dx = xs_[i] - x;
+    const double dy = ys_[i] - y;
+    const double squared_dist = dx * dx + dy * dy;
+    if (squared_dist > max_squared_dist) {
+      return;
+    }
+    if (min_idx && (min_squared_dist < squared_dist ||
+                    (squared_dist == min_squared_dist && *min_idx < i))) {
+      return;
+    }
+    if (!is_valid(i)) {
+      return;
+    }
+    min_squared_dist = squared_dist;
+    min_idx = i;
+  };
+
+  const int64_t cx = toCellIndex(x);
+  const int64_t cy = toCellIndex(y);
+
+  // The rings before reaching the grid are empty, and the rings after covering the grid are too.
+  const int64_t min_ring = std::max(
+    {int64_t{0}, min_cell_x_ - cx, cx - max_cell_x_, min_cell_y_ - cy, cy - max_cell_y_});
+  const int64_t max_ring =
+    std::max({cx - min_cell_x_, max_cell_x_ - cx, cy - min_cell_y_, max_cell_y_ - cy});
+
+  // Scanning all the points is cheaper than visiting too many cells for a query far from the points
+  const size_t max_visited_cells = 4 * size() + 16;
+  constexpr double ring_dist_margin = 1e-6;
+  size_t visited_cells = 0;
+
+  const auto visit_cell = [&](const int64_t ix, const int64_t iy) {
+    ++visited_cells;
+    const auto itr = cells_.find(toCellKey(ix, iy));
+    if (itr == cells_.end()) {
+      return;
+    }
+    for (const uint32_t i : itr->second) {
+      update_nearest(i);
+    }
+  };
+
+  for (int64_t r = min_ring; r <= max_ring; ++r) {
+    // all the points in the ring are farther than this (with a margin for the rounding error)
+    const double ring_dist =
+      std::max(0.0, static_cast<double>(r - 1) * cell_size_ - ring_dist_margin);
+    if (max_squared_dist < ring_dist * ring_dist) {
+      break;
+    }
+    if (min_idx && min_squared_dist < ring_dist * ring_dist) {
+      break;
+    }
+    if (max_visited_cells < visited_cells) {
+      min_idx = std::nullopt;
+      min_squared_dist = std::numeric_limits<double>::max();
+      for (size_t i = 0; i < size(); ++i) {
+        update_nearest(i);
+      }
+      return min_idx;
+    }
+
+    if (r == 0) {
+      visit_cell(cx, cy);
+      continue;
+    }
+
+    const int64_t begin_x = std::max(cx - r, min_cell_x_);
+    const int64_t end_x = std::min(cx + r, max_cell_x_);
+    const int64_t begin_y = std::max(cy - r + 1, min_cell_y_);
+    const int64_t end_y = std::min(cy + r - 1, max_cell_y_);
+    for (int64_t ix = begin_x; ix <= end_x; ++ix) {
+      if (min_cell_y_ <= cy - r) visit_cell(ix, cy - r);
+      if (cy + r <= max_cell_y_) visit_cell(ix, cy + r);
+    }
+    for (int64_t iy = begin_y; iy <= end_y; ++iy) {
+      if (min_cell_x_ <= cx - r) visit_cell(cx - r, iy);
+      if (cx + r <= max_cell_x_) visit_cell(cx + r, iy);
+    }
+  }
+
+  return min_idx;
+}
+
+size_t TrajectoryIndex::findNearestIndex(const geometry_msgs::msg::Point & point) const
+{
+  if (empty()) {
+    autoware::universe_utils::print_backtrace();
+    throw std::invalid_argument("[autoware_motion_utils] validateNonEmpty(): Points is empty.");
+  }
+
+  return *findNearestIndexIf(
+    point.x, point.y, std::numeric_limits<double>::max(), [](const size_t) { return true; });
+}
+
+std::optional<size_t> TrajectoryIndex::findNearestIndex(
+  const geometry_msgs::msg::Pose & pose, const double max_dist, const double max_yaw) const
+{
+  const double yaw = tf2::getYaw(pose.orientation);
+  return findNearestIndexIf(
+    pose.position.x, pose.position.y, max_dist * max_dist, [&](const size_t i) {
+      return std::fabs(autoware::universe_utils::normalizeRadian(yaw - yaws_[i])) <= max_yaw;
+    });
+}
+
+double TrajectoryIndex::calcLongitudinalOffsetToSegment(
+  const size_t seg_idx, const geometry_msgs::msg::Point & p_target,
+  const bool throw_exception) const
+{
+  const auto return_nan = [&](const std::string & error_message, const auto & exception) {
+    autoware::universe_utils::print_backtrace();
+    if (throw_exception) {
+      throw exception;
+    }
+    RCLCPP_DEBUG(
+      get_logger(),
+      "%s Return NaN since no_throw option is enabled. The maintainer must check the code.",
+      error_message.c_str());
+    return std::nan("");
+  };
+
+  if (empty()) {
+    const std::string error_message("[autoware_motion_utils] validateNonEmpty(): Points is empty.");
+    return return_nan(error_message, std::invalid_argument(error_message));
+  }
+  if (seg_idx >= size() - 1) {
+    const std::string error_message(
+      "[autoware_motion_utils] " + std::string(__func__) +
+      ": Failed to calculate longitudinal offset because the given segment index is out of the "
+      "points size.");
+    return return_nan(error_message, std::out_of_range(error_message));
+  }
+
+  const size_t next_idx = next_distinct_indices_.at(seg_idx);
+  if (next_idx == size()) {
+    const std::string error_message(
+      "[autoware_motion_utils] " + std::string(__func__) +
+      ": Longitudinal offset calculation is not supported for the same points.");
+    return return_nan(error_message, std::runtime_error(error_message));
+  }
+
+  const Eigen::Vector3d segment_vec{
+    xs_.at(next_idx) - xs_.at(seg_idx), ys_.at(next_idx) - ys_.at(seg_idx), 0};
+  const Eigen::Vector3d target_vec{p_target.x - xs_.at(seg_idx), p_target.y - ys_.at(seg_idx), 0};
+
+  return segment_vec.dot(target_vec) / segment_vec.norm();
+}
+
+size_t TrajectoryIndex::findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const
+{
+  const size_t nearest_idx = findNearestIndex(point);
+
+  if (nearest_idx == 0) {
+    return 0;
+  }
+  if (nearest_idx == size() - 1) {
+    return size() - 2;
+  }
+
+  const double signed_length = calcLongitudinalOffsetToSegment(nearest_idx, point);
+
+  if (signed_length <= 0) {
+    return nearest_idx - 1;
+  }
+
+  return nearest_idx;
+}
+
+std::optional<size_t> TrajectoryIndex::findNearestSegmentIndex(
+  const geometry_msgs::msg::Pose & pose, const double max_dist, const double max_yaw) const
+{
+  const auto nearest_idx = findNearestIndex(pose, max_dist, max_yaw);
+
+  if (!nearest_idx) {
+    return std::nullopt;
+  }
+
+  if (*nearest_idx == 0) {
+    return 0;
+  }
+  if (*nearest_idx == size() - 1) {
+    return size() - 2;
+  }
+
+  const double signed_length = calcLongitudinalOffsetToSegment(*nearest_idx, pose.position);
+
+  if (signed_length <= 0) {
+    return *nearest_idx - 1;
+  }
+
+  return *nearest_idx;
+}
+
+double TrajectoryIndex::calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const
+{
+  if (empty()) {
+    return 0.0;
+  }
+
+  return arc_lengths_.at(dst_idx) - arc_lengths_.at(src_idx);
+}
+
+double TrajectoryIndex::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const
+{
+  if (empty()) {
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+
+  const double signed_length_on_traj = calcSignedArcLength(src_seg_idx, dst_idx);
+  const double signed_length_src_offset = calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+
+  return signed_length_on_traj - signed_length_src_offset;
+}
+
+double TrajectoryIndex::calcSignedArcLength(
+  const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const
+{
+  if (empty()) {
+    return 0.0;
+  }
+
+  return -calcSignedArcLength(dst_point, src_idx);
+}
+
+double TrajectoryIndex::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const
+{
+  if (empty()) {
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+  const size_t dst_seg_idx = findNearestSegmentIndex(dst_point);
+
+  const double signed_length_on_traj = calcSignedArcLength(src_seg_idx, dst_seg_idx);
+  const double signed_length_src_offset = calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+  const double signed_length_dst_offset = calcLongitudinalOffsetToSegment(dst_seg_idx, dst_point);
+
+  return signed_length_on_traj - signed_length_src_offset + signed_length_dst_offset;
+}
+}  // namespace autoware::motion_utils
@@ -23,7 +23,9 @@
 #include <gtest/internal/gtest-port.h>
 #include <tf2/LinearMath/Quaternion.h>
 
+#include <cmath>
 #include <limits>
+#include <utility>
 #include <vector>
 
 namespace
@@ -3620,3 +3622,130 @@ TEST(resample_trajectory, resample_with_middle_stop_point)
   EXPECT_NEAR(resampled_traj.points.at(5).longitudinal_velocity_mps, 0.0, epsilon);
   EXPECT_NEAR(resampled_traj.points.at(6).longitudinal_velocity_mps, 0.0, epsilon);
 }
+
+TEST(resample_trajectory, resample_trajectory_with_workspace)
+{
+  using autoware::motion_utils::ResampleWorkspace;
+  using autoware::motion_utils::resampleTrajectory;
+
+  Trajectory traj;
+  for (size_t i = 0; i < 10; ++i) {
+    traj.points.push_back(generateTestTrajectoryPoint(
+      i * 1.0, 0.0, i * 0.2, 0.0, 10.0 - i * 1.0, i * 0.5, i * 0.1, i * 0.05));
+  }
+  const std::vector<double> dense_arclength{0.0, 1.2, 1.5, 5.3, 7.5, 9.0};
+  const std::vector<double> sparse_arclength{0.0, 4.5, 9.0};
+
+  // the orientation follows the slope of z
+  const auto ans_quat = createQuaternionFromRPY(0.0, std::atan(0.2), 0.0);
+
+  // the workspace and the output are reused across the resampling of different sizes
+  ResampleWorkspace workspace;
+  Trajectory resampled_traj;
+  for (const auto use_akima_spline_for_xy : {false, true}) {
+    for (const auto use_zero_order_hold_for_twist : {false, true}) {
+      for (const auto & arclength : {dense_arclength, sparse_arclength, dense_arclength}) {
+        resampleTrajectory(
+          traj, arclength, workspace, resampled_traj, use_akima_spline_for_xy, true,
+          use_zero_order_hold_for_twist);
+
+        ASSERT_EQ(resampled_traj.points.size(), arclength.size());
+        for (size_t i = 0; i < arclength.size(); ++i) {
+          const auto & p = resampled_traj.points.at(i);
+          const double s = arclength.at(i);
+          // zero order hold takes the value of the previous input point
+          const double s_twist = use_zero_order_hold_for_twist ? std::floor(s) : s;
+          EXPECT_NEAR(p.pose.position.x, s, epsilon);
+          EXPECT_NEAR(p.pose.position.y, 0.0, epsilon);
+          EXPECT_NEAR(p.pose.position.z, s * 0.2, epsilon);
+          EXPECT_NEAR(p.pose.orientation.x, ans_quat.x, epsilon);
+          EXPECT_NEAR(p.pose.orientation.y, ans_quat.y, epsilon);
+          EXPECT_NEAR(p.pose.orientation.z, ans_quat.z, epsilon);
+          EXPECT_NEAR(p.pose.orientation.w, ans_quat.w, epsilon);
+          EXPECT_NEAR(p.longitudinal_velocity_mps, 10.0 - s_twist, epsilon);
+          EXPECT_NEAR(p.lateral_velocity_mps, s_twist * 0.5, epsilon);
+          EXPECT_NEAR(p.heading_rate_rps, s * 0.1, epsilon);
+          EXPECT_NEAR(p.acceleration_mps2, s_twist * 0.05, epsilon);
+        }
+      }
+    }
+  }
+
+  // the output keeps its buffer once its capacity is enough
+  const auto * points_data = resampled_traj.points.data();
+  resampleTrajectory(traj, sparse_arclength, workspace, resampled_traj);
+  resampleTrajectory(traj, dense_arclength, workspace, resampled_traj);
+  EXPECT_EQ(resampled_traj.points.data(), points_data);
+
+  // the input is copied for the invalid arguments
+  resampleTrajectory(traj, std::vector<double>{0.0}, workspace, resampled_traj);
+  EXPECT_EQ(resampled_traj.points.size(), traj.points.size());
+}
+
+TEST(resample_trajectory, resample_trajectory_by_interval_with_workspace)
+{
+  using autoware::motion_utils::ResampleWorkspace;
+  using autoware::motion_utils::resampleTrajectory;
+
+  Trajectory traj;
+  for (size_t i = 0; i < 10; ++i) {
+    traj.points.push_back(generateTestTrajectoryPoint(
+      i * 1.0, 0.0, 0.0, 0.0, 10.0 - i * 1.0, i * 0.5, i * 0.1, i * 0.05));
+  }
+
+  ResampleWorkspace workspace;
+  Trajectory resampled_traj;
+  for (const auto & [interval, expected_arclength] :
+       {std::make_pair(2.0, std::vector<double>{0.0, 2.0, 4.0, 6.0, 8.0, 9.0}),
+        std::make_pair(4.5, std::vector<double>{0.0, 4.5, 9.0}),
+        std::make_pair(1.5, std::vector<double>{0.0, 1.5, 3.0, 4.5, 6.0, 7.5, 9.0})}) {
+    resampleTrajectory(traj, interval, workspace, resampled_traj);
+
+    ASSERT_EQ(resampled_traj.points.size(), expected_arclength.size());
+    for (size_t i = 0; i < expected_arclength.size(); ++i) {
+      const auto & p = resampled_traj.points.at(i);
+      const double s = expected_arclength.at(i);
+      EXPECT_NEAR(p.pose.position.x, s, epsilon);
+      EXPECT_NEAR(p.pose.position.y, 0.0, epsilon);
+      EXPECT_NEAR(p.longitudinal_velocity_mps, 10.0 - std::floor(s), epsilon);
+      EXPECT_NEAR(p.heading_rate_rps, s * 0.1, epsilon);
+    }
+  }
+
+  // the input is copied for the invalid interval
+  resampleTrajectory(traj, 0.05, workspace, resampled_traj);
+  EXPECT_EQ(resampled_traj.points.size(), traj.points.size());
+}
+
+TEST(resample_path, resample_path_with_workspace)
+{
+  using autoware::motion_utils::ResampleWorkspace;
+  using autoware::motion_utils::resamplePath;
+
+  Path path;
+  for (size_t i = 0; i < 10; ++i) {
+    path.points.push_back(
+      generateTestPathPoint(i * 1.0, 0.0, 0.0, 0.0, 10.0 - i * 1.0, i * 0.5, i * 0.1));
+  }
+  const std::vector<double> dense_arclength{0.0, 1.2, 1.5, 5.3, 7.5, 9.0};
+  const std::vector<double> sparse_arclength{0.0, 4.5, 9.0};
+
+  ResampleWorkspace workspace;
+  Path resampled_path;
+  for (const auto & arclength : {dense_arclength, sparse_arclength, dense_arclength}) {
+    resamplePath(path, arclength, workspace, resampled_path);
+
+    ASSERT_EQ(resampled_path.points.size(), arclength.size());
+    for (size_t i = 0; i < arclength.size(); ++i) {
+      const auto & p = resampled_path.points.at(i);
+      const double s = arclength.at(i);
+      EXPECT_NEAR(p.pose.position.x, s, epsilon);
+      EXPECT_NEAR(p.pose.position.y, 0.0, epsilon);
+      EXPECT_NEAR(p.pose.orientation.z, 0.0, epsilon);
+      EXPECT_NEAR(p.pose.orientation.w, 1.0, epsilon);
+      EXPECT_NEAR(p.longitudinal_velocity_mps, 10.0 - std::floor(s), epsilon);
+      EXPECT_NEAR(p.lateral_velocity_mps, std::floor(s) * 0.5, epsilon);
+      EXPECT_NEAR(p.heading_rate_rps, s * 0.1, epsilon);
+    }
+  }
+}
@@ -0,0 +1,103 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+#include "autoware/motion_utils/trajectory/trajectory_index.hpp"
+#include "autoware/universe_utils/system/stop_watch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware::universe_utils::createPoint;
+using autoware::universe_utils::createQuaternionFromRPY;
+using TrajectoryPointArray = std::vector<autoware_planning_msgs::msg::TrajectoryPoint>;
+
+TrajectoryPointArray generateCurvedTrajectoryPointArray(
+  const size_t num_points, const double point_interval, const double delta_theta)
+{
+  TrajectoryPointArray traj;
+  double x = 0.0;
+  double y = 0.0;
+  double theta = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    autoware_planning_msgs::msg::TrajectoryPoint p;
+    p.pose.position = createPoint(x, y, 0.0);
+    p.pose.orientation = createQuaternionFromRPY(0.0, 0.0, theta);
+    traj.push_back(p);
+
+    x += point_interval * std::cos(theta);
+    y += point_interval * std::sin(theta);
+    theta += delta_theta;
+  }
+  return traj;
+}
+
+std::vector<geometry_msgs::msg::Point> generateQueryPoints(
+  const TrajectoryPointArray & traj, const size_t num_queries)
+{
+  std::random_device r;
+  std::default_random_engine e1(r());
+  std::uniform_real_distribution<double> offset_dist(-2.0, 2.0);
+  std::uniform_int_distribution<size_t> index_dist(0, traj.size() - 1);
+
+  std::vector<geometry_msgs::msg::Point> points;
+  for (size_t i = 0; i < num_queries; ++i) {
+    const auto & base = traj.at(index_dist(e1)).pose.position;
+    points.push_back(createPoint(base.x + offset_dist(e1), base.y + offset_dist(e1), 0.0));
+  }
+  return points;
+}
+}  // namespace
+
+// Compare the linear search of the free functions with the precomputed index on the same queries.
+TEST(trajectory_benchmark, DISABLED_trajectoryIndex)
+{
+  using autoware::motion_utils::calcSignedArcLength;
+  using autoware::motion_utils::findNearestSegmentIndex;
+  using autoware::motion_utils::TrajectoryIndex;
+
+  constexpr auto nb_iteration = 10000;
+  for (const size_t num_points : {100, 1000, 5000}) {
+    const auto traj = generateCurvedTrajectoryPointArray(num_points, 0.5, 0.003);
+    const auto queries = generateQueryPoints(traj, nb_iteration);
+
+    autoware::universe_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+    double linear_sum = 0.0;
+    for (const auto & query : queries) {
+      linear_sum += static_cast<double>(findNearestSegmentIndex(traj, query));
+      linear_sum += calcSignedArcLength(traj, query, traj.size() - 1);
+    }
+    const double linear_time = stop_watch.toc(true);
+
+    const TrajectoryIndex index(traj);
+    const double build_time = stop_watch.toc(true);
+    double index_sum = 0.0;
+    for (const auto & query : queries) {
+      index_sum += static_cast<double>(index.findNearestSegmentIndex(query));
+      index_sum += index.calcSignedArcLength(query, traj.size() - 1);
+    }
+    const double index_time = stop_watch.toc();
+
+    EXPECT_NEAR(linear_sum, index_sum, 1e-3);
+    std::cout << "num_points: " << num_points << ", linear: " << linear_time
+              << " [ms], index: " << index_time << " [ms] (build: " << build_time << " [ms])"
+              << std::endl;
+  }
+}
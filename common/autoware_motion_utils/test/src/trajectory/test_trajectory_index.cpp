@@ -0,0 +1,195 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+#include "autoware/motion_utils/trajectory/trajectory_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+using autoware::motion_utils::TrajectoryIndex;
+using autoware::universe_utils::createPoint;
+using autoware::universe_utils::createQuaternionFromRPY;
+using TrajectoryPointArray = std::vector<autoware_planning_msgs::msg::TrajectoryPoint>;
+
+constexpr double epsilon = 1e-6;
+
+geometry_msgs::msg::Pose createPose(double x, double y, double yaw)
+{
+  geometry_msgs::msg::Pose p;
+  p.position = createPoint(x, y, 0.0);
+  p.orientation = createQuaternionFromRPY(0.0, 0.0, yaw);
+  return p;
+}
+
+TrajectoryPointArray generateCurvedTrajectoryPointArray(
+  const size_t num_points, const double point_interval, const double delta_theta)
+{
+  TrajectoryPointArray traj;
+  double x = 0.0;
+  double y = 0.0;
+  double theta = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    autoware_planning_msgs::msg::TrajectoryPoint p;
+    p.pose = createPose(x, y, theta);
+    traj.push_back(p);
+
+    x += point_interval * std::cos(theta);
+    y += point_interval * std::sin(theta);
+    theta += delta_theta;
+  }
+  return traj;
+}
+
+std::vector<geometry_msgs::msg::Pose> generateQueryPoses(
+  const TrajectoryPointArray & traj, const size_t num_queries)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> offset_dist(-3.0, 3.0);
+  std::uniform_real_distribution<double> yaw_dist(-M_PI, M_PI);
+  std::uniform_int_distribution<size_t> index_dist(0, traj.size() - 1);
+
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (size_t i = 0; i < num_queries; ++i) {
+    const auto & base = traj.at(index_dist(engine)).pose.position;
+    poses.push_back(
+      createPose(base.x + offset_dist(engine), base.y + offset_dist(engine), yaw_dist(engine)));
+  }
+  // points on the trajectory and far from the trajectory
+  poses.push_back(traj.front().pose);
+  poses.push_back(traj.back().pose);
+  poses.push_back(createPose(1000.0, -1000.0, 0.0));
+  return poses;
+}
+}  // namespace
+
+TEST(trajectory_index, findNearestIndex)
+{
+  using autoware::motion_utils::findNearestIndex;
+
+  const auto traj = generateCurvedTrajectoryPointArray(300, 0.7, 0.03);
+  const TrajectoryIndex index(traj);
+  ASSERT_EQ(index.size(), traj.size());
+
+  for (const auto & pose : generateQueryPoses(traj, 500)) {
+    EXPECT_EQ(index.findNearestIndex(pose.position), findNearestIndex(traj, pose.position));
+    EXPECT_EQ(findNearestIndex(traj, pose.position, index), findNearestIndex(traj, pose.position));
+
+    // with distance and yaw thresholds
+    for (const double max_dist : {std::numeric_limits<double>::max(), 2.0, 0.5}) {
+      for (const double max_yaw : {std::numeric_limits<double>::max(), 0.5}) {
+        EXPECT_EQ(
+          index.findNearestIndex(pose, max_dist, max_yaw),
+          findNearestIndex(traj, pose, max_dist, max_yaw));
+      }
+    }
+  }
+
+  // Empty
+  const TrajectoryIndex empty_index(TrajectoryPointArray{});
+  EXPECT_THROW(empty_index.findNearestIndex(createPoint(0.0, 0.0, 0.0)), std::invalid_argument);
+  EXPECT_FALSE(empty_index.findNearestIndex(createPose(0.0, 0.0, 0.0)));
+}
+
+TEST(trajectory_index, findNearestSegmentIndex)
+{
+  using autoware::motion_utils::findNearestSegmentIndex;
+
+  const auto traj = generateCurvedTrajectoryPointArray(300, 0.7, -0.02);
+  const TrajectoryIndex index(traj);
+
+  for (const auto & pose : generateQueryPoses(traj, 500)) {
+    EXPECT_EQ(
+      index.findNearestSegmentIndex(pose.position), findNearestSegmentIndex(traj, pose.position));
+    EXPECT_EQ(
+      index.findNearestSegmentIndex(pose, 2.0, 0.5), findNearestSegmentIndex(traj, pose, 2.0, 0.5));
+  }
+}
+
+TEST(trajectory_index, calcLongitudinalOffsetToSegment)
+{
+  using autoware::motion_utils::calcLongitudinalOffsetToSegment;
+
+  auto traj = generateCurvedTrajectoryPointArray(10, 1.0, 0.1);
+  // overlapping points
+  traj.insert(traj.begin() + 3, traj.at(3));
+  traj.push_back(traj.back());
+  const TrajectoryIndex index(traj);
+
+  const auto p_target = createPoint(3.0, 2.0, 0.0);
+  for (size_t seg_idx = 0; seg_idx < traj.size() - 2; ++seg_idx) {
+    EXPECT_NEAR(
+      index.calcLongitudinalOffsetToSegment(seg_idx, p_target),
+      calcLongitudinalOffsetToSegment(traj, seg_idx, p_target), epsilon);
+  }
+
+  // Out of range
+  EXPECT_TRUE(std::isnan(index.calcLongitudinalOffsetToSegment(traj.size() - 1, p_target)));
+  EXPECT_THROW(
+    index.calcLongitudinalOffsetToSegment(traj.size() - 1, p_target, true), std::out_of_range);
+
+  // Same points
+  EXPECT_TRUE(std::isnan(index.calcLongitudinalOffsetToSegment(traj.size() - 2, p_target)));
+  EXPECT_THROW(
+    index.calcLongitudinalOffsetToSegment(traj.size() - 2, p_target, true), std::runtime_error);
+}
+
+TEST(trajectory_index, calcSignedArcLength)
+{
+  using autoware::motion_utils::calcSignedArcLength;
+
+  const auto traj = generateCurvedTrajectoryPointArray(200, 0.5, 0.02);
+  const TrajectoryIndex index(traj);
+
+  // Index to index
+  EXPECT_NEAR(index.calcSignedArcLength(0, 199), 99.5, epsilon);
+  EXPECT_NEAR(index.calcSignedArcLength(150, 20), -65.0, epsilon);
+  EXPECT_NEAR(index.calcSignedArcLength(3, 3), 0.0, epsilon);
+  EXPECT_NEAR(calcSignedArcLength(traj, 10, 30, index), calcSignedArcLength(traj, 10, 30), epsilon);
+
+  // Point to index, index to point and point to point
+  const auto poses = generateQueryPoses(traj, 100);
+  for (size_t i = 0; i + 1 < poses.size(); ++i) {
+    const auto & src = poses.at(i).position;
+    const auto & dst = poses.at(i + 1).position;
+    EXPECT_NEAR(index.calcSignedArcLength(src, 50), calcSignedArcLength(traj, src, 50), epsilon);
+    EXPECT_NEAR(index.calcSignedArcLength(50, dst), calcSignedArcLength(traj, 50, dst), epsilon);
+    EXPECT_NEAR(index.calcSignedArcLength(src, dst), calcSignedArcLength(traj, src, dst), epsilon);
+  }
+
+  // Empty
+  const TrajectoryIndex empty_index(TrajectoryPointArray{});
+  EXPECT_DOUBLE_EQ(empty_index.calcSignedArcLength(0, 0), 0.0);
+}
+
+TEST(trajectory_index, fallbackToLinearSearch)
+{
+  using autoware::motion_utils::calcSignedArcLength;
+  using autoware::motion_utils::findNearestSegmentIndex;
+
+  const auto traj = generateCurvedTrajectoryPointArray(50, 1.0, 0.0);
+  // index of other points
+  const TrajectoryIndex index(generateCurvedTrajectoryPointArray(10, 1.0, 0.0));
+
+  const auto point = createPoint(30.5, 0.5, 0.0);
+  EXPECT_EQ(findNearestSegmentIndex(traj, point, index), 30U);
+  EXPECT_NEAR(calcSignedArcLength(traj, 0, 40, index), 40.0, epsilon);
+}
@@ -50,6 +50,11 @@ private:
   bool m_work_initialized = false;
   // Exitflag
   int64_t m_exitflag;
+  // Sparsity patterns of P and A of the current work
+  std::vector<c_int> m_P_row_idxs;
+  std::vector<c_int> m_P_col_idxs;
+  std::vector<c_int> m_A_row_idxs;
+  std::vector<c_int> m_A_col_idxs;
 
   // Runs the solver on the stored problem.
   std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> solve();
@@ -131,6 +136,21 @@ public:
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
 
+  /// \brief Sets up the problem reusing the current workspace if possible.
+  /// \details If the latest problem was solved and P and A have the same sparsity patterns as the
+  /// \details stored ones, only the values of the workspace are updated and the latest solution is
+  /// \details used as the warm start. Otherwise, the workspace is set up from scratch as
+  /// \details initializeProblem. Solve the problem with optimize() afterwards.
+  /// \param P (n,n) upper trapezoidal matrix defining relations between parameters.
+  /// \param A (m,n) matrix defining parameter constraints relative to the lower and upper bound.
+  /// \param q (n) vector defining the linear cost of the problem.
+  /// \param l (m) vector defining the lower bound problem constraint.
+  /// \param u (m) vector defining the upper bound problem constraint.
+  /// \return true if the workspace is reused.
+  bool initializeOrUpdateProblem(
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
+
   // Setter functions for warm start
   bool setWarmStart(
     const std::vector<double> & primal_variables, const std::vector<double> & dual_variables);
@@ -19,6 +19,7 @@
 
 #include <exception>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 
 namespace autoware::osqp_interface
@@ -111,6 +112,68 @@ CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
   return csc_matrix;
 }
 
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat)
+{
+  const size_t elem = static_cast<size_t>(mat.nonZeros());
+
+  std::vector<c_float> vals;
+  vals.reserve(elem);
+  std::vector<c_int> row_idxs;
+  row_idxs.reserve(elem);
+  std::vector<c_int> col_idxs;
+  col_idxs.reserve(static_cast<size_t>(mat.cols()) + 1);
+
+  col_idxs.push_back(0);
+
+  for (Eigen::Index j = 0; j < mat.outerSize(); j++) {  // col iteration
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it; ++it) {
+      vals.push_back(it.value());
+      row_idxs.push_back(static_cast<c_int>(it.row()));
+    }
+
+    col_idxs.push_back(static_cast<c_int>(vals.size()));
+  }
+
+  CSC_Matrix csc_matrix = {vals, row_idxs, col_idxs};
+
+  return csc_matrix;
+}
+
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat)
+{
+  if (mat.rows() != mat.cols()) {
+    throw std::invalid_argument("Matrix must be square (n, n)");
+  }
+
+  const size_t elem = static_cast<size_t>(mat.nonZeros());
+
+  std::vector<c_float> vals;
+  vals.reserve(elem);
+  std::vector<c_int> row_idxs;
+  row_idxs.reserve(elem);
+  std::vector<c_int> col_idxs;
+  col_idxs.reserve(static_cast<size_t>(mat.cols()) + 1);
+
+  col_idxs.push_back(0);
+
+  for (Eigen::Index j = 0; j < mat.outerSize(); j++) {  // col iteration
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it; ++it) {
+      // row indices are sorted in each column
+      if (it.row() > j) {
+        break;
+      }
+      vals.push_back(it.value());
+      row_idxs.push_back(static_cast<c_int>(it.row()));
+    }
+
+    col_idxs.push_back(static_cast<c_int>(vals.size()));
+  }
+
+  CSC_Matrix csc_matrix = {vals, row_idxs, col_idxs};
+
+  return csc_matrix;
+}
+
 void printCSCMatrix(const CSC_Matrix & csc_mat)
 {
   std::cout << "[";
@@ -356,9 +356,37 @@ int64_t OSQPInterface::initializeProblem(
   m_work.reset(workspace);
   m_work_initialized = true;
 
+  m_P_row_idxs = P_csc.m_row_idxs;
+  m_P_col_idxs = P_csc.m_col_idxs;
+  m_A_row_idxs = A_csc.m_row_idxs;
+  m_A_col_idxs = A_csc.m_col_idxs;
+
   return m_exitflag;
 }
 
+bool OSQPInterface::initializeOrUpdateProblem(
+  const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  // NOTE: a failed solution is not a good initial guess, and the workspace may be broken
+  const bool is_reusable = m_work_initialized && m_exitflag == 0 &&
+                           m_latest_work_info.status_val == OSQP_SOLVED &&
+                           static_cast<int64_t>(q.size()) == m_param_n &&
+                           static_cast<c_int>(l.size()) == m_data->m &&
+                           P.m_row_idxs == m_P_row_idxs && P.m_col_idxs == m_P_col_idxs &&
+                           A.m_row_idxs == m_A_row_idxs && A.m_col_idxs == m_A_col_idxs;
+  if (!is_reusable) {
+    initializeProblem(P, A, q, l, u);
+    return false;
+  }
+
+  updateCscP(P);
+  updateCscA(A);
+  updateQ(q);
+  updateBounds(l, u);
+  return true;
+}
+
 std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t>
 OSQPInterface::solve()
 {
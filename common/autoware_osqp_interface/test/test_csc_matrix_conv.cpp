@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <string>
 #include <tuple>
@@ -164,6 +165,56 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, Sparse)
+{
+  using autoware::osqp_interface::calCSCMatrix;
+  using autoware::osqp_interface::calCSCMatrixTrapezoidal;
+  using autoware::osqp_interface::CSC_Matrix;
+
+  Eigen::MatrixXd dense(3, 3);
+  dense << 1.0, 2.0, 0.0, 4.0, 5.0, 6.0, 0.0, 8.0, 9.0;
+  const Eigen::SparseMatrix<double> sparse = dense.sparseView();
+
+  // same as the dense conversion if there is no explicit zero
+  const CSC_Matrix dense_m = calCSCMatrix(dense);
+  const CSC_Matrix sparse_m = calCSCMatrix(sparse);
+  EXPECT_EQ(sparse_m.m_vals, dense_m.m_vals);
+  EXPECT_EQ(sparse_m.m_row_idxs, dense_m.m_row_idxs);
+  EXPECT_EQ(sparse_m.m_col_idxs, dense_m.m_col_idxs);
+
+  const CSC_Matrix dense_trap_m = calCSCMatrixTrapezoidal(dense);
+  const CSC_Matrix sparse_trap_m = calCSCMatrixTrapezoidal(sparse);
+  EXPECT_EQ(sparse_trap_m.m_vals, dense_trap_m.m_vals);
+  EXPECT_EQ(sparse_trap_m.m_row_idxs, dense_trap_m.m_row_idxs);
+  EXPECT_EQ(sparse_trap_m.m_col_idxs, dense_trap_m.m_col_idxs);
+
+  // explicit zeros are kept
+  std::vector<Eigen::Triplet<double>> triplets{{0, 0, 0.0}, {1, 0, 3.0}, {0, 1, 0.0}};
+  Eigen::SparseMatrix<double> with_zeros(2, 2);
+  with_zeros.setFromTriplets(triplets.begin(), triplets.end());
+
+  const CSC_Matrix with_zeros_m = calCSCMatrix(with_zeros);
+  ASSERT_EQ(with_zeros_m.m_vals.size(), size_t(3));
+  EXPECT_EQ(with_zeros_m.m_vals[0], 0.0);
+  EXPECT_EQ(with_zeros_m.m_vals[1], 3.0);
+  EXPECT_EQ(with_zeros_m.m_vals[2], 0.0);
+  ASSERT_EQ(with_zeros_m.m_row_idxs.size(), size_t(3));
+  EXPECT_EQ(with_zeros_m.m_row_idxs[0], c_int(0));
+  EXPECT_EQ(with_zeros_m.m_row_idxs[1], c_int(1));
+  EXPECT_EQ(with_zeros_m.m_row_idxs[2], c_int(0));
+  ASSERT_EQ(with_zeros_m.m_col_idxs.size(), size_t(3));
+  EXPECT_EQ(with_zeros_m.m_col_idxs[0], c_int(0));
+  EXPECT_EQ(with_zeros_m.m_col_idxs[1], c_int(2));
+  EXPECT_EQ(with_zeros_m.m_col_idxs[2], c_int(3));
+
+  // the lower triangle is skipped
+  const CSC_Matrix with_zeros_trap_m = calCSCMatrixTrapezoidal(with_zeros);
+  ASSERT_EQ(with_zeros_trap_m.m_vals.size(), size_t(2));
+  EXPECT_EQ(with_zeros_trap_m.m_row_idxs[0], c_int(0));
+  EXPECT_EQ(with_zeros_trap_m.m_row_idxs[1], c_int(0));
+  EXPECT_EQ(with_zeros_trap_m.m_col_idxs[2], c_int(2));
+}
+
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::osqp_interface::calCSCMatrix;
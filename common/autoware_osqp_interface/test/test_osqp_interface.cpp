@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <iostream>
 #include <tuple>
@@ -160,5 +161,33 @@ TEST(TestOsqpInterface, BasicQp)
     check_result(result);
     EXPECT_EQ(osqp.getTakenIter(), 1);
   }
+
+  // reuse workspace
+  {
+    std::tuple<std::vector<double>, std::vector<double>, int, int, int> result;
+    const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+    const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+    CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P_sparse);
+    CSC_Matrix A_csc = calCSCMatrix(A_sparse);
+    autoware::osqp_interface::OSQPInterface osqp;
+
+    // the workspace is set up at first
+    EXPECT_FALSE(osqp.initializeOrUpdateProblem(P_csc, A_csc, q, l, u));
+    result = osqp.optimize();
+    check_result(result);
+
+    // the workspace is reused for the same sparsity pattern
+    EXPECT_TRUE(osqp.initializeOrUpdateProblem(P_csc, A_csc, q, l, u));
+    result = osqp.optimize();
+    check_result(result);
+
+    // the workspace is set up again for a different sparsity pattern
+    CSC_Matrix P_diag_csc = calCSCMatrixTrapezoidal(
+      Eigen::SparseMatrix<double>((Eigen::MatrixXd(2, 2) << 4, 0, 0, 2).finished().sparseView()));
+    EXPECT_FALSE(osqp.initializeOrUpdateProblem(P_diag_csc, A_csc, q, l, u));
+    EXPECT_FALSE(osqp.initializeOrUpdateProblem(P_csc, A_csc, q, l, u));
+    result = osqp.optimize();
+    check_result(result);
+  }
 }
 }  // namespace
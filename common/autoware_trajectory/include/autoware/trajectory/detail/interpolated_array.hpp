@@ -40,7 +40,7 @@ class InterpolatedArray
   using InterpolatorType = interpolator::InterpolatorInterface<T>;
 
 private:
-  std::vector<double> bases_;
+  std::shared_ptr<const std::vector<double>> bases_;  //!< bases, shared until the range is set
   std::vector<T> values_;
   std::shared_ptr<interpolator::InterpolatorInterface<T>> interpolator_;
 
@@ -66,6 +66,18 @@ public:
   InterpolatedArray(InterpolatedArray && other) = default;
 
   bool build(const std::vector<double> & bases, const std::vector<T> & values)
+  {
+    return build(std::make_shared<const std::vector<double>>(bases), values);
+  }
+
+  /**
+   * @brief Build the array with the bases shared with the trajectory.
+   * @param bases The shared bases.
+   * @param values The values.
+   * @return True if the interpolator was built successfully.
+   */
+  bool build(
+    const std::shared_ptr<const std::vector<double>> & bases, const std::vector<T> & values)
   {
     bases_ = bases;
     values_ = values;
@@ -98,13 +110,30 @@ public:
    * @brief Get the start value of the base.
    * @return The start value.
    */
-  [[nodiscard]] double start() const { return bases_.front(); }
+  [[nodiscard]] double start() const { return bases_->front(); }
 
   /**
    * @brief Get the end value of the base.
    * @return The end value.
    */
-  [[nodiscard]] double end() const { return bases_.at(bases_.size() - 1); }
+  [[nodiscard]] double end() const { return bases_->at(bases_->size() - 1); }
+
+  /**
+   * @brief Get the bases of the array.
+   * @return The bases.
+   */
+  [[nodiscard]] const std::vector<double> & bases() const { return *bases_; }
+
+  /**
+   * @brief Check if the bases are shared with the given bases, i.e. no range has been set.
+   * @param bases The bases to compare with.
+   * @return True if the bases are the same object.
+   */
+  [[nodiscard]] bool shares_bases_with(
+    const std::shared_ptr<const std::vector<double>> & bases) const
+  {
+    return bases_ == bases;
+  }
 
   class Segment
   {
@@ -121,7 +150,8 @@ public:
   public:
     void set(const T & value)
     {
-      std::vector<double> & bases = parent_.bases_;
+      // NOTE: the bases are copied on write since they may be shared with the trajectory
+      std::vector<double> bases = *parent_.bases_;
       std::vector<T> & values = parent_.values_;
 
       auto insert_if_not_present = [&](double val) -> size_t {
@@ -152,7 +182,8 @@ public:
       // Set the values in the specified range
       std::fill(values.begin() + start_index, values.begin() + end_index + 1, value);
 
-      parent_.interpolator_->build(bases, values);
+      parent_.bases_ = std::make_shared<const std::vector<double>>(std::move(bases));
+      parent_.interpolator_->build(parent_.bases_, values);
 
       // return *this;
     }
@@ -196,13 +227,23 @@ public:
    */
   [[nodiscard]] T compute(const double & x) const { return interpolator_->compute(x); }
 
+  /**
+   * @brief Compute the interpolated values at multiple positions in a single pass.
+   * @param x The positions to compute the values at.
+   * @return The interpolated values.
+   */
+  [[nodiscard]] std::vector<T> compute(const std::vector<double> & x) const
+  {
+    return interpolator_->compute(x);
+  }
+
   /**
    * @brief Get the underlying data of the array.
    * @return A pair containing the axis and values.
    */
   [[nodiscard]] std::pair<std::vector<double>, std::vector<T>> get_data() const
   {
-    return {bases_, values_};
+    return {*bases_, values_};
   }
 };
 
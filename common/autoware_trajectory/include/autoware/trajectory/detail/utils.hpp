@@ -24,7 +24,7 @@
 #include <geometry_msgs/msg/pose.hpp>
 #include <tier4_planning_msgs/msg/path_point_with_lane_id.hpp>
 
-#include <set>
+#include <algorithm>
 #include <vector>
 
 namespace autoware::trajectory::detail
@@ -51,18 +51,16 @@ geometry_msgs::msg::Point to_point(const lanelet::ConstPoint3d & p);
 template <typename... Vectors>
 std::vector<double> merge_vectors(const Vectors &... vectors)
 {
-  std::set<double> unique_elements;
+  std::vector<double> merged;
+  merged.reserve((vectors.size() + ...));
 
-  // Helper function to insert elements into the set
-  auto insert_elements = [&unique_elements](const auto & vec) {
-    unique_elements.insert(vec.begin(), vec.end());
-  };
+  // Expand the parameter pack and append elements from each vector
+  (merged.insert(merged.end(), vectors.begin(), vectors.end()), ...);
 
-  // Expand the parameter pack and insert elements from each vector
-  (insert_elements(vectors), ...);
-
-  // Convert the set to std::vector<double>
-  return {unique_elements.begin(), unique_elements.end()};
+  // Sort and remove duplicates in place instead of building a node based set
+  std::sort(merged.begin(), merged.end());
+  merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+  return merged;
 }
 
 std::vector<double> fill_bases(const std::vector<double> & x, const size_t & min_points);
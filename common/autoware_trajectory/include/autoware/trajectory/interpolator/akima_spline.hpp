@@ -16,9 +16,11 @@
 #define AUTOWARE__TRAJECTORY__INTERPOLATOR__AKIMA_SPLINE_HPP_
 
 #include "autoware/trajectory/interpolator/detail/interpolator_mixin.hpp"
+#include "autoware/trajectory/interpolator/detail/lazy_parameters.hpp"
 
 #include <Eigen/Dense>
 
+#include <memory>
 #include <vector>
 
 namespace autoware::trajectory::interpolator
@@ -28,11 +30,17 @@ namespace autoware::trajectory::interpolator
  * @brief Class for Akima spline interpolation.
  *
  * This class provides methods to perform Akima spline interpolation on a set of data points.
+ * The coefficients are solved on the first query and shared by the copies of the interpolator.
  */
 class AkimaSpline : public detail::InterpolatorMixin<AkimaSpline, double>
 {
 private:
-  Eigen::VectorXd a_, b_, c_, d_;  ///< Coefficients for the Akima spline.
+  struct Parameters
+  {
+    Eigen::VectorXd a, b, c, d;  ///< Coefficients for the Akima spline.
+  };
+
+  std::shared_ptr<const detail::LazyParameters<Parameters>> parameters_;
 
   /**
    * @brief Compute the spline parameters.
@@ -41,8 +49,9 @@ private:
    *
    * @param bases The bases values.
    * @param values The values to interpolate.
+   * @return The coefficients.
    */
-  void compute_parameters(
+  static Parameters compute_parameters(
     const Eigen::Ref<const Eigen::VectorXd> & bases,
     const Eigen::Ref<const Eigen::VectorXd> & values);
 
@@ -62,6 +71,15 @@ private:
    */
   [[nodiscard]] double compute_impl(const double & s) const override;
 
+  /**
+   * @brief Compute the interpolated values at the given points.
+   *
+   * @param s The points at which to compute the interpolated values.
+   * @return The interpolated values.
+   */
+  [[nodiscard]] std::vector<double> compute_batch_impl(
+    const std::vector<double> & s) const override;
+
   /**
    * @brief Compute the first derivative at the given point.
    *
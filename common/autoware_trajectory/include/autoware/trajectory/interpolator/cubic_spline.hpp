@@ -16,9 +16,11 @@
 #define AUTOWARE__TRAJECTORY__INTERPOLATOR__CUBIC_SPLINE_HPP_
 
 #include "autoware/trajectory/interpolator/detail/interpolator_mixin.hpp"
+#include "autoware/trajectory/interpolator/detail/lazy_parameters.hpp"
 
 #include <Eigen/Dense>
 
+#include <memory>
 #include <vector>
 
 namespace autoware::trajectory::interpolator
@@ -28,12 +30,17 @@ namespace autoware::trajectory::interpolator
  * @brief Class for cubic spline interpolation.
  *
  * This class provides methods to perform cubic spline interpolation on a set of data points.
+ * The coefficients are solved on the first query and shared by the copies of the interpolator.
  */
 class CubicSpline : public detail::InterpolatorMixin<CubicSpline, double>
 {
 private:
-  Eigen::VectorXd a_, b_, c_, d_;  ///< Coefficients for the cubic spline.
-  Eigen::VectorXd h_;              ///< Interval sizes between bases points.
+  struct Parameters
+  {
+    Eigen::VectorXd a, b, c, d;  ///< Coefficients for the cubic spline.
+  };
+
+  std::shared_ptr<const detail::LazyParameters<Parameters>> parameters_;
 
   /**
    * @brief Compute the spline parameters.
@@ -42,8 +49,9 @@ private:
    *
    * @param bases The bases values.
    * @param values The values to interpolate.
+   * @return The coefficients.
    */
-  void compute_parameters(
+  static Parameters compute_parameters(
     const Eigen::Ref<const Eigen::VectorXd> & bases,
     const Eigen::Ref<const Eigen::VectorXd> & values);
 
@@ -64,6 +72,15 @@ private:
    */
   [[nodiscard]] double compute_impl(const double & s) const override;
 
+  /**
+   * @brief Compute the interpolated values at the given points.
+   *
+   * @param s The points at which to compute the interpolated values.
+   * @return The interpolated values.
+   */
+  [[nodiscard]] std::vector<double> compute_batch_impl(
+    const std::vector<double> & s) const override;
+
   /**
    * @brief Compute the first derivative at the given point.
    *
@@ -18,6 +18,8 @@
 #include <Eigen/Dense>
 #include <rclcpp/logging.hpp>
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 namespace autoware::trajectory::interpolator::detail
@@ -34,17 +36,23 @@ template <typename T>
 class InterpolatorCommonInterface
 {
 protected:
-  std::vector<double> bases_;  ///< bases values for the interpolation.
+  std::shared_ptr<const std::vector<double>>
+    bases_;  ///< bases values for the interpolation, which can be shared with other interpolators.
+
+  /**
+   * @brief Get the bases values for the interpolation.
+   */
+  [[nodiscard]] const std::vector<double> & bases() const { return *bases_; }
 
   /**
    * @brief Get the start of the interpolation range.
    */
-  [[nodiscard]] double start() const { return bases_.front(); }
+  [[nodiscard]] double start() const { return bases_->front(); }
 
   /**
    * @brief Get the end of the interpolation range.
    */
-  [[nodiscard]] double end() const { return bases_.back(); }
+  [[nodiscard]] double end() const { return bases_->back(); }
 
   /**
    * @brief Compute the interpolated value at the given point.
@@ -56,6 +64,25 @@ protected:
    */
   [[nodiscard]] virtual T compute_impl(const double & s) const = 0;
 
+  /**
+   * @brief Compute the interpolated values at the given points.
+   *
+   * This method can be overridden by subclasses to evaluate the points in a single pass. The
+   * default implementation calls compute_impl for each point.
+   *
+   * @param s The points at which to compute the interpolated values.
+   * @return The interpolated values.
+   */
+  [[nodiscard]] virtual std::vector<T> compute_batch_impl(const std::vector<double> & s) const
+  {
+    std::vector<T> result;
+    result.reserve(s.size());
+    for (const auto & s_i : s) {
+      result.push_back(compute_impl(s_i));
+    }
+    return result;
+  }
+
   /**
    * @brief Build the interpolator with the given values.
    *
@@ -84,6 +111,28 @@ protected:
     return std::clamp(s, start(), end());
   }
 
+  /**
+   * @brief Validate the inputs to the batched compute method.
+   *
+   * @param s The input values.
+   * @return The input values, clamped to the range of the interpolator.
+   */
+  [[nodiscard]] std::vector<double> validate_compute_input(const std::vector<double> & s) const
+  {
+    std::vector<double> clamped_s(s.size());
+    bool is_out_of_range = false;
+    for (size_t i = 0; i < s.size(); ++i) {
+      is_out_of_range |= s[i] < start() || s[i] > end();
+      clamped_s[i] = std::clamp(s[i], start(), end());
+    }
+    if (is_out_of_range) {
+      RCLCPP_WARN(
+        rclcpp::get_logger("Interpolator"),
+        "Input values are outside the range of the interpolator [%f, %f].", start(), end());
+    }
+    return clamped_s;
+  }
+
   /**
    * @brief Get the index of the interval containing the input value.
    *
@@ -102,13 +151,51 @@ protected:
   [[nodiscard]] int32_t get_index(const double & s, bool end_inclusive = true) const
   {
     if (end_inclusive && s == end()) {
-      return static_cast<int32_t>(bases_.size()) - 2;
+      return static_cast<int32_t>(bases_->size()) - 2;
     }
     auto comp = [](const double & a, const double & b) { return a <= b; };
-    return std::distance(bases_.begin(), std::lower_bound(bases_.begin(), bases_.end(), s, comp)) -
+    return std::distance(
+             bases_->begin(), std::lower_bound(bases_->begin(), bases_->end(), s, comp)) -
            1;
   }
 
+  /**
+   * @brief Get the indices of the intervals containing the input values.
+   *
+   * Same as calling get_index for each value. If the values are sorted in ascending order, the
+   * intervals are found by a cursor moving forward instead of a binary search per value.
+   *
+   * @param s The input values, which must be within the range of the bases array.
+   * @param end_inclusive Whether to include the end value in the last interval. Defaults to true.
+   * @return The indices of the intervals containing the input values.
+   */
+  [[nodiscard]] std::vector<int32_t> get_indices(
+    const std::vector<double> & s, bool end_inclusive = true) const
+  {
+    std::vector<int32_t> indices(s.size());
+    if (!std::is_sorted(s.begin(), s.end())) {
+      for (size_t i = 0; i < s.size(); ++i) {
+        indices[i] = get_index(s[i], end_inclusive);
+      }
+      return indices;
+    }
+
+    const auto & bases = *bases_;
+    const auto last = static_cast<int32_t>(bases.size()) - 1;
+    int32_t idx = 0;
+    for (size_t i = 0; i < s.size(); ++i) {
+      if (end_inclusive && s[i] == end()) {
+        indices[i] = last - 1;
+        continue;
+      }
+      while (idx < last && bases[idx + 1] <= s[i]) {
+        ++idx;
+      }
+      indices[i] = idx;
+    }
+    return indices;
+  }
+
 public:
   InterpolatorCommonInterface() = default;
   virtual ~InterpolatorCommonInterface() = default;
@@ -126,13 +213,30 @@ public:
    */
   bool build(const std::vector<double> & bases, const std::vector<T> & values)
   {
-    if (bases.size() != values.size()) {
+    return build(std::make_shared<const std::vector<double>>(bases), values);
+  }
+
+  /**
+   * @brief Build the interpolator with the bases shared with other interpolators.
+   *
+   * The bases are referenced, not copied, so the interpolators of the same trajectory hold a
+   * single bases array.
+   *
+   * @param bases The shared bases values.
+   * @param values The values to interpolate.
+   * @return True if the interpolator was built successfully, false otherwise.
+   */
+  bool build(
+    const std::shared_ptr<const std::vector<double>> & bases, const std::vector<T> & values)
+  {
+    if (!bases || bases->size() != values.size()) {
       return false;
     }
-    if (bases.size() < minimum_required_points()) {
+    if (bases->size() < minimum_required_points()) {
       return false;
     }
-    build_impl(bases, values);
+    bases_ = bases;
+    build_impl(*bases_, values);
     return true;
   }
 
@@ -156,6 +260,21 @@ public:
     double clamped_s = validate_compute_input(s);
     return compute_impl(clamped_s);
   }
+
+  /**
+   * @brief Compute the interpolated values at the given points.
+   *
+   * The points sorted in ascending order, e.g. the bases of a trajectory, are evaluated in a single
+   * pass.
+   *
+   * @param s The points at which to compute the interpolated values.
+   * @return The interpolated values.
+   */
+  [[nodiscard]] std::vector<T> compute(const std::vector<double> & s) const
+  {
+    const std::vector<double> clamped_s = validate_compute_input(s);
+    return compute_batch_impl(clamped_s);
+  }
 };
 }  // namespace autoware::trajectory::interpolator::detail
 
@@ -0,0 +1,66 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__TRAJECTORY__INTERPOLATOR__DETAIL__LAZY_PARAMETERS_HPP_
+#define AUTOWARE__TRAJECTORY__INTERPOLATOR__DETAIL__LAZY_PARAMETERS_HPP_
+
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace autoware::trajectory::interpolator::detail
+{
+
+/**
+ * @brief Parameters of an interpolator which are solved on the first query.
+ *
+ * The parameters are solved at most once even if they are queried from multiple threads. An
+ * interpolator holds them by a shared pointer, so that its copies share the solved parameters.
+ *
+ * @tparam ParametersType The type of the parameters.
+ */
+template <typename ParametersType>
+class LazyParameters
+{
+public:
+  /**
+   * @brief Construct the parameters with the function solving them.
+   *
+   * @param solver The function solving the parameters. It is released once called.
+   */
+  explicit LazyParameters(std::function<ParametersType()> solver) : solver_(std::move(solver)) {}
+
+  /**
+   * @brief Get the parameters, solving them on the first call.
+   *
+   * @return The parameters.
+   */
+  [[nodiscard]] const ParametersType & get() const
+  {
+    std::call_once(flag_, [this]() {
+      parameters_ = solver_();
+      solver_ = nullptr;
+    });
+    return parameters_;
+  }
+
+private:
+  mutable std::once_flag flag_;
+  mutable std::function<ParametersType()> solver_;
+  mutable ParametersType parameters_;
+};
+
+}  // namespace autoware::trajectory::interpolator::detail
+
+#endif  // AUTOWARE__TRAJECTORY__INTERPOLATOR__DETAIL__LAZY_PARAMETERS_HPP_
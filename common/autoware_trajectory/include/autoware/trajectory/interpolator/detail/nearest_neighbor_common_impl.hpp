@@ -49,7 +49,7 @@ protected:
   [[nodiscard]] T compute_impl(const double & s) const override
   {
     const int32_t idx = this->get_index(s);
-    return (std::abs(s - this->bases_[idx]) <= std::abs(s - this->bases_[idx + 1]))
+    return (std::abs(s - this->bases()[idx]) <= std::abs(s - this->bases()[idx + 1]))
              ? this->values_.at(idx)
              : this->values_.at(idx + 1);
   }
@@ -61,9 +61,8 @@ protected:
    * @param values The values to interpolate.
    * @return True if the interpolator was built successfully, false otherwise.
    */
-  void build_impl(const std::vector<double> & bases, const std::vector<T> & values) override
+  void build_impl(const std::vector<double> &, const std::vector<T> & values) override
   {
-    this->bases_ = bases;
     this->values_ = values;
   }
 
@@ -52,15 +52,31 @@ protected:
     const int32_t idx = this->get_index(s, false);
     return this->values_.at(idx);
   }
+
+  /**
+   * @brief Compute the interpolated values at the given points.
+   *
+   * @param s The points at which to compute the interpolated values.
+   * @return The interpolated values.
+   */
+  [[nodiscard]] std::vector<T> compute_batch_impl(const std::vector<double> & s) const override
+  {
+    const std::vector<int32_t> indices = this->get_indices(s, false);
+    std::vector<T> result;
+    result.reserve(s.size());
+    for (const auto idx : indices) {
+      result.push_back(this->values_.at(idx));
+    }
+    return result;
+  }
   /**
    * @brief Build the interpolator with the given values.
    *
    * @param bases The bases values.
    * @param values The values to interpolate.
    */
-  void build_impl(const std::vector<double> & bases, const std::vector<T> & values) override
+  void build_impl(const std::vector<double> &, const std::vector<T> & values) override
   {
-    this->bases_ = bases;
     this->values_ = values;
   }
 
@@ -51,6 +51,15 @@ private:
    */
   [[nodiscard]] double compute_impl(const double & s) const override;
 
+  /**
+   * @brief Compute the interpolated values at the given points.
+   *
+   * @param s The points at which to compute the interpolated values.
+   * @return The interpolated values.
+   */
+  [[nodiscard]] std::vector<double> compute_batch_impl(
+    const std::vector<double> & s) const override;
+
   /**
    * @brief Compute the first derivative at the given point.
    *
@@ -32,6 +32,14 @@ class Trajectory<autoware_planning_msgs::msg::PathPoint>
   using BaseClass = Trajectory<geometry_msgs::msg::Pose>;
   using PointType = autoware_planning_msgs::msg::PathPoint;
 
+protected:
+  /**
+   * @brief Compute the points at the given bases in a single pass
+   * @param bases Bases in the range of the trajectory, i.e. already clamped
+   * @return Points on the trajectory
+   */
+  [[nodiscard]] std::vector<PointType> evaluate(const std::vector<double> & bases) const;
+
 public:
   detail::InterpolatedArray<double> longitudinal_velocity_mps{
     nullptr};  //!< Longitudinal velocity in m/s
@@ -52,6 +60,13 @@ public:
    */
   [[nodiscard]] PointType compute(double s) const;
 
+  /**
+   * @brief Compute the points on the trajectory at given s values
+   * @param s Arc lengths, which are evaluated in a single pass if sorted in ascending order
+   * @return Points on the trajectory
+   */
+  [[nodiscard]] std::vector<PointType> compute(const std::vector<double> & s) const;
+
   /**
    * @brief Restore the trajectory points
    * @param min_points Minimum number of points
@@ -34,6 +34,14 @@ class Trajectory<tier4_planning_msgs::msg::PathPointWithLaneId>
   using PointType = tier4_planning_msgs::msg::PathPointWithLaneId;
   using LaneIdType = std::vector<int64_t>;
 
+protected:
+  /**
+   * @brief Compute the points at the given bases in a single pass
+   * @param bases Bases in the range of the trajectory, i.e. already clamped
+   * @return Points on the trajectory
+   */
+  [[nodiscard]] std::vector<PointType> evaluate(const std::vector<double> & bases) const;
+
 public:
   detail::InterpolatedArray<LaneIdType> lane_ids{nullptr};  //!< Lane ID
 
@@ -51,6 +59,13 @@ public:
    */
   [[nodiscard]] PointType compute(double s) const;
 
+  /**
+   * @brief Compute the points on the trajectory at given s values
+   * @param s Arc lengths, which are evaluated in a single pass if sorted in ascending order
+   * @return Points on the trajectory
+   */
+  [[nodiscard]] std::vector<PointType> compute(const std::vector<double> & s) const;
+
   /**
    * @brief Restore the trajectory points
    * @param min_points Minimum number of points
@@ -54,7 +54,8 @@ protected:
   std::shared_ptr<interpolator::InterpolatorInterface<double>>
     z_interpolator_;  //!< Interpolator for z
 
-  std::vector<double> bases_;  //!< Axis of the trajectory
+  std::shared_ptr<const std::vector<double>>
+    bases_;  //!< Axis of the trajectory, shared with the interpolators
 
   double start_{0.0}, end_{0.0};  //!< Start and end of the arc length of the trajectory
 
@@ -66,6 +67,13 @@ protected:
    */
   [[nodiscard]] double clamp(const double & s, bool show_warning = false) const;
 
+  /**
+   * @brief Compute the points at the given bases in a single pass
+   * @param bases Bases in the range of the trajectory, i.e. already clamped
+   * @return Points on the trajectory
+   */
+  [[nodiscard]] std::vector<PointType> evaluate(const std::vector<double> & bases) const;
+
 public:
   /**
    * @brief Get the length of the trajectory
@@ -80,6 +88,13 @@ public:
    */
   [[nodiscard]] PointType compute(double s) const;
 
+  /**
+   * @brief Compute the points on the trajectory at given s values
+   * @param s Arc lengths, which are evaluated in a single pass if sorted in ascending order
+   * @return Points on the trajectory
+   */
+  [[nodiscard]] std::vector<PointType> compute(const std::vector<double> & s) const;
+
   /**
    * @brief Build the trajectory from the points
    * @param points Vector of points
@@ -124,13 +139,15 @@ public:
     std::vector<double> distances_from_segments;
     std::vector<double> lengths_from_start_points;
 
-    auto axis = detail::crop_bases(bases_, start_, end_);
+    auto axis = detail::crop_bases(*bases_, start_, end_);
+    const auto xs = x_interpolator_->compute(axis);
+    const auto ys = y_interpolator_->compute(axis);
 
     for (size_t i = 1; i < axis.size(); ++i) {
       Eigen::Vector2d p0;
       Eigen::Vector2d p1;
-      p0 << x_interpolator_->compute(axis.at(i - 1)), y_interpolator_->compute(axis.at(i - 1));
-      p1 << x_interpolator_->compute(axis.at(i)), y_interpolator_->compute(axis.at(i));
+      p0 << xs.at(i - 1), ys.at(i - 1);
+      p1 << xs.at(i), ys.at(i);
       Eigen::Vector2d v = p1 - p0;
       Eigen::Vector2d w = point - p0;
       double c1 = w.dot(v);
@@ -192,13 +209,15 @@ public:
     Eigen::Vector2d line_end(to_point(end).x, to_point(end).y);
     Eigen::Vector2d line_dir = line_end - line_start;
 
-    auto axis = detail::crop_bases(bases_, start_, end_);
+    auto axis = detail::crop_bases(*bases_, start_, end_);
+    const auto xs = x_interpolator_->compute(axis);
+    const auto ys = y_interpolator_->compute(axis);
 
     for (size_t i = 1; i < axis.size(); ++i) {
       Eigen::Vector2d p0;
       Eigen::Vector2d p1;
-      p0 << x_interpolator_->compute(axis.at(i - 1)), y_interpolator_->compute(axis.at(i - 1));
-      p1 << x_interpolator_->compute(axis.at(i)), y_interpolator_->compute(axis.at(i));
+      p0 << xs.at(i - 1), ys.at(i - 1);
+      p1 << xs.at(i), ys.at(i);
 
       Eigen::Vector2d segment_dir = p1 - p0;
 
@@ -246,6 +265,12 @@ public:
    */
   [[nodiscard]] std::vector<PointType> restore(const size_t & min_points = 4) const;
 
+  /**
+   * @brief Crop the trajectory in O(1) by narrowing its range, the bases and the interpolators are
+   * kept as they are
+   * @param start Start of the new range relative to the current start
+   * @param length Length of the new range
+   */
   void crop(const double & start, const double & length);
 
   class Builder
@@ -42,6 +42,13 @@ protected:
   std::shared_ptr<interpolator::InterpolatorInterface<geometry_msgs::msg::Quaternion>>
     orientation_interpolator_;  //!< Interpolator for orientations
 
+  /**
+   * @brief Compute the poses at the given bases in a single pass
+   * @param bases Bases in the range of the trajectory, i.e. already clamped
+   * @return Poses on the trajectory
+   */
+  [[nodiscard]] std::vector<PointType> evaluate(const std::vector<double> & bases) const;
+
 public:
   bool build(const std::vector<PointType> & points);
 
@@ -52,6 +59,13 @@ public:
    */
   [[nodiscard]] PointType compute(double s) const;
 
+  /**
+   * @brief Compute the poses on the trajectory at given s values
+   * @param s Arc lengths, which are evaluated in a single pass if sorted in ascending order
+   * @return Poses on the trajectory
+   */
+  [[nodiscard]] std::vector<PointType> compute(const std::vector<double> & s) const;
+
   /**
    * @brief Restore the trajectory poses
    * @return Vector of poses
@@ -17,16 +17,20 @@
 #include <Eigen/Dense>
 
 #include <cmath>
+#include <memory>
 #include <vector>
 
 namespace autoware::trajectory::interpolator
 {
 
-void AkimaSpline::compute_parameters(
+AkimaSpline::Parameters AkimaSpline::compute_parameters(
   const Eigen::Ref<const Eigen::VectorXd> & bases, const Eigen::Ref<const Eigen::VectorXd> & values)
 {
   const auto n = static_cast<int32_t>(bases.size());
 
+  Parameters parameters;
+  auto & [a, b, c, d] = parameters;
+
   Eigen::VectorXd h = bases.tail(n - 1) - bases.head(n - 1);
 
   Eigen::VectorXd m(n - 1);
@@ -48,45 +52,72 @@ void AkimaSpline::compute_parameters(
   s[n - 2] = (m[n - 2] + m[n - 3]) / 2;
   s[n - 1] = m[n - 2];
 
-  a_.resize(n - 1);
-  b_.resize(n - 1);
-  c_.resize(n - 1);
-  d_.resize(n - 1);
+  a.resize(n - 1);
+  b.resize(n - 1);
+  c.resize(n - 1);
+  d.resize(n - 1);
   for (int32_t i = 0; i < n - 1; ++i) {
-    a_[i] = values[i];
-    b_[i] = s[i];
-    c_[i] = (3 * m[i] - 2 * s[i] - s[i + 1]) / h[i];
-    d_[i] = (s[i] + s[i + 1] - 2 * m[i]) / (h[i] * h[i]);
+    a[i] = values[i];
+    b[i] = s[i];
+    c[i] = (3 * m[i] - 2 * s[i] - s[i + 1]) / h[i];
+    d[i] = (s[i] + s[i + 1] - 2 * m[i]) / (h[i] * h[i]);
   }
+  return parameters;
 }
 
-void AkimaSpline::build_impl(const std::vector<double> & bases, const std::vector<double> & values)
+void AkimaSpline::build_impl(const std::vector<double> &, const std::vector<double> & values)
 {
-  this->bases_ = bases;
-  compute_parameters(
-    Eigen::Map<const Eigen::VectorXd>(bases.data(), static_cast<Eigen::Index>(bases.size())),
-    Eigen::Map<const Eigen::VectorXd>(values.data(), static_cast<Eigen::Index>(values.size())));
+  // NOTE: the bases are shared with the interpolator, only the values are copied until the first
+  // query solves the coefficients
+  Eigen::VectorXd values_vector =
+    Eigen::Map<const Eigen::VectorXd>(values.data(), static_cast<Eigen::Index>(values.size()));
+  parameters_ = std::make_shared<const detail::LazyParameters<Parameters>>(
+    [bases_ptr = this->bases_, values_vector = std::move(values_vector)]() {
+      return compute_parameters(
+        Eigen::Map<const Eigen::VectorXd>(
+          bases_ptr->data(), static_cast<Eigen::Index>(bases_ptr->size())),
+        values_vector);
+    });
 }
 
 double AkimaSpline::compute_impl(const double & s) const
 {
+  const auto & [a, b, c, d] = parameters_->get();
   const int32_t i = this->get_index(s);
-  const double dx = s - this->bases_[i];
-  return a_[i] + b_[i] * dx + c_[i] * dx * dx + d_[i] * dx * dx * dx;
+  const double dx = s - this->bases()[i];
+  return a[i] + b[i] * dx + c[i] * dx * dx + d[i] * dx * dx * dx;
+}
+
+std::vector<double> AkimaSpline::compute_batch_impl(const std::vector<double> & s) const
+{
+  const auto & [a, b, c, d] = parameters_->get();
+  const std::vector<int32_t> indices = this->get_indices(s);
+  const double * bases = this->bases().data();
+
+  // NOTE: the loop has no branch so that it can be vectorized
+  std::vector<double> result(s.size());
+  for (size_t k = 0; k < s.size(); ++k) {
+    const int32_t i = indices[k];
+    const double dx = s[k] - bases[i];
+    result[k] = a[i] + b[i] * dx + c[i] * dx * dx + d[i] * dx * dx * dx;
+  }
+  return result;
 }
 
 double AkimaSpline::compute_first_derivative_impl(const double & s) const
 {
+  const auto & parameters = parameters_->get();
   const int32_t i = this->get_index(s);
-  const double dx = s - this->bases_[i];
-  return b_[i] + 2 * c_[i] * dx + 3 * d_[i] * dx * dx;
+  const double dx = s - this->bases()[i];
+  return parameters.b[i] + 2 * parameters.c[i] * dx + 3 * parameters.d[i] * dx * dx;
 }
 
 double AkimaSpline::compute_second_derivative_impl(const double & s) const
 {
+  const auto & parameters = parameters_->get();
   const int32_t i = this->get_index(s);
-  const double dx = s - this->bases_[i];
-  return 2 * c_[i] + 6 * d_[i] * dx;
+  const double dx = s - this->bases()[i];
+  return 2 * parameters.c[i] + 6 * parameters.d[i] * dx;
 }
 
 }  // namespace autoware::trajectory::interpolator
@@ -16,24 +16,30 @@
 
 #include <Eigen/Dense>
 
+#include <memory>
+#include <vector>
+
 namespace autoware::trajectory::interpolator
 {
 
-void CubicSpline::compute_parameters(
+CubicSpline::Parameters CubicSpline::compute_parameters(
   const Eigen::Ref<const Eigen::VectorXd> & bases, const Eigen::Ref<const Eigen::VectorXd> & values)
 {
   const int32_t n = static_cast<int32_t>(bases.size()) - 1;
 
-  h_ = bases.tail(n) - bases.head(n);
-  a_ = values.transpose();
+  Parameters parameters;
+  auto & [a, b, c, d] = parameters;
+
+  Eigen::VectorXd h = bases.tail(n) - bases.head(n);
+  a = values.transpose();
 
   for (int32_t i = 0; i < n; ++i) {
-    h_(i) = bases(i + 1) - bases(i);
+    h(i) = bases(i + 1) - bases(i);
   }
 
   Eigen::VectorXd alpha(n - 1);
   for (int32_t i = 1; i < n; ++i) {
-    alpha(i - 1) = (3.0 / h_(i)) * (a_(i + 1) - a_(i)) - (3.0 / h_(i - 1)) * (a_(i) - a_(i - 1));
+    alpha(i - 1) = (3.0 / h(i)) * (a(i + 1) - a(i)) - (3.0 / h(i - 1)) * (a(i) - a(i - 1));
   }
 
   Eigen::VectorXd l(n + 1);
@@ -43,51 +49,78 @@ void CubicSpline::compute_parameters(
   mu(0) = z(0) = 0.0;
 
   for (int32_t i = 1; i < n; ++i) {
-    l(i) = 2.0 * (bases(i + 1) - bases(i - 1)) - h_(i - 1) * mu(i - 1);
-    mu(i) = h_(i) / l(i);
-    z(i) = (alpha(i - 1) - h_(i - 1) * z(i - 1)) / l(i);
+    l(i) = 2.0 * (bases(i + 1) - bases(i - 1)) - h(i - 1) * mu(i - 1);
+    mu(i) = h(i) / l(i);
+    z(i) = (alpha(i - 1) - h(i - 1) * z(i - 1)) / l(i);
   }
-  b_.resize(n);
-  d_.resize(n);
-  c_.resize(n + 1);
+  b.resize(n);
+  d.resize(n);
+  c.resize(n + 1);
 
   l(n) = 1.0;
-  z(n) = c_(n) = 0.0;
+  z(n) = c(n) = 0.0;
 
   for (int32_t j = n - 1; j >= 0; --j) {
-    c_(j) = z(j) - mu(j) * c_(j + 1);
-    b_(j) = (a_(j + 1) - a_(j)) / h_(j) - h_(j) * (c_(j + 1) + 2.0 * c_(j)) / 3.0;
-    d_(j) = (c_(j + 1) - c_(j)) / (3.0 * h_(j));
+    c(j) = z(j) - mu(j) * c(j + 1);
+    b(j) = (a(j + 1) - a(j)) / h(j) - h(j) * (c(j + 1) + 2.0 * c(j)) / 3.0;
+    d(j) = (c(j + 1) - c(j)) / (3.0 * h(j));
   }
+  return parameters;
 }
 
-void CubicSpline::build_impl(const std::vector<double> & bases, const std::vector<double> & values)
+void CubicSpline::build_impl(const std::vector<double> &, const std::vector<double> & values)
 {
-  this->bases_ = bases;
-  compute_parameters(
-    Eigen::Map<const Eigen::VectorXd>(bases.data(), static_cast<Eigen::Index>(bases.size())),
-    Eigen::Map<const Eigen::VectorXd>(values.data(), static_cast<Eigen::Index>(values.size())));
+  // NOTE: the bases are shared with the interpolator, only the values are copied until the first
+  // query solves the coefficients
+  Eigen::VectorXd values_vector =
+    Eigen::Map<const Eigen::VectorXd>(values.data(), static_cast<Eigen::Index>(values.size()));
+  parameters_ = std::make_shared<const detail::LazyParameters<Parameters>>(
+    [bases_ptr = this->bases_, values_vector = std::move(values_vector)]() {
+      return compute_parameters(
+        Eigen::Map<const Eigen::VectorXd>(
+          bases_ptr->data(), static_cast<Eigen::Index>(bases_ptr->size())),
+        values_vector);
+    });
 }
 
 double CubicSpline::compute_impl(const double & s) const
 {
+  const auto & [a, b, c, d] = parameters_->get();
   const int32_t i = this->get_index(s);
-  const double dx = s - this->bases_.at(i);
-  return a_(i) + b_(i) * dx + c_(i) * dx * dx + d_(i) * dx * dx * dx;
+  const double dx = s - this->bases().at(i);
+  return a(i) + b(i) * dx + c(i) * dx * dx + d(i) * dx * dx * dx;
+}
+
+std::vector<double> CubicSpline::compute_batch_impl(const std::vector<double> & s) const
+{
+  const auto & [a, b, c, d] = parameters_->get();
+  const std::vector<int32_t> indices = this->get_indices(s);
+  const double * bases = this->bases().data();
+
+  // NOTE: the loop has no branch so that it can be vectorized
+  std::vector<double> result(s.size());
+  for (size_t k = 0; k < s.size(); ++k) {
+    const int32_t i = indices[k];
+    const double dx = s[k] - bases[i];
+    result[k] = a[i] + b[i] * dx + c[i] * dx * dx + d[i] * dx * dx * dx;
+  }
+  return result;
 }
 
 double CubicSpline::compute_first_derivative_impl(const double & s) const
 {
+  const auto & parameters = parameters_->get();
   const int32_t i = this->get_index(s);
-  const double dx = s - this->bases_.at(i);
-  return b_(i) + 2 * c_(i) * dx + 3 * d_(i) * dx * dx;
+  const double dx = s - this->bases().at(i);
+  return parameters.b(i) + 2 * parameters.c(i) * dx + 3 * parameters.d(i) * dx * dx;
 }
 
 double CubicSpline::compute_second_derivative_impl(const double & s) const
 {
+  const auto & parameters = parameters_->get();
   const int32_t i = this->get_index(s);
-  const double dx = s - this->bases_.at(i);
-  return 2 * c_(i) + 6 * d_(i) * dx;
+  const double dx = s - this->bases().at(i);
+  return 2 * parameters.c(i) + 6 * parameters.d(i) * dx;
 }
 
 }  // namespace autoware::trajectory::interpolator
@@ -21,9 +21,8 @@
 namespace autoware::trajectory::interpolator
 {
 
-void Linear::build_impl(const std::vector<double> & bases, const std::vector<double> & values)
+void Linear::build_impl(const std::vector<double> &, const std::vector<double> & values)
 {
-  this->bases_ = bases;
   this->values_ =
     Eigen::Map<const Eigen::VectorXd>(values.data(), static_cast<Eigen::Index>(values.size()));
 }
@@ -31,18 +30,37 @@ void Linear::build_impl(const std::vector<double> & bases, const std::vector<dou
 double Linear::compute_impl(const double & s) const
 {
   const int32_t idx = this->get_index(s);
-  const double x0 = this->bases_.at(idx);
-  const double x1 = this->bases_.at(idx + 1);
+  const double x0 = this->bases().at(idx);
+  const double x1 = this->bases().at(idx + 1);
   const double y0 = this->values_(idx);
   const double y1 = this->values_(idx + 1);
   return y0 + (y1 - y0) * (s - x0) / (x1 - x0);
 }
 
+std::vector<double> Linear::compute_batch_impl(const std::vector<double> & s) const
+{
+  const std::vector<int32_t> indices = this->get_indices(s);
+  const double * bases = this->bases().data();
+  const double * values = this->values_.data();
+
+  // NOTE: the loop has no branch so that it can be vectorized
+  std::vector<double> result(s.size());
+  for (size_t k = 0; k < s.size(); ++k) {
+    const int32_t idx = indices[k];
+    const double x0 = bases[idx];
+    const double x1 = bases[idx + 1];
+    const double y0 = values[idx];
+    const double y1 = values[idx + 1];
+    result[k] = y0 + (y1 - y0) * (s[k] - x0) / (x1 - x0);
+  }
+  return result;
+}
+
 double Linear::compute_first_derivative_impl(const double & s) const
 {
   const int32_t idx = this->get_index(s);
-  const double x0 = this->bases_.at(idx);
-  const double x1 = this->bases_.at(idx + 1);
+  const double x0 = this->bases().at(idx);
+  const double x1 = this->bases().at(idx + 1);
   const double y0 = this->values_(idx);
   const double y1 = this->values_(idx + 1);
   return (y1 - y0) / (x1 - x0);
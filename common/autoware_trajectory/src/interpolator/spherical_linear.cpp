@@ -22,18 +22,16 @@ namespace autoware::trajectory::interpolator
 {
 
 void SphericalLinear::build_impl(
-  const std::vector<double> & bases,
-  const std::vector<geometry_msgs::msg::Quaternion> & quaternions)
+  const std::vector<double> &, const std::vector<geometry_msgs::msg::Quaternion> & quaternions)
 {
-  this->bases_ = bases;
   this->quaternions_ = quaternions;
 }
 
 geometry_msgs::msg::Quaternion SphericalLinear::compute_impl(const double & s) const
 {
   const int32_t idx = this->get_index(s);
-  const double x0 = this->bases_.at(idx);
-  const double x1 = this->bases_.at(idx + 1);
+  const double x0 = this->bases().at(idx);
+  const double x1 = this->bases().at(idx + 1);
   const geometry_msgs::msg::Quaternion y0 = this->quaternions_.at(idx);
   const geometry_msgs::msg::Quaternion y1 = this->quaternions_.at(idx + 1);
 
@@ -31,6 +31,10 @@ bool Trajectory<PointType>::build(const std::vector<PointType> & points)
   std::vector<double> longitudinal_velocity_mps_values;
   std::vector<double> lateral_velocity_mps_values;
   std::vector<double> heading_rate_rps_values;
+  poses.reserve(points.size());
+  longitudinal_velocity_mps_values.reserve(points.size());
+  lateral_velocity_mps_values.reserve(points.size());
+  heading_rate_rps_values.reserve(points.size());
 
   for (const auto & point : points) {
     poses.emplace_back(point.pose);
@@ -60,32 +64,48 @@ PointType Trajectory<PointType>::compute(double s) const
   return result;
 }
 
+std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & s) const
+{
+  std::vector<double> bases;
+  bases.reserve(s.size());
+  for (const auto & s_i : s) {
+    bases.emplace_back(clamp(s_i, true));
+  }
+  return evaluate(bases);
+}
+
+std::vector<PointType> Trajectory<PointType>::evaluate(const std::vector<double> & bases) const
+{
+  const auto poses = BaseClass::evaluate(bases);
+  const auto longitudinal_velocities = this->longitudinal_velocity_mps.compute(bases);
+  const auto lateral_velocities = this->lateral_velocity_mps.compute(bases);
+  const auto heading_rates = this->heading_rate_rps.compute(bases);
+  std::vector<PointType> points(bases.size());
+  for (size_t i = 0; i < bases.size(); ++i) {
+    points[i].pose = poses[i];
+    points[i].longitudinal_velocity_mps = static_cast<float>(longitudinal_velocities[i]);
+    points[i].lateral_velocity_mps = static_cast<float>(lateral_velocities[i]);
+    points[i].heading_rate_rps = static_cast<float>(heading_rates[i]);
+  }
+  return points;
+}
+
 std::vector<PointType> Trajectory<PointType>::restore(const size_t & min_points) const
 {
-  auto get_bases = [](const auto & interpolated_array) {
-    auto [bases, values] = interpolated_array.get_data();
-    return bases;
-  };
+  // NOTE: the arrays share the bases of the trajectory unless a range has been set to them
+  const bool shares_bases = this->longitudinal_velocity_mps.shares_bases_with(bases_) &&
+                            this->lateral_velocity_mps.shares_bases_with(bases_) &&
+                            this->heading_rate_rps.shares_bases_with(bases_);
 
-  auto bases = detail::merge_vectors(
-    bases_, get_bases(this->longitudinal_velocity_mps), get_bases(this->lateral_velocity_mps),
-    get_bases(this->heading_rate_rps));
+  auto bases = shares_bases ? *bases_
+                            : detail::merge_vectors(
+                                *bases_, this->longitudinal_velocity_mps.bases(),
+                                this->lateral_velocity_mps.bases(), this->heading_rate_rps.bases());
 
   bases = detail::crop_bases(bases, start_, end_);
   bases = detail::fill_bases(bases, min_points);
 
-  std::vector<PointType> points;
-  points.reserve(bases.size());
-  for (const auto & s : bases) {
-    PointType p;
-    p.pose = Trajectory<geometry_msgs::msg::Pose>::compute(s - start_);
-    p.longitudinal_velocity_mps = static_cast<float>(this->longitudinal_velocity_mps.compute(s));
-    p.lateral_velocity_mps = static_cast<float>(this->lateral_velocity_mps.compute(s));
-    p.heading_rate_rps = static_cast<float>(this->heading_rate_rps.compute(s));
-    points.emplace_back(p);
-  }
-
-  return points;
+  return evaluate(bases);
 }
 
 }  // namespace autoware::trajectory
@@ -16,6 +16,7 @@
 
 #include "autoware/trajectory/detail/utils.hpp"
 
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory
@@ -27,6 +28,8 @@ bool Trajectory<PointType>::build(const std::vector<PointType> & points)
 {
   std::vector<autoware_planning_msgs::msg::PathPoint> path_points;
   std::vector<std::vector<int64_t>> lane_ids_values;
+  path_points.reserve(points.size());
+  lane_ids_values.reserve(points.size());
 
   for (const auto & point : points) {
     path_points.emplace_back(point.point);
@@ -47,29 +50,46 @@ PointType Trajectory<PointType>::compute(double s) const
   return result;
 }
 
+std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & s) const
+{
+  std::vector<double> bases;
+  bases.reserve(s.size());
+  for (const auto & s_i : s) {
+    bases.emplace_back(clamp(s_i, true));
+  }
+  return evaluate(bases);
+}
+
+std::vector<PointType> Trajectory<PointType>::evaluate(const std::vector<double> & bases) const
+{
+  auto path_points = BaseClass::evaluate(bases);
+  auto lane_ids_values = lane_ids.compute(bases);
+  std::vector<PointType> points(bases.size());
+  for (size_t i = 0; i < bases.size(); ++i) {
+    points[i].point = std::move(path_points[i]);
+    points[i].lane_ids = std::move(lane_ids_values[i]);
+  }
+  return points;
+}
+
 std::vector<PointType> Trajectory<PointType>::restore(const size_t & min_points) const
 {
-  auto get_bases = [](const auto & interpolated_array) {
-    auto [bases, values] = interpolated_array.get_data();
-    return bases;
-  };
+  // NOTE: the arrays share the bases of the trajectory unless a range has been set to them
+  const bool shares_bases = this->longitudinal_velocity_mps.shares_bases_with(bases_) &&
+                            this->lateral_velocity_mps.shares_bases_with(bases_) &&
+                            this->heading_rate_rps.shares_bases_with(bases_) &&
+                            this->lane_ids.shares_bases_with(bases_);
 
-  auto bases = detail::merge_vectors(
-    bases_, get_bases(this->longitudinal_velocity_mps), get_bases(this->lateral_velocity_mps),
-    get_bases(this->heading_rate_rps), get_bases(this->lane_ids));
+  auto bases = shares_bases ? *bases_
+                            : detail::merge_vectors(
+                                *bases_, this->longitudinal_velocity_mps.bases(),
+                                this->lateral_velocity_mps.bases(), this->heading_rate_rps.bases(),
+                                this->lane_ids.bases());
 
   bases = detail::crop_bases(bases, start_, end_);
   bases = detail::fill_bases(bases, min_points);
 
-  std::vector<PointType> points;
-  points.reserve(bases.size());
-  for (const auto & s : bases) {
-    PointType p;
-    p.point = BaseClass::compute(s - start_);
-    p.lane_ids = lane_ids.compute(s);
-    points.emplace_back(p);
-  }
-  return points;
+  return evaluate(bases);
 }
 
 }  // namespace autoware::trajectory
@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::trajectory
@@ -31,11 +33,16 @@ using PointType = geometry_msgs::msg::Point;
 
 bool Trajectory<PointType>::build(const std::vector<PointType> & points)
 {
+  std::vector<double> bases;
   std::vector<double> xs;
   std::vector<double> ys;
   std::vector<double> zs;
+  bases.reserve(points.size());
+  xs.reserve(points.size());
+  ys.reserve(points.size());
+  zs.reserve(points.size());
 
-  bases_.emplace_back(0.0);
+  bases.emplace_back(0.0);
   xs.emplace_back(points[0].x);
   ys.emplace_back(points[0].y);
   zs.emplace_back(points[0].z);
@@ -43,14 +50,17 @@ bool Trajectory<PointType>::build(const std::vector<PointType> & points)
   for (size_t i = 1; i < points.size(); ++i) {
     Eigen::Vector2d p0(points[i - 1].x, points[i - 1].y);
     Eigen::Vector2d p1(points[i].x, points[i].y);
-    bases_.emplace_back(bases_.back() + (p1 - p0).norm());
+    bases.emplace_back(bases.back() + (p1 - p0).norm());
     xs.emplace_back(points[i].x);
     ys.emplace_back(points[i].y);
     zs.emplace_back(points[i].z);
   }
 
-  start_ = bases_.front();
-  end_ = bases_.back();
+  start_ = bases.front();
+  end_ = bases.back();
+
+  // NOTE: all the interpolators reference this bases instead of holding their own copies
+  bases_ = std::make_shared<const std::vector<double>>(std::move(bases));
 
   bool is_valid = true;
   is_valid &= x_interpolator_->build(bases_, xs);
@@ -85,6 +95,30 @@ PointType Trajectory<PointType>::compute(double s) const
   return result;
 }
 
+std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & s) const
+{
+  std::vector<double> bases;
+  bases.reserve(s.size());
+  for (const auto & s_i : s) {
+    bases.emplace_back(clamp(s_i, true));
+  }
+  return evaluate(bases);
+}
+
+std::vector<PointType> Trajectory<PointType>::evaluate(const std::vector<double> & bases) const
+{
+  const auto xs = x_interpolator_->compute(bases);
+  const auto ys = y_interpolator_->compute(bases);
+  const auto zs = z_interpolator_->compute(bases);
+  std::vector<PointType> points(bases.size());
+  for (size_t i = 0; i < bases.size(); ++i) {
+    points[i].x = xs[i];
+    points[i].y = ys[i];
+    points[i].z = zs[i];
+  }
+  return points;
+}
+
 double Trajectory<PointType>::azimuth(double s) const
 {
   s = clamp(s, true);
@@ -112,18 +146,9 @@ double Trajectory<PointType>::curvature(double s) const
 
 std::vector<PointType> Trajectory<PointType>::restore(const size_t & min_points) const
 {
-  auto bases = detail::crop_bases(bases_, start_, end_);
+  auto bases = detail::crop_bases(*bases_, start_, end_);
   bases = detail::fill_bases(bases, min_points);
-  std::vector<PointType> points;
-  points.reserve(bases.size());
-  for (const auto & s : bases) {
-    PointType p;
-    p.x = x_interpolator_->compute(s);
-    p.y = y_interpolator_->compute(s);
-    p.z = z_interpolator_->compute(s);
-    points.emplace_back(p);
-  }
-  return points;
+  return evaluate(bases);
 }
 
 void Trajectory<PointType>::crop(const double & start, const double & length)
@@ -50,10 +50,33 @@ PointType Trajectory<PointType>::compute(double s) const
   return result;
 }
 
+std::vector<PointType> Trajectory<PointType>::compute(const std::vector<double> & s) const
+{
+  std::vector<double> bases;
+  bases.reserve(s.size());
+  for (const auto & s_i : s) {
+    bases.emplace_back(clamp(s_i, true));
+  }
+  return evaluate(bases);
+}
+
+std::vector<PointType> Trajectory<PointType>::evaluate(const std::vector<double> & bases) const
+{
+  const auto positions = BaseClass::evaluate(bases);
+  const auto orientations = orientation_interpolator_->compute(bases);
+  std::vector<PointType> points(bases.size());
+  for (size_t i = 0; i < bases.size(); ++i) {
+    points[i].position = positions[i];
+    points[i].orientation = orientations[i];
+  }
+  return points;
+}
+
 void Trajectory<PointType>::align_orientation_with_trajectory_direction()
 {
   std::vector<geometry_msgs::msg::Quaternion> aligned_orientations;
-  for (const auto & s : bases_) {
+  aligned_orientations.reserve(bases_->size());
+  for (const auto & s : *bases_) {
     double azimuth = this->azimuth(s);
     double elevation = this->elevation(s);
     geometry_msgs::msg::Quaternion current_orientation = orientation_interpolator_->compute(s);
@@ -86,17 +109,9 @@ void Trajectory<PointType>::align_orientation_with_trajectory_direction()
 
 std::vector<PointType> Trajectory<PointType>::restore(const size_t & min_points) const
 {
-  auto bases = detail::crop_bases(bases_, start_, end_);
+  auto bases = detail::crop_bases(*bases_, start_, end_);
   bases = detail::fill_bases(bases, min_points);
-  std::vector<PointType> points;
-  points.reserve(bases.size());
-  for (const auto & s : bases) {
-    PointType p;
-    p.position = BaseClass::compute(s - start_);
-    p.orientation = orientation_interpolator_->compute(s);
-    points.emplace_back(p);
-  }
-  return points;
+  return evaluate(bases);
 }
 
 }  // namespace autoware::trajectory
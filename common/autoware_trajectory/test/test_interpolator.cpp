@@ -67,6 +67,30 @@ TYPED_TEST(TestInterpolator, compute)
   }
 }
 
+TYPED_TEST(TestInterpolator, compute_batch)
+{
+  this->interpolator =
+    typename TypeParam::Builder().set_bases(this->bases).set_values(this->values).build();
+
+  std::vector<double> s;
+  for (double s_i = 0.0; s_i <= 9.0; s_i += 0.05) {
+    s.push_back(s_i);
+  }
+  s.push_back(9.0);
+  // batched values are the same as the scalar ones, for both sorted and unsorted queries
+  for (const auto & queries : {s, std::vector<double>(s.rbegin(), s.rend())}) {
+    const auto results = this->interpolator->compute(queries);
+    ASSERT_EQ(results.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+      EXPECT_EQ(results[i], this->interpolator->compute(queries[i]));
+    }
+  }
+
+  // copies share the bases and the coefficients
+  const auto copied = *this->interpolator;
+  EXPECT_EQ(copied.compute(s), this->interpolator->compute(s));
+}
+
 // Instantiate test cases for all interpolators
 template class TestInterpolator<autoware::trajectory::interpolator::CubicSpline>;
 template class TestInterpolator<autoware::trajectory::interpolator::AkimaSpline>;
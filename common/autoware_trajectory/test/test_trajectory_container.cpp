@@ -193,3 +193,32 @@ TEST_F(TrajectoryTest, crop)
   EXPECT_EQ(end_point_expect.point.pose.position.y, end_point_actual.point.pose.position.y);
   EXPECT_EQ(end_point_expect.lane_ids[0], end_point_actual.lane_ids[0]);
 }
+
+TEST_F(TrajectoryTest, compute_batch)
+{
+  trajectory->longitudinal_velocity_mps.range(trajectory->length() / 3.0, trajectory->length())
+    .set(10.0);
+  trajectory->crop(1.0, trajectory->length() - 2.0);
+
+  std::vector<double> s;
+  for (double s_i = 0.0; s_i < trajectory->length(); s_i += 0.1) {
+    s.push_back(s_i);
+  }
+  s.push_back(trajectory->length());
+
+  const Trajectory & original = *trajectory;
+  const Trajectory copied = original;
+  for (const auto * container : {&original, &copied}) {
+    const auto points = container->compute(s);
+    ASSERT_EQ(points.size(), s.size());
+    for (size_t i = 0; i < s.size(); ++i) {
+      const auto expected = trajectory->compute(s[i]);
+      EXPECT_EQ(points[i].point.pose.position.x, expected.point.pose.position.x);
+      EXPECT_EQ(points[i].point.pose.position.y, expected.point.pose.position.y);
+      EXPECT_EQ(points[i].point.pose.orientation.z, expected.point.pose.orientation.z);
+      EXPECT_EQ(
+        points[i].point.longitudinal_velocity_mps, expected.point.longitudinal_velocity_mps);
+      EXPECT_EQ(points[i].lane_ids, expected.lane_ids);
+    }
+  }
+}
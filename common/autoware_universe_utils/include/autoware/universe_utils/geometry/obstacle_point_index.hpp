@@ -0,0 +1,133 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__GEOMETRY__OBSTACLE_POINT_INDEX_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__GEOMETRY__OBSTACLE_POINT_INDEX_HPP_
+
+#include "autoware/universe_utils/geometry/boost_geometry.hpp"
+
+#include <geometry_msgs/msg/transform_stamped.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <tf2/buffer_core.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+/**
+ * @brief 2D uniform grid index of an obstacle pointcloud for repeated polygon and corridor queries
+ *
+ * The indices of the points are bucketed by their (x, y) cell and stored contiguously per cell, so
+ * that a query only visits the cells overlapping its bounding box. Cells fully inside a queried
+ * polygon are taken without testing each of their points. The z coordinate is kept but ignored by
+ * the queries.
+ * NOTE: The points keep the order of the input cloud, and non-finite points are kept but never
+ * returned by the queries.
+ */
+class ObstaclePointIndex
+{
+public:
+  /**
+   * @brief build the index of the given pointcloud
+   * @param cloud input pointcloud
+   * @param cell_size size of the grid cells [m]
+   */
+  ObstaclePointIndex(pcl::PointCloud<pcl::PointXYZ> cloud, const double cell_size);
+
+  const pcl::PointCloud<pcl::PointXYZ> & points() const { return points_; }
+  size_t size() const { return points_.size(); }
+  bool empty() const { return points_.empty(); }
+  double cellSize() const { return cell_size_; }
+
+  /**
+   * @brief find the points covered by the polygon
+   * @param polygon queried polygon
+   * @return indices of the points in ascending order
+   */
+  std::vector<size_t> pointsWithinPolygon(const Polygon2d & polygon) const;
+
+  /**
+   * @brief find the points covered by any of the polygons
+   * @param polygons queried polygons
+   * @return indices of the points in ascending order without duplicates
+   */
+  std::vector<size_t> pointsWithinPolygons(const std::vector<Polygon2d> & polygons) const;
+
+  /**
+   * @brief find the points whose distance to the centerline is less than or equal to half_width
+   * @param centerline centerline of the corridor
+   * @param half_width half width of the corridor [m]
+   * @return indices of the points in ascending order without duplicates
+   */
+  std::vector<size_t> pointsWithinCorridor(
+    const LineString2d & centerline, const double half_width) const;
+
+private:
+  pcl::PointCloud<pcl::PointXYZ> points_;
+  double cell_size_{1.0};
+  // indices of the finite points grouped by cell
+  std::vector<uint32_t> cell_point_indices_;
+  // range [begin, end) of cell_point_indices_ of each cell
+  std::unordered_map<uint64_t, std::pair<uint32_t, uint32_t>> cells_;
+
+  int64_t toCellIndex(const double v) const;
+  static uint64_t toCellKey(const int64_t ix, const int64_t iy);
+
+  template <class Visitor>
+  void forEachCell(const Box2d & box, const Visitor & visitor) const;
+};
+
+/**
+ * @brief get the index of the pointcloud transformed to the target frame of the transform.
+ * The index is shared within the process, i.e. the nodes of the same container, so that it is
+ * built only once for a given topic, message, transform and cell size. It is released when no
+ * caller holds it anymore.
+ * NOTE: The callers get the same index only if they look up the same transform. Prefer the
+ * overload looking up the transform at the stamp of the message.
+ * @param topic topic of the pointcloud
+ * @param msg input pointcloud
+ * @param transform transform from the frame of the pointcloud to the target frame
+ * @param cell_size size of the grid cells [m]
+ * @return index of the transformed pointcloud
+ */
+std::shared_ptr<const ObstaclePointIndex> getSharedObstaclePointIndex(
+  const std::string & topic, const sensor_msgs::msg::PointCloud2 & msg,
+  const geometry_msgs::msg::TransformStamped & transform, const double cell_size);
+
+/**
+ * @brief get the shared index of the pointcloud transformed to the target frame.
+ * The transform is looked up at the stamp of the message rather than the latest one, so that the
+ * callers receiving the same message get the same transform, and thus the same index.
+ * @param topic topic of the pointcloud
+ * @param msg input pointcloud
+ * @param tf_buffer buffer to look up the transform from
+ * @param target_frame frame to transform the pointcloud to
+ * @param cell_size size of the grid cells [m]
+ * @return index of the transformed pointcloud
+ * @throw tf2::TransformException if the transform at the stamp of the message is not available
+ */
+std::shared_ptr<const ObstaclePointIndex> getSharedObstaclePointIndex(
+  const std::string & topic, const sensor_msgs::msg::PointCloud2 & msg,
+  const tf2::BufferCore & tf_buffer, const std::string & target_frame, const double cell_size);
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__GEOMETRY__OBSTACLE_POINT_INDEX_HPP_
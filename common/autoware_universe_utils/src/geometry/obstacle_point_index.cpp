@@ -0,0 +1,313 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/geometry/obstacle_point_index.hpp"
+
+#include <tf2_eigen/tf2_eigen.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+
+#include <pcl/common/transforms.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+namespace
+{
+double calcSquaredDistanceToSegment(
+  const double x, const double y, const Point2d & p0, const Point2d & p1)
+{
+  const double dx = p1.x() - p0.x();
+  const double dy = p1.y() - p0.y();
+  const double squared_length = dx * dx + dy * dy;
+  double ratio = 0.0;
+  if (squared_length > 0.0) {
+    ratio = std::clamp(((x - p0.x()) * dx + (y - p0.y()) * dy) / squared_length, 0.0, 1.0);
+  }
+  const double ex = x - (p0.x() + ratio * dx);
+  const double ey = y - (p0.y() + ratio * dy);
+  return ex * ex + ey * ey;
+}
+
+constexpr uint32_t min_points_for_cell_test = 8;
+
+void sortUnique(std::vector<size_t> & indices)
+{
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+}  // namespace
+
+ObstaclePointIndex::ObstaclePointIndex(
+  pcl::PointCloud<pcl::PointXYZ> cloud, const double cell_size)
+: points_(std::move(cloud))
+{
+  if (std::isfinite(cell_size) && cell_size > 0.0) {
+    cell_size_ = cell_size;
+  }
+
+  // count the points of each cell, then place their indices contiguously in a second pass
+  std::vector<uint64_t> keys(points_.size());
+  for (size_t i = 0; i < points_.size(); ++i) {
+    const auto & p = points_[i];
+    if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) continue;
+    keys[i] = toCellKey(toCellIndex(p.x), toCellIndex(p.y));
+    ++cells_[keys[i]].second;
+  }
+
+  uint32_t offset = 0;
+  for (auto & cell : cells_) {
+    const uint32_t count = cell.second.second;
+    cell.second = {offset, offset};
+    offset += count;
+  }
+
+  cell_point_indices_.resize(offset);
+  for (size_t i = 0; i < points_.size(); ++i) {
+    const auto & p = points_[i];
+    if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) continue;
+    auto & range = cells_.at(keys[i]);
+    cell_point_indices_[range.second++] = static_cast<uint32_t>(i);
+  }
+}
+
+int64_t ObstaclePointIndex::toCellIndex(const double v) const
+{
+  return static_cast<int64_t>(std::floor(v / cell_size_));
+}
+
+uint64_t ObstaclePointIndex::toCellKey(const int64_t ix, const int64_t iy)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(ix)) << 32) |
+         static_cast<uint64_t>(static_cast<uint32_t>(iy));
+}
+
+template <class Visitor>
+void ObstaclePointIndex::forEachCell(const Box2d & box, const Visitor & visitor) const
+{
+  const int64_t min_ix = toCellIndex(box.min_corner().x());
+  const int64_t min_iy = toCellIndex(box.min_corner().y());
+  const int64_t max_ix = toCellIndex(box.max_corner().x());
+  const int64_t max_iy = toCellIndex(box.max_corner().y());
+
+  // Scanning the occupied cells is cheaper than visiting the box when it covers most of the cloud
+  const auto cell_count = static_cast<double>(max_ix - min_ix + 1) * (max_iy - min_iy + 1);
+  if (cell_count > static_cast<double>(cells_.size())) {
+    for (const auto & [key, range] : cells_) {
+      const auto ix = static_cast<int64_t>(static_cast<int32_t>(key >> 32));
+      const auto iy = static_cast<int64_t>(static_cast<int32_t>(key & 0xFFFFFFFF));
+      if (ix < min_ix || max_ix < ix || iy < min_iy || max_iy < iy) continue;
+      visitor(ix, iy, range);
+    }
+    return;
+  }
+
+  for (int64_t ix = min_ix; ix <= max_ix; ++ix) {
+    for (int64_t iy = min_iy; iy <= max_iy; ++iy) {
+      const auto itr = cells_.find(toCellKey(ix, iy));
+      if (itr == cells_.end()) continue;
+      visitor(ix, iy, itr->second);
+    }
+  }
+}
+
+std::vector<size_t> ObstaclePointIndex::pointsWithinPolygon(const Polygon2d & polygon) const
+{
+  std::vector<size_t> indices;
+  if (points_.empty() || polygon.outer().empty()) {
+    return indices;
+  }
+
+  Box2d box;
+  boost::geometry::envelope(polygon, box);
+  forEachCell(box, [&](const int64_t ix, const int64_t iy, const auto & range) {
+    // testing the whole cell only pays off when it holds several points
+    if (range.second - range.first > min_points_for_cell_test) {
+      const double min_x = static_cast<double>(ix) * cell_size_;
+      const double min_y = static_cast<double>(iy) * cell_size_;
+      Polygon2d cell_polygon;
+      cell_polygon.outer() = {
+        {min_x, min_y},
+        {min_x, min_y + cell_size_},
+        {min_x + cell_size_, min_y + cell_size_},
+        {min_x + cell_size_, min_y},
+        {min_x, min_y}};
+      if (boost::geometry::covered_by(cell_polygon, polygon)) {
+        indices.insert(
+          indices.end(), cell_point_indices_.begin() + range.first,
+          cell_point_indices_.begin() + range.second);
+        return;
+      }
+    }
+    for (uint32_t k = range.first; k < range.second; ++k) {
+      const uint32_t i = cell_point_indices_[k];
+      const Point2d p{points_[i].x, points_[i].y};
+      if (boost::geometry::covered_by(p, box) && boost::geometry::covered_by(p, polygon)) {
+        indices.push_back(i);
+      }
+    }
+  });
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+std::vector<size_t> ObstaclePointIndex::pointsWithinPolygons(
+  const std::vector<Polygon2d> & polygons) const
+{
+  std::vector<size_t> indices;
+  for (const auto & polygon : polygons) {
+    const auto polygon_indices = pointsWithinPolygon(polygon);
+    indices.insert(indices.end(), polygon_indices.begin(), polygon_indices.end());
+  }
+  if (polygons.size() > 1) {
+    sortUnique(indices);
+  }
+  return indices;
+}
+
+std::vector<size_t> ObstaclePointIndex::pointsWithinCorridor(
+  const LineString2d & centerline, const double half_width) const
+{
+  std::vector<size_t> indices;
+  if (points_.empty() || centerline.empty() || half_width < 0.0) {
+    return indices;
+  }
+
+  const double squared_half_width = half_width * half_width;
+  const auto visit_segment = [&](const Point2d & p0, const Point2d & p1) {
+    const Box2d box{
+      {std::min(p0.x(), p1.x()) - half_width, std::min(p0.y(), p1.y()) - half_width},
+      {std::max(p0.x(), p1.x()) + half_width, std::max(p0.y(), p1.y()) + half_width}};
+    forEachCell(box, [&](const int64_t ix, const int64_t iy, const auto & range) {
+      // the area around a segment is convex, so the cell is inside if all its corners are
+      const double min_x = static_cast<double>(ix) * cell_size_;
+      const double min_y = static_cast<double>(iy) * cell_size_;
+      const std::array<std::pair<double, double>, 4> corners{
+        {{min_x, min_y},
+         {min_x + cell_size_, min_y},
+         {min_x, min_y + cell_size_},
+         {min_x + cell_size_, min_y + cell_size_}}};
+      const bool is_cell_inside = std::all_of(corners.begin(), corners.end(), [&](const auto & c) {
+        return calcSquaredDistanceToSegment(c.first, c.second, p0, p1) <= squared_half_width;
+      });
+      for (uint32_t k = range.first; k < range.second; ++k) {
+        const uint32_t i = cell_point_indices_[k];
+        if (
+          is_cell_inside || calcSquaredDistanceToSegment(points_[i].x, points_[i].y, p0, p1) <=
+                              squared_half_width) {
+          indices.push_back(i);
+        }
+      }
+    });
+  };
+
+  if (centerline.size() == 1) {
+    visit_segment(centerline.front(), centerline.front());
+  }
+  for (size_t i = 0; i + 1 < centerline.size(); ++i) {
+    visit_segment(centerline[i], centerline[i + 1]);
+  }
+  sortUnique(indices);
+  return indices;
+}
+
+std::shared_ptr<const ObstaclePointIndex> getSharedObstaclePointIndex(
+  const std::string & topic, const sensor_msgs::msg::PointCloud2 & msg,
+  const geometry_msgs::msg::TransformStamped & transform, const double cell_size)
+{
+  // the index of an entry is built by the first caller, the others wait for it on its own mutex
+  struct Slot
+  {
+    std::mutex mutex;
+    std::shared_ptr<const ObstaclePointIndex> index;
+  };
+  struct Entry
+  {
+    std::string topic;
+    std::string source_frame_id;
+    builtin_interfaces::msg::Time stamp;
+    size_t num_points;
+    std::string target_frame_id;
+    geometry_msgs::msg::Transform transform;
+    double cell_size;
+    std::weak_ptr<Slot> slot;
+  };
+  static std::mutex mutex;
+  static std::vector<Entry> entries;
+
+  const size_t num_points = static_cast<size_t>(msg.width) * msg.height;
+  std::shared_ptr<Slot> slot;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.erase(
+      std::remove_if(
+        entries.begin(), entries.end(), [](const auto & entry) { return entry.slot.expired(); }),
+      entries.end());
+
+    for (const auto & entry : entries) {
+      if (
+        entry.topic == topic && entry.source_frame_id == msg.header.frame_id &&
+        entry.stamp == msg.header.stamp && entry.num_points == num_points &&
+        entry.target_frame_id == transform.header.frame_id &&
+        entry.transform == transform.transform && entry.cell_size == cell_size) {
+        slot = entry.slot.lock();
+        if (slot) break;
+      }
+    }
+    if (!slot) {
+      slot = std::make_shared<Slot>();
+      entries.push_back(
+        {topic, msg.header.frame_id, msg.header.stamp, num_points, transform.header.frame_id,
+         transform.transform, cell_size, slot});
+    }
+  }
+
+  std::lock_guard<std::mutex> slot_lock(slot->mutex);
+  if (!slot->index) {
+    pcl::PointCloud<pcl::PointXYZ> cloud;
+    pcl::fromROSMsg(msg, cloud);
+    pcl::PointCloud<pcl::PointXYZ> transformed_cloud;
+    if (!cloud.empty()) {
+      const Eigen::Affine3f affine = tf2::transformToEigen(transform.transform).cast<float>();
+      pcl::transformPointCloud(cloud, transformed_cloud, affine);
+    }
+    transformed_cloud.header.frame_id = transform.header.frame_id;
+    slot->index =
+      std::make_shared<const ObstaclePointIndex>(std::move(transformed_cloud), cell_size);
+  }
+  // the returned pointer keeps the slot, and thus the entry, alive
+  return std::shared_ptr<const ObstaclePointIndex>(slot, slot->index.get());
+}
+
+std::shared_ptr<const ObstaclePointIndex> getSharedObstaclePointIndex(
+  const std::string & topic, const sensor_msgs::msg::PointCloud2 & msg,
+  const tf2::BufferCore & tf_buffer, const std::string & target_frame, const double cell_size)
+{
+  const tf2::TimePoint stamp(
+    std::chrono::seconds(msg.header.stamp.sec) +
+    std::chrono::nanoseconds(msg.header.stamp.nanosec));
+  const auto transform = tf_buffer.lookupTransform(target_frame, msg.header.frame_id, stamp);
+  return getSharedObstaclePointIndex(topic, msg, transform, cell_size);
+}
+}  // namespace autoware::universe_utils
@@ -0,0 +1,219 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/geometry/boost_geometry.hpp"
+#include "autoware/universe_utils/geometry/obstacle_point_index.hpp"
+
+#include <boost/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+#include <pcl_conversions/pcl_conversions.h>
+#include <tf2/buffer_core.h>
+#include <tf2/exceptions.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware::universe_utils::LineString2d;
+using autoware::universe_utils::ObstaclePointIndex;
+using autoware::universe_utils::Point2d;
+using autoware::universe_utils::Polygon2d;
+
+pcl::PointCloud<pcl::PointXYZ> generateCloud(const size_t size)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  for (size_t i = 0; i < size; ++i) {
+    cloud.push_back(pcl::PointXYZ(dist(engine), dist(engine), dist(engine)));
+  }
+  return cloud;
+}
+
+Polygon2d createPolygon(const std::vector<Point2d> & points)
+{
+  Polygon2d polygon;
+  for (const auto & p : points) {
+    polygon.outer().push_back(p);
+  }
+  polygon.outer().push_back(points.front());
+  boost::geometry::correct(polygon);
+  return polygon;
+}
+}  // namespace
+
+TEST(obstacle_point_index, keepInputOrder)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  cloud.push_back(pcl::PointXYZ(0.0f, 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(1.0f, std::numeric_limits<float>::infinity(), 0.0f));
+  cloud.push_back(pcl::PointXYZ(-3.0f, 2.0f, 1.0f));
+  cloud.push_back(pcl::PointXYZ(0.1f, 0.2f, 0.0f));
+
+  const ObstaclePointIndex index(cloud, 0.5);
+  ASSERT_EQ(index.size(), cloud.size());
+  EXPECT_FLOAT_EQ(index.points()[3].x, -3.0f);
+  EXPECT_FLOAT_EQ(index.points()[4].y, 0.2f);
+
+  // the non-finite points are never returned
+  const auto all_indices = index.pointsWithinPolygon(
+    createPolygon({{-10.0, -10.0}, {10.0, -10.0}, {10.0, 10.0}, {-10.0, 10.0}}));
+  EXPECT_EQ(all_indices, (std::vector<size_t>{0, 3, 4}));
+  EXPECT_EQ(
+    index.pointsWithinCorridor({{-10.0, 0.0}, {10.0, 0.0}}, 100.0),
+    (std::vector<size_t>{0, 3, 4}));
+  EXPECT_TRUE(ObstaclePointIndex(pcl::PointCloud<pcl::PointXYZ>{}, 0.5).empty());
+}
+
+TEST(obstacle_point_index, pointsWithinPolygon)
+{
+  const auto cloud = generateCloud(5000);
+  const std::vector<Polygon2d> polygons = {
+    createPolygon({{-5.0, -5.0}, {5.0, -5.0}, {5.0, 5.0}, {-5.0, 5.0}}),
+    createPolygon({{0.0, 0.0}, {15.0, 3.0}, {2.0, 12.0}}),
+    createPolygon({{-30.0, -30.0}, {30.0, -30.0}, {30.0, 30.0}, {-30.0, 30.0}}),
+    createPolygon({{100.0, 100.0}, {101.0, 100.0}, {101.0, 101.0}})};
+
+  for (const double cell_size : {0.3, 1.0, 7.0}) {
+    const ObstaclePointIndex index(cloud, cell_size);
+    ASSERT_EQ(index.size(), cloud.size());
+    for (const auto & polygon : polygons) {
+      std::vector<size_t> expected;
+      for (size_t i = 0; i < index.size(); ++i) {
+        const Point2d p{index.points()[i].x, index.points()[i].y};
+        if (boost::geometry::covered_by(p, polygon)) {
+          expected.push_back(i);
+        }
+      }
+      EXPECT_EQ(index.pointsWithinPolygon(polygon), expected);
+    }
+
+    const auto indices = index.pointsWithinPolygons({polygons[0], polygons[1]});
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < index.size(); ++i) {
+      const Point2d p{index.points()[i].x, index.points()[i].y};
+      if (
+        boost::geometry::covered_by(p, polygons[0]) ||
+        boost::geometry::covered_by(p, polygons[1])) {
+        expected.push_back(i);
+      }
+    }
+    EXPECT_EQ(indices, expected);
+  }
+}
+
+TEST(obstacle_point_index, pointsWithinCorridor)
+{
+  const auto cloud = generateCloud(5000);
+  const std::vector<LineString2d> centerlines = {
+    {{-15.0, 0.0}, {0.0, 0.0}, {10.0, 10.0}, {10.0, 18.0}}, {{3.0, 4.0}}, {}};
+
+  for (const double cell_size : {0.3, 1.0, 7.0}) {
+    const ObstaclePointIndex index(cloud, cell_size);
+    for (const auto & centerline : centerlines) {
+      for (const double half_width : {0.0, 1.5, 4.0}) {
+        std::vector<size_t> expected;
+        for (size_t i = 0; !centerline.empty() && i < index.size(); ++i) {
+          const Point2d p{index.points()[i].x, index.points()[i].y};
+          if (boost::geometry::distance(p, centerline) <= half_width) {
+            expected.push_back(i);
+          }
+        }
+        EXPECT_EQ(index.pointsWithinCorridor(centerline, half_width), expected);
+      }
+    }
+  }
+}
+
+TEST(obstacle_point_index, getSharedObstaclePointIndex)
+{
+  using autoware::universe_utils::getSharedObstaclePointIndex;
+
+  sensor_msgs::msg::PointCloud2 msg;
+  pcl::toROSMsg(generateCloud(100), msg);
+  msg.header.frame_id = "base_link";
+  msg.header.stamp.sec = 10;
+  geometry_msgs::msg::TransformStamped transform;
+  transform.header.frame_id = "map";
+  transform.transform.rotation.w = 1.0;
+  transform.transform.translation.x = 1.0;
+
+  const auto index = getSharedObstaclePointIndex("/points", msg, transform, 0.5);
+  ASSERT_EQ(index->size(), 100u);
+  EXPECT_EQ(index->points().header.frame_id, "map");
+  EXPECT_EQ(getSharedObstaclePointIndex("/points", msg, transform, 0.5), index);
+
+  // an index is not shared between topics, transforms or cell sizes
+  EXPECT_NE(getSharedObstaclePointIndex("/other_points", msg, transform, 0.5), index);
+  EXPECT_NE(getSharedObstaclePointIndex("/points", msg, transform, 1.0), index);
+  auto other_transform = transform;
+  other_transform.transform.translation.x = 2.0;
+  const auto other_index = getSharedObstaclePointIndex("/points", msg, other_transform, 0.5);
+  EXPECT_NE(other_index, index);
+  EXPECT_FLOAT_EQ(other_index->points()[0].x, index->points()[0].x + 1.0f);
+}
+
+TEST(obstacle_point_index, getSharedObstaclePointIndexFromBuffer)
+{
+  using autoware::universe_utils::getSharedObstaclePointIndex;
+
+  const auto cloud = generateCloud(100);
+  sensor_msgs::msg::PointCloud2 msg;
+  pcl::toROSMsg(cloud, msg);
+  msg.header.frame_id = "base_link";
+  msg.header.stamp.sec = 10;
+
+  const auto create_transform = [](const int32_t sec, const double x) {
+    geometry_msgs::msg::TransformStamped transform;
+    transform.header.frame_id = "map";
+    transform.header.stamp.sec = sec;
+    transform.child_frame_id = "base_link";
+    transform.transform.rotation.w = 1.0;
+    transform.transform.translation.x = x;
+    return transform;
+  };
+
+  // two planners receiving the same message, each with its own buffer. the second one has already
+  // received a newer transform, so that their latest transforms differ
+  tf2::BufferCore buffer;
+  tf2::BufferCore other_buffer;
+  for (auto * tf_buffer : {&buffer, &other_buffer}) {
+    tf_buffer->setTransform(create_transform(9, 1.0), "test");
+    tf_buffer->setTransform(create_transform(11, 3.0), "test");
+  }
+  other_buffer.setTransform(create_transform(12, 5.0), "test");
+
+  const auto index = getSharedObstaclePointIndex("/points", msg, buffer, "map", 0.5);
+  EXPECT_EQ(getSharedObstaclePointIndex("/points", msg, other_buffer, "map", 0.5), index);
+  ASSERT_EQ(index->size(), 100u);
+  EXPECT_FLOAT_EQ(index->points()[0].x, cloud[0].x + 2.0f);
+
+  // looking up the latest transforms instead would not share the index
+  const auto latest_transform = buffer.lookupTransform("map", "base_link", tf2::TimePointZero);
+  const auto other_latest_transform =
+    other_buffer.lookupTransform("map", "base_link", tf2::TimePointZero);
+  EXPECT_NE(
+    getSharedObstaclePointIndex("/points", msg, latest_transform, 0.5),
+    getSharedObstaclePointIndex("/points", msg, other_latest_transform, 0.5));
+
+  // no transform is available at the stamp of the message
+  msg.header.stamp.sec = 20;
+  EXPECT_THROW(
+    getSharedObstaclePointIndex("/points", msg, buffer, "map", 0.5), tf2::TransformException);
+}
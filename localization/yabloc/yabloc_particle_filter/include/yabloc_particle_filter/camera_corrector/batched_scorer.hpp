@@ -0,0 +1,101 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__BATCHED_SCORER_HPP_
+#define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__BATCHED_SCORER_HPP_
+
+#include <sophus/se3.hpp>
+#include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <array>
+#include <vector>
+
+namespace yabloc::modularized_particle_filter
+{
+/**
+ * Line segment sample points discretized once per frame in the base_link frame.
+ * The members are stored as structure-of-arrays so that transforming them by each particle pose
+ * is a simple vectorizable loop.
+ */
+struct SampledLineSegments
+{
+  std::vector<float> x, y, z;  // sample position
+  std::vector<float> tx, ty, tz;  // unit tangent of the line segment the sample belongs to
+  std::vector<float> weight;  // 1.0 for apriori (reliable) and 0.2 for posteriori (iffy) samples
+
+  [[nodiscard]] size_t size() const { return x.size(); }
+  void clear();
+  void push_back(const Eigen::Vector3f & p, const Eigen::Vector3f & tangent, float w);
+};
+
+/**
+ * Discretize line segments at a fixed interval.
+ * The sampling is the same as the one of CameraParticleCorrector::compute_logit().
+ */
+SampledLineSegments sample_line_segments(
+  const pcl::PointCloud<pcl::PointXYZLNormal> & line_segments, float interval = 0.1f);
+
+/**
+ * Score every particle against the hierarchical cost map at once.
+ *
+ * The cost map tiles needed by all particles are looked up (and built if necessary) once per
+ * frame. After that, particles are scored in parallel by reading the flat tile buffers directly.
+ */
+class BatchedScorer
+{
+public:
+  explicit BatchedScorer(float far_weight_gain);
+
+  void set_line_segments(const pcl::PointCloud<pcl::PointXYZLNormal> & line_segments);
+
+  /**
+   * Compute the logit of each particle pose
+   *
+   * @param[in] transforms Particle poses
+   * @param[in] cost_map Cost map, tiles which are not generated yet are built in this function
+   * @return Logits aligned with transforms
+   */
+  std::vector<float> compute_logits(
+    const std::vector<Sophus::SE3f> & transforms, HierarchicalCostMap & cost_map) const;
+
+private:
+  struct Tile
+  {
+    Area area;
+    // NOTE: holds the reference so that eviction does not release the buffer
+    HierarchicalCostMap::TileConstPtr image;
+    const uchar * data;
+    size_t step;
+  };
+
+  const float far_weight_gain_;
+  SampledLineSegments samples_;
+  std::array<float, 256> cos_table_{};
+  std::array<float, 256> sin_table_{};
+
+  std::vector<Tile> collect_tiles(
+    const std::vector<Sophus::SE3f> & transforms, HierarchicalCostMap & cost_map) const;
+
+  float compute_logit(
+    const Sophus::SE3f & transform, const std::vector<Tile> & tiles, float pixel_per_meter,
+    int image_size, std::vector<float> & world_x, std::vector<float> & world_y,
+    std::vector<float> & gains, std::vector<float> & tangent_x,
+    std::vector<float> & tangent_y) const;
+};
+}  // namespace yabloc::modularized_particle_filter
+
+#endif  // YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__BATCHED_SCORER_HPP_
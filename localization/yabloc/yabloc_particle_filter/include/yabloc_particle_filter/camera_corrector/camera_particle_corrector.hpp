@@ -16,6 +16,7 @@
 #define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__CAMERA_PARTICLE_CORRECTOR_HPP_
 
 #include <opencv4/opencv2/core.hpp>
+#include <yabloc_particle_filter/camera_corrector/batched_scorer.hpp>
 #include <yabloc_particle_filter/correction/abstract_corrector.hpp>
 #include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
 
@@ -54,7 +55,9 @@ public:
 private:
   const float min_prob_;
   const float far_weight_gain_;
+  const bool use_batched_scorer_;
   HierarchicalCostMap cost_map_;
+  BatchedScorer batched_scorer_;
 
   rclcpp::Subscription<PointCloud2>::SharedPtr sub_bounding_box_;
   rclcpp::Subscription<PointCloud2>::SharedPtr sub_line_segments_cloud_;
@@ -92,6 +95,8 @@ private:
     const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
 
   std::pair<LineSegments, LineSegments> filt(const LineSegments & lines);
+
+  friend class CameraParticleCorrectorTestSuite;  // for test code
 };
 }  // namespace yabloc::modularized_particle_filter
 
@@ -16,6 +16,7 @@
 #define YABLOC_PARTICLE_FILTER__LL2_COST_MAP__HIERARCHICAL_COST_MAP_HPP_
 
 #include <Eigen/StdVector>
+#include <autoware/universe_utils/system/lru_cache.hpp>
 #include <opencv4/opencv2/core.hpp>
 #include <rclcpp/node.hpp>
 #include <yabloc_common/gamma_converter.hpp>
@@ -29,9 +30,16 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
+#include <condition_variable>
+#include <deque>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace yabloc
@@ -104,20 +112,69 @@ public:
 
   using BgPoint = boost::geometry::model::d2::point_xy<double>;
   using BgPolygon = boost::geometry::model::polygon<BgPoint>;
+  using TileConstPtr = std::shared_ptr<const cv::Mat>;
+
+  /**
+   * Pixel reader which resolves the tile only when the queried position leaves the last tile.
+   * Consecutive lookups in the same tile, e.g. along a row or a line segment, neither lock the
+   * cost map nor touch its LRU order.
+   */
+  class Reader
+  {
+  public:
+    explicit Reader(HierarchicalCostMap & cost_map) : cost_map_(cost_map) {}
+
+    /**
+     * Get pixel value at specified pixel
+     *
+     * @param[in] position Real scale position at world frame
+     * @return The combination of intensity (0-1), angle (0-180), unmapped flag (0, 1)
+     */
+    CostMapValue at(const Eigen::Vector2f & position);
+
+  private:
+    HierarchicalCostMap & cost_map_;
+    std::optional<Area> area_{std::nullopt};
+    TileConstPtr image_{nullptr};
+  };
 
   explicit HierarchicalCostMap(rclcpp::Node * node);
+  ~HierarchicalCostMap();
+
+  HierarchicalCostMap(const HierarchicalCostMap &) = delete;
+  HierarchicalCostMap & operator=(const HierarchicalCostMap &) = delete;
 
   void set_cloud(const pcl::PointCloud<pcl::PointNormal> & cloud);
   void set_bounding_box(const pcl::PointCloud<pcl::PointXYZL> & cloud);
 
   /**
    * Get pixel value at specified pixel
+   * NOTE: Use Reader for many lookups, since this resolves the tile on every call.
    *
    * @param[in] position Real scale position at world frame
    * @return The combination of intensity (0-1), angle (0-180), unmapped flag (0, 1)
    */
   CostMapValue at(const Eigen::Vector2f & position);
 
+  /**
+   * Get the whole cost map tile of specified area. The tile is built if it does not exist yet.
+   *
+   * @param[in] area Index of the tile
+   * @return The 3-channel tile image, which stays valid even if it is evicted, or nullptr if the
+   *         lanelet2 cloud is not set yet
+   */
+  TileConstPtr tile(const Area & area);
+
+  /**
+   * Request the background builder to generate the tiles which ego will reach soon
+   *
+   * @param[in] position Current ego position at world frame
+   * @param[in] velocity Current ego velocity at world frame
+   */
+  void prefetch(const Eigen::Vector2f & position, const Eigen::Vector2f & velocity);
+
+  float image_size() const { return image_size_; }
+
   MarkerArray show_map_range() const;
 
   cv::Mat get_map_image(const Pose & pose);
@@ -127,25 +184,43 @@ public:
   void set_height(float height);
 
 private:
+  template <typename Key, typename Value>
+  using AreaMap = std::unordered_map<Key, Value, Area>;
+
   const float max_range_;
   const float image_size_;
   const size_t max_map_count_;
+  const float prefetch_horizon_;
   rclcpp::Logger logger_;
   std::optional<float> height_{std::nullopt};
 
   common::GammaConverter gamma_converter_{4.0f};
 
-  std::unordered_map<Area, bool, Area> map_accessed_;
-
+  // NOTE: cost_maps_ is shared with the prefetch thread and guarded by mutex_
+  mutable std::mutex mutex_;
+  std::condition_variable prefetch_cv_;
+  std::condition_variable built_cv_;
+  autoware::universe_utils::LRUCache<Area, TileConstPtr, AreaMap> cost_maps_;
   std::list<Area> generated_map_history_;
-  std::optional<pcl::PointCloud<pcl::PointNormal>> cloud_;
-  std::vector<BgPolygon> bounding_boxes_;
-  std::unordered_map<Area, cv::Mat, Area> cost_maps_;
+  std::deque<Area> prefetch_queue_;
+  std::unordered_set<Area, Area> building_areas_;
+  // NOTE: incremented whenever the cached tiles become invalid so that stale results are dropped
+  size_t generation_{0};
+  bool stop_prefetch_{false};
+  std::thread prefetch_thread_;
 
-  cv::Point to_cv_point(const Area & area, const Eigen::Vector2f & p) const;
-  void build_map(const Area & area);
+  std::shared_ptr<const pcl::PointCloud<pcl::PointNormal>> cloud_;
+  std::shared_ptr<const std::vector<BgPolygon>> bounding_boxes_;
 
-  cv::Mat create_available_area_image(const Area & area) const;
+  cv::Point to_cv_point(const Area & area, const Eigen::Vector2f & p) const;
+  cv::Mat build_map(
+    const Area & area, const pcl::PointCloud<pcl::PointNormal> & cloud,
+    const std::optional<float> & height, const std::vector<BgPolygon> & bounding_boxes) const;
+  TileConstPtr build_and_cache_map(const Area & area, std::unique_lock<std::mutex> & lock);
+  void run_prefetch();
+
+  cv::Mat create_available_area_image(
+    const Area & area, const std::vector<BgPolygon> & bounding_boxes) const;
 };
 }  // namespace yabloc
 
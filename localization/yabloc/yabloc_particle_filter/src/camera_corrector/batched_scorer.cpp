@@ -0,0 +1,241 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yabloc_particle_filter/camera_corrector/batched_scorer.hpp"
+
+#include <autoware/universe_utils/math/trigonometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace yabloc::modularized_particle_filter
+{
+void SampledLineSegments::clear()
+{
+  x.clear();
+  y.clear();
+  z.clear();
+  tx.clear();
+  ty.clear();
+  tz.clear();
+  weight.clear();
+}
+
+void SampledLineSegments::push_back(
+  const Eigen::Vector3f & p, const Eigen::Vector3f & tangent, float w)
+{
+  x.push_back(p.x());
+  y.push_back(p.y());
+  z.push_back(p.z());
+  tx.push_back(tangent.x());
+  ty.push_back(tangent.y());
+  tz.push_back(tangent.z());
+  weight.push_back(w);
+}
+
+SampledLineSegments sample_line_segments(
+  const pcl::PointCloud<pcl::PointXYZLNormal> & line_segments, float interval)
+{
+  SampledLineSegments samples;
+  for (const pcl::PointXYZLNormal & pn : line_segments) {
+    const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
+    const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
+    // NOTE: posteriori (label == 0) line segments are less reliable than apriori ones
+    const float weight = (pn.label == 0) ? 0.2f : 1.0f;
+
+    for (float distance = 0; distance < length; distance += interval) {
+      samples.push_back(pn.getVector3fMap() + tangent * distance, tangent, weight);
+    }
+  }
+  return samples;
+}
+
+BatchedScorer::BatchedScorer(float far_weight_gain) : far_weight_gain_(far_weight_gain)
+{
+  // CostMapValue::angle is stored in a 8bit channel
+  for (size_t angle = 0; angle < cos_table_.size(); ++angle) {
+    const auto radian = static_cast<float>(static_cast<double>(angle) * M_PI / 180.0);
+    cos_table_.at(angle) = autoware::universe_utils::cos(radian);
+    sin_table_.at(angle) = autoware::universe_utils::sin(radian);
+  }
+}
+
+void BatchedScorer::set_line_segments(const pcl::PointCloud<pcl::PointXYZLNormal> & line_segments)
+{
+  samples_ = sample_line_segments(line_segments);
+}
+
+std::vector<BatchedScorer::Tile> BatchedScorer::collect_tiles(
+  const std::vector<Sophus::SE3f> & transforms, HierarchicalCostMap & cost_map) const
+{
+  const size_t particle_count = transforms.size();
+  const size_t sample_count = samples_.size();
+
+  // Compute the bounding box of the samples of each particle in parallel
+  std::vector<std::array<int, 4>> area_ranges(particle_count);
+#pragma omp parallel for
+  for (size_t k = 0; k < particle_count; ++k) {
+    const Eigen::Matrix3f r = transforms[k].rotationMatrix();
+    const Eigen::Vector3f t = transforms[k].translation();
+    float min_x = std::numeric_limits<float>::max();
+    float min_y = std::numeric_limits<float>::max();
+    float max_x = std::numeric_limits<float>::lowest();
+    float max_y = std::numeric_limits<float>::lowest();
+    for (size_t i = 0; i < sample_count; ++i) {
+      const float wx = r(0, 0) * samples_.x[i] + r(0, 1) * samples_.y[i] + r(0, 2) * samples_.z[i];
+      const float wy = r(1, 0) * samples_.x[i] + r(1, 1) * samples_.y[i] + r(1, 2) * samples_.z[i];
+      min_x = std::min(min_x, wx);
+      min_y = std::min(min_y, wy);
+      max_x = std::max(max_x, wx);
+      max_y = std::max(max_y, wy);
+    }
+    const Area min_area(Eigen::Vector2f(min_x + t.x(), min_y + t.y()));
+    const Area max_area(Eigen::Vector2f(max_x + t.x(), max_y + t.y()));
+    area_ranges[k] = {min_area.x, min_area.y, max_area.x, max_area.y};
+  }
+
+  // Look up (or build) every needed tile only once
+  std::unordered_set<Area, Area> areas;
+  for (const auto & range : area_ranges) {
+    for (int x = range[0]; x <= range[2]; ++x) {
+      for (int y = range[1]; y <= range[3]; ++y) {
+        Area area;
+        area.x = x;
+        area.y = y;
+        areas.insert(area);
+      }
+    }
+  }
+
+  std::vector<Tile> tiles;
+  for (const Area & area : areas) {
+    HierarchicalCostMap::TileConstPtr image = cost_map.tile(area);
+    if (!image) return {};
+    const uchar * data = image->ptr<uchar>(0);
+    const size_t step = image->step[0];
+    tiles.push_back({area, std::move(image), data, step});
+  }
+  return tiles;
+}
+
+std::vector<float> BatchedScorer::compute_logits(
+  const std::vector<Sophus::SE3f> & transforms, HierarchicalCostMap & cost_map) const
+{
+  std::vector<float> logits(transforms.size(), 0.0f);
+  if (samples_.size() == 0) return logits;
+
+  const std::vector<Tile> tiles = collect_tiles(transforms, cost_map);
+  if (tiles.empty()) {
+    // logit does not change if the cost map is not ready
+    return logits;
+  }
+
+  const int image_size = static_cast<int>(cost_map.image_size());
+  const float pixel_per_meter = static_cast<float>(image_size) / Area::unit_length;
+
+#pragma omp parallel
+  {
+    // Per-thread scratch buffers reused across particles
+    std::vector<float> world_x(samples_.size());
+    std::vector<float> world_y(samples_.size());
+    std::vector<float> gains(samples_.size());
+    std::vector<float> tangent_x(samples_.size());
+    std::vector<float> tangent_y(samples_.size());
+
+#pragma omp for
+    for (size_t k = 0; k < transforms.size(); ++k) {
+      logits[k] = compute_logit(
+        transforms[k], tiles, pixel_per_meter, image_size, world_x, world_y, gains, tangent_x,
+        tangent_y);
+    }
+  }
+  return logits;
+}
+
+float BatchedScorer::compute_logit(
+  const Sophus::SE3f & transform, const std::vector<Tile> & tiles, float pixel_per_meter,
+  int image_size, std::vector<float> & world_x, std::vector<float> & world_y,
+  std::vector<float> & gains, std::vector<float> & tangent_x, std::vector<float> & tangent_y) const
+{
+  const size_t sample_count = samples_.size();
+  const Eigen::Matrix3f r = transform.rotationMatrix();
+  const Eigen::Vector3f t = transform.translation();
+
+  const float * sx = samples_.x.data();
+  const float * sy = samples_.y.data();
+  const float * sz = samples_.z.data();
+  const float * stx = samples_.tx.data();
+  const float * sty = samples_.ty.data();
+  const float * stz = samples_.tz.data();
+  float * wx = world_x.data();
+  float * wy = world_y.data();
+  float * g = gains.data();
+  float * tx = tangent_x.data();
+  float * ty = tangent_y.data();
+
+  // Transform samples into the world frame. This loop has no branch and is vectorized.
+#pragma omp simd
+  for (size_t i = 0; i < sample_count; ++i) {
+    const float rx = r(0, 0) * sx[i] + r(0, 1) * sy[i] + r(0, 2) * sz[i];
+    const float ry = r(1, 0) * sx[i] + r(1, 1) * sy[i] + r(1, 2) * sz[i];
+    wx[i] = rx + t.x();
+    wy[i] = ry + t.y();
+    // NOTE: Close points are prioritized
+    g[i] = std::exp(-far_weight_gain_ * (rx * rx + ry * ry));
+
+    const float ttx = r(0, 0) * stx[i] + r(0, 1) * sty[i] + r(0, 2) * stz[i];
+    const float tty = r(1, 0) * stx[i] + r(1, 1) * sty[i] + r(1, 2) * stz[i];
+    const float norm = std::sqrt(ttx * ttx + tty * tty);
+    const float inv_norm = norm > 0.0f ? 1.0f / norm : 0.0f;
+    tx[i] = ttx * inv_norm;
+    ty[i] = tty * inv_norm;
+  }
+
+  // Gather cost map values from the flat tile buffers
+  float logit = 0;
+  const Tile * last_tile = &tiles.front();
+  for (size_t i = 0; i < sample_count; ++i) {
+    const int area_x = static_cast<int>(std::floor(wx[i] / Area::unit_length));
+    const int area_y = static_cast<int>(std::floor(wy[i] / Area::unit_length));
+    if (last_tile->area.x != area_x || last_tile->area.y != area_y) {
+      const auto itr = std::find_if(tiles.begin(), tiles.end(), [&](const Tile & tile) {
+        return tile.area.x == area_x && tile.area.y == area_y;
+      });
+      if (itr == tiles.end()) continue;
+      last_tile = &(*itr);
+    }
+
+    const Eigen::Vector2f origin = last_tile->area.real_scale();
+    const int px = std::clamp(
+      static_cast<int>((wx[i] - origin.x()) * pixel_per_meter), 0, image_size - 1);
+    const int py = std::clamp(
+      static_cast<int>((wy[i] - origin.y()) * pixel_per_meter), 0, image_size - 1);
+    const uchar * b3 = last_tile->data + static_cast<size_t>(py) * last_tile->step + px * 3;
+
+    if (b3[2] == 1) {
+      // logit does not change if target pixel is unmapped
+      continue;
+    }
+    const float intensity = static_cast<float>(b3[0]) / 255.f;
+    const float abs_cos = std::abs(tx[i] * cos_table_[b3[1]] + ty[i] * sin_table_[b3[1]]);
+    logit += samples_.weight[i] * g[i] * (abs_cos * intensity - 0.5f);
+  }
+  return logit;
+}
+
+}  // namespace yabloc::modularized_particle_filter
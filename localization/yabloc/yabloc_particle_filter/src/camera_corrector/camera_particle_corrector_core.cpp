@@ -29,6 +29,7 @@
 #include <cmath>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace yabloc::modularized_particle_filter
 {
@@ -37,7 +38,9 @@ CameraParticleCorrector::CameraParticleCorrector(const rclcpp::NodeOptions & opt
 : AbstractCorrector("camera_particle_corrector", options),
   min_prob_(static_cast<float>(declare_parameter<float>("min_prob"))),
   far_weight_gain_(static_cast<float>(declare_parameter<float>("far_weight_gain"))),
-  cost_map_(this)
+  use_batched_scorer_(declare_parameter<bool>("use_batched_scorer")),
+  cost_map_(this),
+  batched_scorer_(far_weight_gain_)
 {
   using std::placeholders::_1;
   using std::placeholders::_2;
@@ -75,6 +78,18 @@ CameraParticleCorrector::CameraParticleCorrector(const rclcpp::NodeOptions & opt
 
 void CameraParticleCorrector::on_pose(const PoseStamped & msg)
 {
+  if (latest_pose_.has_value()) {
+    // Build the cost map tiles ahead of ego in background
+    const double dt = (rclcpp::Time(msg.header.stamp) - latest_pose_->header.stamp).seconds();
+    if (dt > 0) {
+      const Eigen::Vector2f position(
+        static_cast<float>(msg.pose.position.x), static_cast<float>(msg.pose.position.y));
+      const Eigen::Vector2f last_position(
+        static_cast<float>(latest_pose_->pose.position.x),
+        static_cast<float>(latest_pose_->pose.position.y));
+      cost_map_.prefetch(position, (position - last_position) / static_cast<float>(dt));
+    }
+  }
   latest_pose_ = msg;
 }
 
@@ -170,7 +185,26 @@ void CameraParticleCorrector::on_line_segments(const PointCloud2 & line_segments
 
   cost_map_.set_height(static_cast<float>(mean_pose.position.z));
 
-  if (publish_weighted_particles) {
+  if (publish_weighted_particles && use_batched_scorer_) {
+    LineSegments all_line_segments_cloud = line_segments_cloud;
+    all_line_segments_cloud += iffy_line_segments_cloud;
+    batched_scorer_.set_line_segments(all_line_segments_cloud);
+
+    std::vector<Sophus::SE3f> transforms;
+    transforms.reserve(weighted_particles.particles.size());
+    for (const auto & particle : weighted_particles.particles) {
+      transforms.push_back(common::pose_to_se3(particle.pose));
+    }
+
+    const std::vector<float> logits = batched_scorer_.compute_logits(transforms, cost_map_);
+    for (size_t i = 0; i < logits.size(); ++i) {
+      weighted_particles.particles.at(i).weight = logit_to_prob(logits.at(i), 0.01f);
+    }
+
+    if (enable_switch_) {
+      this->set_weighted_particle_array(weighted_particles);
+    }
+  } else if (publish_weighted_particles) {
     for (auto & particle : weighted_particles.particles) {
       Sophus::SE3f transform = common::pose_to_se3(particle.pose);
       LineSegments transformed_line_segments =
@@ -271,6 +305,7 @@ float CameraParticleCorrector::compute_logit(
   const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
 {
   float logit = 0;
+  HierarchicalCostMap::Reader cost_map_reader(cost_map_);
   for (const LineSegment & pn : line_segments_cloud) {
     const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
     const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
@@ -282,7 +317,7 @@ float CameraParticleCorrector::compute_logit(
       float squared_norm = (p - self_position).topRows(2).squaredNorm();
       float gain = std::exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
 
-      const CostMapValue v3 = cost_map_.at(p.topRows(2));
+      const CostMapValue v3 = cost_map_reader.at(p.topRows(2));
 
       if (v3.unmapped) {
         // logit does not change if target pixel is unmapped
@@ -303,6 +338,7 @@ pcl::PointCloud<pcl::PointXYZI> CameraParticleCorrector::evaluate_cloud(
   const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
 {
   pcl::PointCloud<pcl::PointXYZI> cloud;
+  HierarchicalCostMap::Reader cost_map_reader(cost_map_);
   for (const LineSegment & pn : line_segments_cloud) {
     Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
     float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
@@ -313,7 +349,7 @@ pcl::PointCloud<pcl::PointXYZI> CameraParticleCorrector::evaluate_cloud(
       // NOTE: Close points are prioritized
       float squared_norm = (p - self_position).topRows(2).squaredNorm();
 
-      CostMapValue v3 = cost_map_.at(p.topRows(2));
+      CostMapValue v3 = cost_map_reader.at(p.topRows(2));
       float logit = 0;
       if (!v3.unmapped) {
         float gain = std::exp(-far_weight_gain_ * squared_norm);
@@ -60,6 +60,7 @@ CameraParticleCorrector::filt(const LineSegments & iffy_lines)
   const Sophus::SE3f pose = common::pose_to_se3(latest_pose_.value().pose);
 
   // pcl::PointCloud<pcl::PointXYZRGB> rgb_cloud;
+  HierarchicalCostMap::Reader cost_map_reader(cost_map_);
   for (const auto & line : iffy_lines) {
     const Eigen::Vector3f p1 = line.getVector3fMap();
     const Eigen::Vector3f p2 = line.getNormalVector3fMap();
@@ -70,7 +71,7 @@ CameraParticleCorrector::filt(const LineSegments & iffy_lines)
     int count = 0;
     for (float distance = 0; distance < length; distance += 0.1f) {
       Eigen::Vector3f px = pose * (p2 + tangent * distance);
-      CostMapValue v3 = cost_map_.at(px.topRows(2));
+      CostMapValue v3 = cost_map_reader.at(px.topRows(2));
       float cos2 = normalized_atan2(pose.so3() * tangent, static_cast<float>(v3.angle));
       score += (cos2 * v3.intensity);
       count++;
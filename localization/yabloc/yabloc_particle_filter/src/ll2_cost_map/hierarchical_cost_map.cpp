@@ -22,21 +22,52 @@
 
 #include <boost/geometry/geometry.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
 #include <vector>
 
 namespace yabloc
 {
+namespace
+{
+size_t declare_max_map_count(rclcpp::Node * node)
+{
+  const int max_map_count = static_cast<int>(node->declare_parameter<int>("max_map_count"));
+  if (max_map_count <= 0) {
+    throw std::invalid_argument("max_map_count must be positive");
+  }
+  return static_cast<size_t>(max_map_count);
+}
+}  // namespace
+
 float Area::unit_length = -1;
 
 HierarchicalCostMap::HierarchicalCostMap(rclcpp::Node * node)
 : max_range_(static_cast<float>(node->declare_parameter<float>("max_range"))),
   image_size_(static_cast<float>(node->declare_parameter<int>("image_size"))),
-  max_map_count_(10),
-  logger_(node->get_logger())
+  max_map_count_(declare_max_map_count(node)),
+  prefetch_horizon_(static_cast<float>(node->declare_parameter<float>("prefetch_horizon"))),
+  logger_(node->get_logger()),
+  cost_maps_(max_map_count_)
 {
   Area::unit_length = max_range_;
   float gamma = static_cast<float>(node->declare_parameter<float>("gamma"));
   gamma_converter_.reset(gamma);
+
+  prefetch_thread_ = std::thread(&HierarchicalCostMap::run_prefetch, this);
+}
+
+HierarchicalCostMap::~HierarchicalCostMap()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_prefetch_ = true;
+  }
+  prefetch_cv_.notify_all();
+  if (prefetch_thread_.joinable()) {
+    prefetch_thread_.join();
+  }
 }
 
 cv::Point2i HierarchicalCostMap::to_cv_point(const Area & area, const Eigen::Vector2f & p) const
@@ -47,30 +78,102 @@ cv::Point2i HierarchicalCostMap::to_cv_point(const Area & area, const Eigen::Vec
   return {static_cast<int>(px), static_cast<int>(py)};
 }
 
-CostMapValue HierarchicalCostMap::at(const Eigen::Vector2f & position)
+CostMapValue HierarchicalCostMap::Reader::at(const Eigen::Vector2f & position)
 {
-  if (!cloud_.has_value()) {
+  Area key(position);
+  if (!area_ || *area_ != key) {
+    area_ = key;
+    image_ = cost_map_.tile(key);
+  }
+  if (!image_) {
     return CostMapValue{0.5f, 0, true};
   }
 
-  Area key(position);
-  if (cost_maps_.count(key) == 0) {
-    build_map(key);
+  cv::Point2i tmp = cost_map_.to_cv_point(key, position);
+  const cv::Vec3b & b3 = image_->ptr<cv::Vec3b>(tmp.y)[tmp.x];
+  return {static_cast<float>(b3[0]) / 255.f, b3[1], b3[2] == 1};
+}
+
+CostMapValue HierarchicalCostMap::at(const Eigen::Vector2f & position)
+{
+  return Reader(*this).at(position);
+}
+
+HierarchicalCostMap::TileConstPtr HierarchicalCostMap::tile(const Area & area)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!cloud_) {
+    return nullptr;
   }
-  map_accessed_[key] = true;
 
-  cv::Point2i tmp = to_cv_point(key, position);
-  cv::Vec3b b3 = cost_maps_.at(key).ptr<cv::Vec3b>(tmp.y)[tmp.x];
-  return {static_cast<float>(b3[0]) / 255.f, b3[1], b3[2] == 1};
+  // Wait for the prefetch thread instead of building the same tile twice
+  built_cv_.wait(lock, [this, &area]() { return building_areas_.count(area) == 0; });
+
+  if (std::optional<TileConstPtr> image = cost_maps_.get(area)) {
+    return *image;
+  }
+  return build_and_cache_map(area, lock);
+}
+
+void HierarchicalCostMap::prefetch(
+  const Eigen::Vector2f & position, const Eigen::Vector2f & velocity)
+{
+  if (prefetch_horizon_ <= 0) return;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!cloud_) return;
+
+  // NOTE: Prefetching too many tiles would evict the tiles in use
+  const size_t max_queue_size = std::max<size_t>(max_map_count_ / 2, 1);
+  const float margin = max_range_ / 4;
+  const float reach = velocity.norm() * prefetch_horizon_;
+  const Eigen::Vector2f direction = velocity.stableNormalized();
+
+  // Sample the predicted positions finely enough not to skip any tile
+  const float step = max_range_ / 4;
+  const auto is_full = [&]() { return prefetch_queue_.size() >= max_queue_size; };
+  for (float distance = 0; distance <= reach + step && !is_full(); distance += step) {
+    const Eigen::Vector2f predicted = position + direction * std::min(distance, reach);
+    for (const float dx : {-margin, margin}) {
+      for (const float dy : {-margin, margin}) {
+        if (is_full()) break;
+        const Area area(predicted + Eigen::Vector2f(dx, dy));
+        if (cost_maps_.contains(area) || building_areas_.count(area) > 0) continue;
+        if (
+          std::find(prefetch_queue_.begin(), prefetch_queue_.end(), area) !=
+          prefetch_queue_.end())
+          continue;
+        prefetch_queue_.push_back(area);
+      }
+    }
+  }
+  prefetch_cv_.notify_one();
+}
+
+void HierarchicalCostMap::run_prefetch()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    prefetch_cv_.wait(lock, [this]() { return stop_prefetch_ || !prefetch_queue_.empty(); });
+    if (stop_prefetch_) return;
+
+    const Area area = prefetch_queue_.front();
+    prefetch_queue_.pop_front();
+    if (!cloud_ || cost_maps_.contains(area) || building_areas_.count(area) > 0) continue;
+
+    build_and_cache_map(area, lock);
+  }
 }
 
 void HierarchicalCostMap::set_height(float height)
 {
+  std::lock_guard<std::mutex> lock(mutex_);
   if (height_) {
     if (std::abs(*height_ - height) > 2) {
       generated_map_history_.clear();
       cost_maps_.clear();
-      map_accessed_.clear();
+      prefetch_queue_.clear();
+      ++generation_;
     }
   }
 
@@ -80,31 +183,67 @@ void HierarchicalCostMap::set_height(float height)
 void HierarchicalCostMap::set_bounding_box(const pcl::PointCloud<pcl::PointXYZL> & cloud)
 {
   if (cloud.empty()) return;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto bounding_boxes =
+    bounding_boxes_ ? std::make_shared<std::vector<BgPolygon>>(*bounding_boxes_)
+                    : std::make_shared<std::vector<BgPolygon>>();
   BgPolygon poly;
 
   std::optional<uint32_t> last_label = std::nullopt;
   for (const pcl::PointXYZL p : cloud) {
     if (last_label) {
       if ((*last_label) != p.label) {
-        bounding_boxes_.push_back(poly);
+        bounding_boxes->push_back(poly);
         poly.outer().clear();
       }
     }
     poly.outer().push_back(BgPoint(p.x, p.y));
     last_label = p.label;
   }
-  bounding_boxes_.push_back(poly);
+  bounding_boxes->push_back(poly);
+  bounding_boxes_ = bounding_boxes;
 }
 
 void HierarchicalCostMap::set_cloud(const pcl::PointCloud<pcl::PointNormal> & cloud)
 {
-  cloud_ = cloud;
+  std::lock_guard<std::mutex> lock(mutex_);
+  cloud_ = std::make_shared<const pcl::PointCloud<pcl::PointNormal>>(cloud);
 }
 
-void HierarchicalCostMap::build_map(const Area & area)
+HierarchicalCostMap::TileConstPtr HierarchicalCostMap::build_and_cache_map(
+  const Area & area, std::unique_lock<std::mutex> & lock)
 {
-  if (!cloud_.has_value()) return;
+  // Take snapshots of the inputs so that the heavy part runs without holding the lock
+  const auto cloud = cloud_;
+  const auto height = height_;
+  const auto bounding_boxes =
+    bounding_boxes_ ? bounding_boxes_ : std::make_shared<const std::vector<BgPolygon>>();
+  const size_t generation = generation_;
+  building_areas_.insert(area);
+
+  lock.unlock();
+  const auto image =
+    std::make_shared<const cv::Mat>(build_map(area, *cloud, height, *bounding_boxes));
+  lock.lock();
+
+  building_areas_.erase(area);
+  if (generation == generation_) {
+    cost_maps_.put(area, image);
+    generated_map_history_.remove(area);
+    generated_map_history_.push_back(area);
+  }
+  built_cv_.notify_all();
 
+  RCLCPP_INFO_STREAM(
+    logger_, "succeeded to build map " << area(area) << " " << area.real_scale().transpose());
+  return image;
+}
+
+cv::Mat HierarchicalCostMap::build_map(
+  const Area & area, const pcl::PointCloud<pcl::PointNormal> & cloud,
+  const std::optional<float> & height, const std::vector<BgPolygon> & bounding_boxes) const
+{
   cv::Mat image =
     255 *
     cv::Mat::ones(cv::Size(static_cast<int>(image_size_), static_cast<int>(image_size_)), CV_8UC1);
@@ -116,10 +255,10 @@ void HierarchicalCostMap::build_map(const Area & area)
   };
 
   // TODO(KYabuuchi) We can speed up by skipping too far line_segments
-  for (const auto pn : cloud_.value()) {
-    if (height_) {
-      if (std::abs(pn.z - *height_) > 4) continue;
-      if (std::abs(pn.normal_z - *height_) > 4) continue;
+  for (const auto pn : cloud) {
+    if (height) {
+      if (std::abs(pn.z - *height) > 4) continue;
+      if (std::abs(pn.normal_z - *height) > 4) continue;
     }
 
     cv::Point2i from = cv_point(pn.getVector3fMap());
@@ -143,23 +282,19 @@ void HierarchicalCostMap::build_map(const Area & area)
   cv::Mat whole_orientation = direct_cost_map(orientation, image);
 
   // channel-3
-  cv::Mat available_area = create_available_area_image(area);
+  cv::Mat available_area = create_available_area_image(area, bounding_boxes);
 
   cv::Mat directed_cost_map;
   cv::merge(
     std::vector<cv::Mat>{gamma_converter_(distance), whole_orientation, available_area},
     directed_cost_map);
-
-  cost_maps_[area] = directed_cost_map;
-  generated_map_history_.push_back(area);
-
-  RCLCPP_INFO_STREAM(
-    logger_, "succeeded to build map " << area(area) << " " << area.real_scale().transpose());
+  return directed_cost_map;
 }
 
 HierarchicalCostMap::MarkerArray HierarchicalCostMap::show_map_range() const
 {
   MarkerArray array_msg;
+  std::lock_guard<std::mutex> lock(mutex_);
 
   auto point_msg = [](float x, float y) -> geometry_msgs::msg::Point {
     geometry_msgs::msg::Point gp;
@@ -210,10 +345,12 @@ cv::Mat HierarchicalCostMap::get_map_image(const Pose & pose)
 
   cv::Mat image =
     cv::Mat::zeros(cv::Size(static_cast<int>(image_size_), static_cast<int>(image_size_)), CV_8UC3);
+  // NOTE: The neighboring pixels mostly lie in the same tile, which is resolved only once
+  Reader reader(*this);
   for (int w_index = 0; static_cast<float>(w_index) < image_size_; w_index++) {
     for (int h_index = 0; static_cast<float>(h_index) < image_size_; h_index++) {
       CostMapValue v3 =
-        this->at(to_vector2f(static_cast<float>(h_index), static_cast<float>(w_index)));
+        reader.at(to_vector2f(static_cast<float>(h_index), static_cast<float>(w_index)));
       if (v3.unmapped)
         image.at<cv::Vec3b>(h_index, w_index) =
           cv::Vec3b(v3.angle, static_cast<unsigned char>(255 * v3.intensity), 50);
@@ -231,25 +368,18 @@ cv::Mat HierarchicalCostMap::get_map_image(const Pose & pose)
 
 void HierarchicalCostMap::erase_obsolete()
 {
-  if (cost_maps_.size() < max_map_count_) return;
-
-  for (auto itr = generated_map_history_.begin(); itr != generated_map_history_.end();) {
-    if (map_accessed_[*itr]) {
-      ++itr;
-      continue;
-    }
-    cost_maps_.erase(*itr);
-    itr = generated_map_history_.erase(itr);
-  }
-
-  map_accessed_.clear();
+  // NOTE: Tiles themselves are evicted by the LRU cache. Only the history is pruned here.
+  std::lock_guard<std::mutex> lock(mutex_);
+  generated_map_history_.remove_if(
+    [this](const Area & area) { return !cost_maps_.contains(area); });
 }
 
-cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) const
+cv::Mat HierarchicalCostMap::create_available_area_image(
+  const Area & area, const std::vector<BgPolygon> & bounding_boxes) const
 {
   cv::Mat available_area =
     cv::Mat::zeros(cv::Size(static_cast<int>(image_size_), static_cast<int>(image_size_)), CV_8UC1);
-  if (bounding_boxes_.empty()) return available_area;
+  if (bounding_boxes.empty()) return available_area;
 
   // Define current area
   using BgBox = boost::geometry::model::box<BgPoint>;
@@ -261,7 +391,7 @@ cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) cons
 
   std::vector<std::vector<cv::Point2i>> contours;
 
-  for (const BgPolygon & box : bounding_boxes_) {
+  for (const BgPolygon & box : bounding_boxes) {
     if (boost::geometry::disjoint(area_polygon, box)) {
       continue;
     }
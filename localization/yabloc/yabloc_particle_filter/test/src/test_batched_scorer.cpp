@@ -0,0 +1,168 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yabloc_particle_filter/camera_corrector/batched_scorer.hpp"
+#include "yabloc_particle_filter/camera_corrector/camera_particle_corrector.hpp"
+
+#include <yabloc_common/transform_line_segments.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace mpf = yabloc::modularized_particle_filter;
+
+pcl::PointXYZLNormal make_line_segment(
+  const Eigen::Vector3f & from, const Eigen::Vector3f & to, uint32_t label)
+{
+  pcl::PointXYZLNormal line;
+  line.getVector3fMap() = from;
+  line.getNormalVector3fMap() = to;
+  line.label = label;
+  return line;
+}
+
+TEST(BatchedScorerTestSuite, sampleLineSegments)
+{
+  pcl::PointCloud<pcl::PointXYZLNormal> line_segments;
+  line_segments.push_back(make_line_segment({0, 0, 0}, {1, 0, 0}, 1));
+  line_segments.push_back(make_line_segment({0, 0, 0}, {0, 0.5, 0}, 0));
+
+  const mpf::SampledLineSegments samples = mpf::sample_line_segments(line_segments, 0.1f);
+
+  size_t expected_count = 0;
+  for (float d = 0; d < 1.0f; d += 0.1f) ++expected_count;
+  for (float d = 0; d < 0.5f; d += 0.1f) ++expected_count;
+  ASSERT_EQ(samples.size(), expected_count);
+  ASSERT_EQ(samples.weight.size(), expected_count);
+
+  // apriori line segment
+  EXPECT_FLOAT_EQ(samples.x.front(), 0.0f);
+  EXPECT_FLOAT_EQ(samples.tx.front(), 1.0f);
+  EXPECT_FLOAT_EQ(samples.ty.front(), 0.0f);
+  EXPECT_FLOAT_EQ(samples.weight.front(), 1.0f);
+
+  // posteriori line segment
+  EXPECT_FLOAT_EQ(samples.tx.back(), 0.0f);
+  EXPECT_FLOAT_EQ(samples.ty.back(), 1.0f);
+  EXPECT_NEAR(samples.y.back(), 0.4f, 1e-5f);
+  EXPECT_FLOAT_EQ(samples.weight.back(), 0.2f);
+}
+
+TEST(BatchedScorerTestSuite, emptyLineSegments)
+{
+  const mpf::SampledLineSegments samples =
+    mpf::sample_line_segments(pcl::PointCloud<pcl::PointXYZLNormal>{});
+  EXPECT_EQ(samples.size(), 0u);
+}
+
+namespace yabloc::modularized_particle_filter
+{
+class CameraParticleCorrectorTestSuite : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    rclcpp::NodeOptions options;
+    options.parameter_overrides(
+      {{"acceptable_max_delay", 1.0},
+       {"visualize", false},
+       {"image_size", 800},
+       {"max_range", 40.0},
+       {"gamma", 5.0},
+       {"max_map_count", 10},
+       {"prefetch_horizon", 0.0},
+       {"min_prob", 0.1},
+       {"far_weight_gain", 0.001},
+       {"enabled_at_first", true},
+       {"use_batched_scorer", true}});
+    corrector_ = std::make_shared<CameraParticleCorrector>(options);
+  }
+
+  void TearDown() override
+  {
+    corrector_.reset();
+    rclcpp::shutdown();
+  }
+
+  HierarchicalCostMap & cost_map() { return corrector_->cost_map_; }
+
+  float compute_logit(
+    const CameraParticleCorrector::LineSegments & line_segments,
+    const Eigen::Vector3f & self_position)
+  {
+    return corrector_->compute_logit(line_segments, self_position);
+  }
+
+private:
+  std::shared_ptr<CameraParticleCorrector> corrector_;
+};
+
+TEST_F(CameraParticleCorrectorTestSuite, computeLogitsMatchesComputeLogit)
+{
+  // road markings around the tile boundaries at x = 0 and y = 0
+  pcl::PointCloud<pcl::PointNormal> ll2_cloud;
+  const auto add_marking = [&ll2_cloud](const Eigen::Vector3f & from, const Eigen::Vector3f & to) {
+    pcl::PointNormal pn;
+    pn.getVector3fMap() = from;
+    pn.getNormalVector3fMap() = to;
+    ll2_cloud.push_back(pn);
+  };
+  for (const float y : {-5.25f, -1.75f, 1.75f, 5.25f}) {
+    add_marking({-30.0f, y, 0.0f}, {50.0f, y, 0.0f});
+  }
+  add_marking({8.0f, -6.0f, 0.0f}, {8.0f, 6.0f, 0.0f});
+  add_marking({-12.0f, -6.0f, 0.0f}, {-4.0f, 6.0f, 0.0f});
+  cost_map().set_cloud(ll2_cloud);
+
+  // detected line segments in the base_link frame
+  pcl::PointCloud<pcl::PointXYZLNormal> line_segments;
+  line_segments.push_back(make_line_segment({0.0f, 1.8f, 0.0f}, {12.0f, 1.7f, 0.0f}, 1));
+  line_segments.push_back(make_line_segment({0.0f, -1.7f, 0.0f}, {12.0f, -1.8f, 0.0f}, 1));
+  line_segments.push_back(make_line_segment({7.5f, -3.0f, 0.0f}, {8.5f, 3.0f, 0.0f}, 0));
+  line_segments.push_back(make_line_segment({-3.0f, 5.0f, 0.0f}, {3.0f, 5.5f, 0.0f}, 0));
+
+  // particles around the tile boundaries
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> position_dist(-6.0f, 6.0f);
+  std::uniform_real_distribution<float> yaw_dist(-0.2f, 0.2f);
+  std::vector<Sophus::SE3f> transforms;
+  for (size_t i = 0; i < 30; ++i) {
+    transforms.emplace_back(
+      Sophus::SO3f::rotZ(yaw_dist(engine)),
+      Eigen::Vector3f(position_dist(engine), position_dist(engine), 0.0f));
+  }
+
+  BatchedScorer batched_scorer(0.001f);
+  batched_scorer.set_line_segments(line_segments);
+  const std::vector<float> logits = batched_scorer.compute_logits(transforms, cost_map());
+  ASSERT_EQ(logits.size(), transforms.size());
+  // the cost map is ready, so the particles are actually scored
+  EXPECT_TRUE(std::any_of(logits.begin(), logits.end(), [](float logit) { return logit != 0.0f; }));
+
+  for (size_t i = 0; i < transforms.size(); ++i) {
+    const float expected = compute_logit(
+      common::transform_line_segments(line_segments, transforms.at(i)),
+      transforms.at(i).translation());
+    // NOTE: The samples are transformed in a different order, so a sample lying on a pixel border
+    //       may read the neighboring pixel
+    EXPECT_NEAR(logits.at(i), expected, 0.02f + 1e-3f * std::abs(expected)) << "particle " << i;
+  }
+}
+}  // namespace yabloc::modularized_particle_filter
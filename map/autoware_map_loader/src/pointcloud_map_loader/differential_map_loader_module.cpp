@@ -15,15 +15,21 @@
 #include "differential_map_loader_module.hpp"
 
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace autoware::map_loader
 {
 DifferentialMapLoaderModule::DifferentialMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<const TileContainerReader> tile_container)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  metadata_index_(all_pcd_file_metadata_dict_),
+  tile_container_(std::move(tile_container))
 {
   get_differential_pcd_maps_service_ = node->create_service<GetDifferentialPointCloudMap>(
     "service/get_differential_pcd_map",
@@ -36,30 +42,33 @@ void DifferentialMapLoaderModule::differential_area_load(
   const autoware_map_msgs::msg::AreaInfo & area_info, const std::vector<std::string> & cached_ids,
   const GetDifferentialPointCloudMap::Response::SharedPtr & response) const
 {
-  // iterate over all the available pcd map grids
+  // map from the cached ID to its position in the request
+  std::unordered_map<std::string, size_t> cached_id_index;
+  cached_id_index.reserve(cached_ids.size());
+  for (size_t i = 0; i < cached_ids.size(); ++i) {
+    cached_id_index.emplace(cached_ids[i], i);
+  }
+
+  // iterate over the pcd map grids within the queried area
   std::vector<bool> should_remove(static_cast<int>(cached_ids.size()), true);
-  for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
+  for (const size_t grid_index : metadata_index_.query(area_info)) {
+    const std::string & path = metadata_index_.id(grid_index);
+    const PCDFileMetadata & metadata = metadata_index_.metadata(grid_index);
 
     // assume that the map ID = map path (for now)
     const std::string & map_id = path;
 
-    // skip if the pcd file is not within the queried area
-    if (!is_grid_within_queried_area(area_info, metadata)) continue;
-
-    auto id_in_cached_list = std::find(cached_ids.begin(), cached_ids.end(), map_id);
-    if (id_in_cached_list != cached_ids.end()) {
-      int index = static_cast<int>(id_in_cached_list - cached_ids.begin());
-      should_remove[index] = false;
+    const auto id_in_cached_list = cached_id_index.find(map_id);
+    if (id_in_cached_list != cached_id_index.end()) {
+      should_remove[id_in_cached_list->second] = false;
     } else {
       autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-        load_point_cloud_map_cell_with_id(path, map_id);
+        load_point_cloud_map_cell_with_id(path, map_id, tile_container_.get(), logger_);
       pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
       pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
       pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
       pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
-      response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+      response->new_pointcloud_with_ids.push_back(std::move(pointcloud_map_cell_with_id));
     }
   }
 
@@ -80,18 +89,4 @@ bool DifferentialMapLoaderModule::on_service_get_differential_point_cloud_map(
   res->header.frame_id = "map";
   return true;
 }
-
-autoware_map_msgs::msg::PointCloudMapCellWithID
-DifferentialMapLoaderModule::load_point_cloud_map_cell_with_id(
-  const std::string & path, const std::string & map_id) const
-{
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
-    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
-  }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
-  pointcloud_map_cell_with_id.cell_id = map_id;
-  return pointcloud_map_cell_with_id;
-}
 }  // namespace autoware::map_loader
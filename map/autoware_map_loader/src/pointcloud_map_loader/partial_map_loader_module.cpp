@@ -15,14 +15,19 @@
 #include "partial_map_loader_module.hpp"
 
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 
 namespace autoware::map_loader
 {
 PartialMapLoaderModule::PartialMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<const TileContainerReader> tile_container)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  metadata_index_(all_pcd_file_metadata_dict_),
+  tile_container_(std::move(tile_container))
 {
   get_partial_pcd_maps_service_ = node->create_service<GetPartialPointCloudMap>(
     "service/get_partial_pcd_map",
@@ -35,25 +40,22 @@ void PartialMapLoaderModule::partial_area_load(
   const autoware_map_msgs::msg::AreaInfo & area,
   const GetPartialPointCloudMap::Response::SharedPtr & response) const
 {
-  // iterate over all the available pcd map grids
-  for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
+  // iterate over the pcd map grids within the queried area
+  for (const size_t grid_index : metadata_index_.query(area)) {
+    const std::string & path = metadata_index_.id(grid_index);
+    const PCDFileMetadata & metadata = metadata_index_.metadata(grid_index);
 
     // assume that the map ID = map path (for now)
     const std::string & map_id = path;
 
-    // skip if the pcd file is not within the queried area
-    if (!is_grid_within_queried_area(area, metadata)) continue;
-
     autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-      load_point_cloud_map_cell_with_id(path, map_id);
+      load_point_cloud_map_cell_with_id(path, map_id, tile_container_.get(), logger_);
     pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
     pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
     pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
     pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
 
-    response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+    response->new_pointcloud_with_ids.push_back(std::move(pointcloud_map_cell_with_id));
   }
 }
 
@@ -66,18 +68,4 @@ bool PartialMapLoaderModule::on_service_get_partial_point_cloud_map(
   res->header.frame_id = "map";
   return true;
 }
-
-autoware_map_msgs::msg::PointCloudMapCellWithID
-PartialMapLoaderModule::load_point_cloud_map_cell_with_id(
-  const std::string & path, const std::string & map_id) const
-{
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
-    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
-  }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
-  pointcloud_map_cell_with_id.cell_id = map_id;
-  return pointcloud_map_cell_with_id;
-}
 }  // namespace autoware::map_loader
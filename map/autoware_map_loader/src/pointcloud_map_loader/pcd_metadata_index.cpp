@@ -0,0 +1,125 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pcd_metadata_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace autoware::map_loader
+{
+PCDMetadataIndex::PCDMetadataIndex(
+  const std::map<std::string, PCDFileMetadata> & pcd_metadata_dict)
+: entries_(pcd_metadata_dict.begin(), pcd_metadata_dict.end())
+{
+  if (entries_.empty()) {
+    return;
+  }
+
+  // Use the median tile size as the cell size so that a typical tile spans only a few cells
+  std::vector<double> tile_sizes;
+  tile_sizes.reserve(entries_.size());
+  for (const auto & entry : entries_) {
+    const auto & metadata = entry.second;
+    tile_sizes.push_back(
+      std::max(metadata.max.x - metadata.min.x, metadata.max.y - metadata.min.y));
+  }
+  std::nth_element(
+    tile_sizes.begin(), tile_sizes.begin() + static_cast<int64_t>(tile_sizes.size() / 2),
+    tile_sizes.end());
+  const double median_tile_size = tile_sizes.at(tile_sizes.size() / 2);
+  if (std::isfinite(median_tile_size) && median_tile_size > 0.0) {
+    cell_size_ = median_tile_size;
+  }
+
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    const auto & metadata = entries_[i].second;
+    const int64_t min_ix = to_cell_index(metadata.min.x);
+    const int64_t min_iy = to_cell_index(metadata.min.y);
+    const int64_t max_ix = to_cell_index(metadata.max.x);
+    const int64_t max_iy = to_cell_index(metadata.max.y);
+    for (int64_t ix = min_ix; ix <= max_ix; ++ix) {
+      for (int64_t iy = min_iy; iy <= max_iy; ++iy) {
+        cells_[to_cell_key(ix, iy)].push_back(static_cast<uint32_t>(i));
+      }
+    }
+  }
+}
+
+int64_t PCDMetadataIndex::to_cell_index(const double v) const
+{
+  return static_cast<int64_t>(std::floor(v / cell_size_));
+}
+
+uint64_t PCDMetadataIndex::to_cell_key(const int64_t ix, const int64_t iy)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(ix)) << 32) |
+         static_cast<uint64_t>(static_cast<uint32_t>(iy));
+}
+
+void PCDMetadataIndex::collect_candidates(
+  const autoware_map_msgs::msg::AreaInfo & area, std::vector<size_t> & candidates) const
+{
+  // NOTE: a tile overlapping the cylinder always overlaps its bounding box
+  const int64_t min_ix = to_cell_index(area.center_x - area.radius);
+  const int64_t min_iy = to_cell_index(area.center_y - area.radius);
+  const int64_t max_ix = to_cell_index(area.center_x + area.radius);
+  const int64_t max_iy = to_cell_index(area.center_y + area.radius);
+
+  // Scanning all the tiles is cheaper than visiting the cells when the area covers the whole map
+  const auto cell_count = static_cast<double>(max_ix - min_ix + 1) * (max_iy - min_iy + 1);
+  if (cell_count > static_cast<double>(cells_.size())) {
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      if (is_grid_within_queried_area(area, entries_[i].second)) {
+        candidates.push_back(i);
+      }
+    }
+    return;
+  }
+
+  for (int64_t ix = min_ix; ix <= max_ix; ++ix) {
+    for (int64_t iy = min_iy; iy <= max_iy; ++iy) {
+      const auto itr = cells_.find(to_cell_key(ix, iy));
+      if (itr == cells_.end()) continue;
+      for (const uint32_t i : itr->second) {
+        if (is_grid_within_queried_area(area, entries_[i].second)) {
+          candidates.push_back(i);
+        }
+      }
+    }
+  }
+}
+
+std::vector<size_t> PCDMetadataIndex::query(const autoware_map_msgs::msg::AreaInfo & area) const
+{
+  return query(std::vector<autoware_map_msgs::msg::AreaInfo>{area});
+}
+
+std::vector<size_t> PCDMetadataIndex::query(
+  const std::vector<autoware_map_msgs::msg::AreaInfo> & areas) const
+{
+  std::vector<size_t> result;
+  for (const auto & area : areas) {
+    collect_candidates(area, result);
+  }
+
+  // A tile spanning several cells or areas is found more than once
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+}  // namespace autoware::map_loader
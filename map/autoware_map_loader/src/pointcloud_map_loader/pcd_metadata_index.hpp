@@ -0,0 +1,77 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__PCD_METADATA_INDEX_HPP_
+#define POINTCLOUD_MAP_LOADER__PCD_METADATA_INDEX_HPP_
+
+#include "utils.hpp"
+
+#include <autoware_map_msgs/msg/area_info.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::map_loader
+{
+/**
+ * @brief Uniform grid index over the bounds of the pointcloud map tiles.
+ *
+ * Each tile is registered to every grid cell its bounds overlap, so that an area query only visits
+ * the tiles around the area instead of all the tiles of the map.
+ */
+class PCDMetadataIndex
+{
+public:
+  explicit PCDMetadataIndex(const std::map<std::string, PCDFileMetadata> & pcd_metadata_dict);
+
+  /**
+   * @brief Find the tiles overlapping the queried area
+   * @param area queried area
+   * @return indices of the tiles in ascending order, i.e. in the order of the metadata dict
+   */
+  [[nodiscard]] std::vector<size_t> query(const autoware_map_msgs::msg::AreaInfo & area) const;
+
+  /**
+   * @brief Find the tiles overlapping any of the queried areas
+   * @param areas queried areas
+   * @return indices of the tiles in ascending order without duplicates
+   */
+  [[nodiscard]] std::vector<size_t> query(
+    const std::vector<autoware_map_msgs::msg::AreaInfo> & areas) const;
+
+  [[nodiscard]] const std::string & id(const size_t index) const { return entries_[index].first; }
+  [[nodiscard]] const PCDFileMetadata & metadata(const size_t index) const
+  {
+    return entries_[index].second;
+  }
+  [[nodiscard]] size_t size() const { return entries_.size(); }
+  [[nodiscard]] double cell_size() const { return cell_size_; }
+
+private:
+  std::vector<std::pair<std::string, PCDFileMetadata>> entries_;
+  std::unordered_map<uint64_t, std::vector<uint32_t>> cells_;
+  double cell_size_{1.0};
+
+  [[nodiscard]] int64_t to_cell_index(const double v) const;
+  [[nodiscard]] static uint64_t to_cell_key(const int64_t ix, const int64_t iy);
+  void collect_candidates(
+    const autoware_map_msgs::msg::AreaInfo & area, std::vector<size_t> & candidates) const;
+};
+}  // namespace autoware::map_loader
+
+#endif  // POINTCLOUD_MAP_LOADER__PCD_METADATA_INDEX_HPP_
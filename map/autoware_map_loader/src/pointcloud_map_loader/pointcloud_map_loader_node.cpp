@@ -54,6 +54,7 @@ PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & opt
   bool enable_downsample_whole_load = declare_parameter<bool>("enable_downsampled_whole_load");
   bool enable_partial_load = declare_parameter<bool>("enable_partial_load");
   bool enable_selected_load = declare_parameter<bool>("enable_selected_load");
+  std::string pcd_tile_container_path = declare_parameter<std::string>("pcd_tile_container_path");
 
   if (enable_whole_load) {
     std::string publisher_name = "output/pointcloud_map";
@@ -67,17 +68,30 @@ PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & opt
       std::make_unique<PointcloudMapLoaderModule>(this, pcd_paths, publisher_name, true);
   }
 
-  // Parse the metadata file and get the map of (absolute pcd path, pcd file metadata)
-  auto pcd_metadata_dict = get_pcd_metadata(pcd_metadata_path, pcd_paths);
+  // Serve the tiles from the tile container if it is given, otherwise from the PCD files
+  std::map<std::string, PCDFileMetadata> pcd_metadata_dict;
+  if (!pcd_tile_container_path.empty()) {
+    tile_container_ = std::make_shared<TileContainerReader>(pcd_tile_container_path);
+    pcd_metadata_dict = tile_container_->metadata();
+    RCLCPP_INFO_STREAM(
+      get_logger(), "Loaded " << pcd_metadata_dict.size()
+                              << " tiles from the tile container: " << pcd_tile_container_path);
+  } else {
+    // Parse the metadata file and get the map of (absolute pcd path, pcd file metadata)
+    pcd_metadata_dict = get_pcd_metadata(pcd_metadata_path, pcd_paths);
+  }
 
   if (enable_partial_load) {
-    partial_map_loader_ = std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict);
+    partial_map_loader_ =
+      std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict, tile_container_);
   }
 
-  differential_map_loader_ = std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict);
+  differential_map_loader_ =
+    std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict, tile_container_);
 
   if (enable_selected_load) {
-    selected_map_loader_ = std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict);
+    selected_map_loader_ =
+      std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict, tile_container_);
   }
 }
 
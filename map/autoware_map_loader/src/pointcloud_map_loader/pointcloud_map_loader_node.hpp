@@ -19,6 +19,7 @@
 #include "partial_map_loader_module.hpp"
 #include "pointcloud_map_loader_module.hpp"
 #include "selected_map_loader_module.hpp"
+#include "tile_container.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -46,6 +47,7 @@ private:
   std::unique_ptr<PartialMapLoaderModule> partial_map_loader_;
   std::unique_ptr<DifferentialMapLoaderModule> differential_map_loader_;
   std::unique_ptr<SelectedMapLoaderModule> selected_map_loader_;
+  std::shared_ptr<const TileContainerReader> tile_container_;
 
   std::vector<std::string> get_pcd_paths(
     const std::vector<std::string> & pcd_paths_or_directory) const;
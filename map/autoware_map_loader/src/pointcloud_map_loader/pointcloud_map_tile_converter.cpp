@@ -0,0 +1,80 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tile_container.hpp"
+#include "utils.hpp"
+
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+bool is_pcd_file(const fs::path & p)
+{
+  return !fs::is_directory(p) && (p.extension() == ".pcd" || p.extension() == ".PCD");
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  if (argc < 4) {
+    std::cerr << "Usage: " << argv[0]
+              << " <pcd_metadata_path> <output_path> <pcd_path_or_directory>..." << std::endl;
+    return 1;
+  }
+
+  const std::string pcd_metadata_path = argv[1];
+  const std::string output_path = argv[2];
+
+  std::vector<std::string> pcd_paths;
+  for (int i = 3; i < argc; ++i) {
+    const fs::path p(argv[i]);
+    if (is_pcd_file(p)) {
+      pcd_paths.push_back(p.string());
+    } else if (fs::is_directory(p)) {
+      for (const auto & file : fs::directory_iterator(p)) {
+        if (is_pcd_file(file.path())) {
+          pcd_paths.push_back(file.path().string());
+        }
+      }
+    }
+  }
+
+  try {
+    std::set<std::string> missing_pcd_names;
+    const auto pcd_metadata_dict = autoware::map_loader::replace_with_absolute_path(
+      autoware::map_loader::load_pcd_metadata(pcd_metadata_path), pcd_paths, missing_pcd_names);
+    if (!missing_pcd_names.empty()) {
+      std::cerr << "The following segment(s) are missing from the input PCDs:" << std::endl;
+      for (const auto & name : missing_pcd_names) {
+        std::cerr << name << std::endl;
+      }
+      return 1;
+    }
+
+    autoware::map_loader::write_tile_container(output_path, pcd_metadata_dict);
+    std::cout << "Packed " << pcd_metadata_dict.size() << " tiles into " << output_path
+              << std::endl;
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
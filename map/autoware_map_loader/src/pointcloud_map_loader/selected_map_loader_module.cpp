@@ -15,6 +15,7 @@
 #include "selected_map_loader_module.hpp"
 
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -47,8 +48,11 @@ autoware_map_msgs::msg::PointCloudMapMetaData create_metadata(
 }
 
 SelectedMapLoaderModule::SelectedMapLoaderModule(
-  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict))
+  rclcpp::Node * node, std::map<std::string, PCDFileMetadata> pcd_file_metadata_dict,
+  std::shared_ptr<const TileContainerReader> tile_container)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(std::move(pcd_file_metadata_dict)),
+  tile_container_(std::move(tile_container))
 {
   get_selected_pcd_maps_service_ = node->create_service<GetSelectedPointCloudMap>(
     "service/get_selected_pcd_map",
@@ -84,29 +88,15 @@ bool SelectedMapLoaderModule::on_service_get_selected_point_cloud_map(
     PCDFileMetadata metadata = requested_selected_map_iterator->second;
 
     autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-      load_point_cloud_map_cell_with_id(path, map_id);
+      load_point_cloud_map_cell_with_id(path, map_id, tile_container_.get(), logger_);
     pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
     pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
     pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
     pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
 
-    res->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+    res->new_pointcloud_with_ids.push_back(std::move(pointcloud_map_cell_with_id));
   }
   res->header.frame_id = "map";
   return true;
 }
-
-autoware_map_msgs::msg::PointCloudMapCellWithID
-SelectedMapLoaderModule::load_point_cloud_map_cell_with_id(
-  const std::string & path, const std::string & map_id) const
-{
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
-    RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
-  }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
-  pointcloud_map_cell_with_id.cell_id = map_id;
-  return pointcloud_map_cell_with_id;
-}
 }  // namespace autoware::map_loader
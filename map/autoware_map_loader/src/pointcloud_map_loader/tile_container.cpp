@@ -0,0 +1,296 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tile_container.hpp"
+
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+#include <rclcpp/logging.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace autoware::map_loader
+{
+namespace
+{
+uint64_t align_up(const uint64_t value)
+{
+  return (value + tile_block_alignment - 1) / tile_block_alignment * tile_block_alignment;
+}
+
+template <typename T>
+void write_pod(std::ofstream & ofs, const T & value)
+{
+  ofs.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void pad_to(std::ofstream & ofs, const uint64_t offset)
+{
+  const auto current = static_cast<uint64_t>(ofs.tellp());
+  const std::vector<char> zeros(offset - current, 0);
+  ofs.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+}
+}  // namespace
+
+void write_tile_container(
+  const std::string & output_path,
+  const std::map<std::string, PCDFileMetadata> & pcd_metadata_dict)
+{
+  std::ofstream ofs(output_path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    throw std::runtime_error("Failed to open the tile container: " + output_path);
+  }
+
+  // The header is written at last, when all the offsets are known
+  TileContainerHeader header{};
+  write_pod(ofs, header);
+
+  std::vector<TileRecord> records;
+  std::vector<TileField> fields;
+  std::string string_table;
+  records.reserve(pcd_metadata_dict.size());
+
+  // The file names are the tile IDs, so the PCD files in different directories must not collide
+  std::set<std::string> ids;
+  for (const auto & [path, metadata] : pcd_metadata_dict) {
+    const std::string id = std::filesystem::path(path).filename().string();
+    if (!ids.insert(id).second) {
+      throw std::runtime_error("Duplicate PCD file name in the tile container: " + id);
+    }
+  }
+
+  // Write the point blocks one by one not to hold all the tiles in memory
+  for (const auto & [path, metadata] : pcd_metadata_dict) {
+    sensor_msgs::msg::PointCloud2 pcd;
+    if (pcl::io::loadPCDFile(path, pcd) == -1) {
+      throw std::runtime_error("PCD load failed: " + path);
+    }
+
+    TileRecord record{};
+    record.min_x = metadata.min.x;
+    record.min_y = metadata.min.y;
+    record.min_z = metadata.min.z;
+    record.max_x = metadata.max.x;
+    record.max_y = metadata.max.y;
+    record.max_z = metadata.max.z;
+
+    const std::string id = std::filesystem::path(path).filename().string();
+    record.id_offset = string_table.size();
+    record.id_length = static_cast<uint32_t>(id.size());
+    string_table += id;
+
+    record.first_field = static_cast<uint32_t>(fields.size());
+    record.field_count = static_cast<uint32_t>(pcd.fields.size());
+    for (const auto & pcd_field : pcd.fields) {
+      if (pcd_field.name.size() >= sizeof(TileField::name)) {
+        throw std::runtime_error("Too long field name in " + path + ": " + pcd_field.name);
+      }
+      TileField field{};
+      std::strncpy(field.name, pcd_field.name.c_str(), sizeof(field.name) - 1);
+      field.offset = pcd_field.offset;
+      field.count = pcd_field.count;
+      field.datatype = pcd_field.datatype;
+      fields.push_back(field);
+    }
+
+    record.height = pcd.height;
+    record.width = pcd.width;
+    record.point_step = pcd.point_step;
+    record.row_step = pcd.row_step;
+    record.is_bigendian = pcd.is_bigendian;
+    record.is_dense = pcd.is_dense;
+
+    record.data_offset = align_up(static_cast<uint64_t>(ofs.tellp()));
+    record.data_size = pcd.data.size();
+    pad_to(ofs, record.data_offset);
+    ofs.write(
+      reinterpret_cast<const char *>(pcd.data.data()),
+      static_cast<std::streamsize>(pcd.data.size()));
+
+    records.push_back(record);
+  }
+
+  std::memcpy(header.magic, tile_container_magic, sizeof(header.magic));
+  header.version = tile_container_version;
+  header.tile_count = static_cast<uint32_t>(records.size());
+
+  header.record_offset = align_up(static_cast<uint64_t>(ofs.tellp()));
+  pad_to(ofs, header.record_offset);
+  ofs.write(
+    reinterpret_cast<const char *>(records.data()),
+    static_cast<std::streamsize>(records.size() * sizeof(TileRecord)));
+
+  header.field_offset = align_up(static_cast<uint64_t>(ofs.tellp()));
+  header.field_count = fields.size();
+  pad_to(ofs, header.field_offset);
+  ofs.write(
+    reinterpret_cast<const char *>(fields.data()),
+    static_cast<std::streamsize>(fields.size() * sizeof(TileField)));
+
+  header.string_offset = static_cast<uint64_t>(ofs.tellp());
+  header.string_size = string_table.size();
+  ofs.write(string_table.data(), static_cast<std::streamsize>(string_table.size()));
+
+  ofs.seekp(0);
+  write_pod(ofs, header);
+  if (!ofs) {
+    throw std::runtime_error("Failed to write the tile container: " + output_path);
+  }
+}
+
+TileContainerReader::TileContainerReader(const std::string & path)
+{
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open the tile container: " + path);
+  }
+
+  struct stat st
+  {
+  };
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(TileContainerHeader)) {
+    close(fd);
+    throw std::runtime_error("Invalid tile container: " + path);
+  }
+  size_ = static_cast<size_t>(st.st_size);
+
+  // The mapping stays valid after the file is closed
+  void * mapped = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    throw std::runtime_error("Failed to mmap the tile container: " + path);
+  }
+  const size_t size = size_;
+  mapping_ = std::shared_ptr<const uint8_t>(
+    static_cast<const uint8_t *>(mapped),
+    [size](const uint8_t * data) { munmap(const_cast<uint8_t *>(data), size); });
+  const uint8_t * data = mapping_.get();
+
+  const auto * header = reinterpret_cast<const TileContainerHeader *>(data);
+  const auto is_in_range = [this](const uint64_t offset, const uint64_t size) {
+    return offset <= size_ && size <= size_ - offset;
+  };
+  if (
+    std::memcmp(header->magic, tile_container_magic, sizeof(header->magic)) != 0 ||
+    header->version != tile_container_version ||
+    !is_in_range(header->record_offset, header->tile_count * sizeof(TileRecord)) ||
+    !is_in_range(header->field_offset, header->field_count * sizeof(TileField)) ||
+    !is_in_range(header->string_offset, header->string_size)) {
+    throw std::runtime_error("Invalid tile container: " + path);
+  }
+
+  records_ = reinterpret_cast<const TileRecord *>(data + header->record_offset);
+  fields_ = reinterpret_cast<const TileField *>(data + header->field_offset);
+  const auto * string_table = reinterpret_cast<const char *>(data + header->string_offset);
+
+  for (size_t i = 0; i < header->tile_count; ++i) {
+    const TileRecord & record = records_[i];
+    if (
+      !is_in_range(record.data_offset, record.data_size) ||
+      record.id_offset + record.id_length > header->string_size ||
+      record.first_field + record.field_count > header->field_count) {
+      throw std::runtime_error("Broken tile record in the tile container: " + path);
+    }
+
+    const std::string id(string_table + record.id_offset, record.id_length);
+    if (!record_index_.emplace(id, i).second) {
+      throw std::runtime_error("Duplicate tile ID in the tile container " + path + ": " + id);
+    }
+    PCDFileMetadata metadata;
+    metadata.min = pcl::PointXYZ(record.min_x, record.min_y, record.min_z);
+    metadata.max = pcl::PointXYZ(record.max_x, record.max_y, record.max_z);
+    metadata_.emplace(id, metadata);
+  }
+
+  // The tiles are read randomly depending on the ego position
+  madvise(mapped, size_, MADV_RANDOM);
+}
+
+std::optional<TileView> TileContainerReader::view(const std::string & id) const
+{
+  const auto itr = record_index_.find(id);
+  if (itr == record_index_.end()) {
+    return std::nullopt;
+  }
+
+  const TileRecord & record = records_[itr->second];
+  TileView tile;
+  // share the ownership of the mapping
+  tile.data = std::shared_ptr<const uint8_t>(mapping_, mapping_.get() + record.data_offset);
+  tile.size = record.data_size;
+  tile.record = &record;
+  tile.fields = fields_ + record.first_field;
+  return tile;
+}
+
+bool TileContainerReader::load(const std::string & id, PointCloud2 & pointcloud) const
+{
+  const auto tile = view(id);
+  if (!tile) {
+    return false;
+  }
+
+  const TileRecord & record = *tile->record;
+  pointcloud.height = record.height;
+  pointcloud.width = record.width;
+  pointcloud.point_step = record.point_step;
+  pointcloud.row_step = record.row_step;
+  pointcloud.is_bigendian = record.is_bigendian != 0;
+  pointcloud.is_dense = record.is_dense != 0;
+
+  pointcloud.fields.resize(record.field_count);
+  for (uint32_t i = 0; i < record.field_count; ++i) {
+    const TileField & field = tile->fields[i];
+    auto & point_field = pointcloud.fields[i];
+    point_field.name.assign(field.name, strnlen(field.name, sizeof(field.name)));
+    point_field.offset = field.offset;
+    point_field.datatype = field.datatype;
+    point_field.count = field.count;
+  }
+
+  pointcloud.data.assign(tile->data.get(), tile->data.get() + tile->size);
+  return true;
+}
+
+autoware_map_msgs::msg::PointCloudMapCellWithID load_point_cloud_map_cell_with_id(
+  const std::string & path, const std::string & map_id,
+  const TileContainerReader * tile_container, const rclcpp::Logger & logger)
+{
+  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
+  pointcloud_map_cell_with_id.cell_id = map_id;
+
+  if (tile_container) {
+    if (!tile_container->load(path, pointcloud_map_cell_with_id.pointcloud)) {
+      RCLCPP_ERROR_STREAM(logger, "Tile not found in the tile container: " << path);
+    }
+  } else if (pcl::io::loadPCDFile(path, pointcloud_map_cell_with_id.pointcloud) == -1) {
+    RCLCPP_ERROR_STREAM(logger, "PCD load failed: " << path);
+  }
+  return pointcloud_map_cell_with_id;
+}
+}  // namespace autoware::map_loader
@@ -0,0 +1,171 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__TILE_CONTAINER_HPP_
+#define POINTCLOUD_MAP_LOADER__TILE_CONTAINER_HPP_
+
+#include "utils.hpp"
+
+#include <rclcpp/logger.hpp>
+
+#include <autoware_map_msgs/msg/point_cloud_map_cell_with_id.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace autoware::map_loader
+{
+/*
+ * Pointcloud map tile container
+ *
+ * All the divided pointcloud map tiles are packed into one file so that the loader can serve
+ * them from memory-mapped storage without parsing PCD files on every request.
+ *
+ *   [TileContainerHeader]
+ *   [point block of tile 0] ... [point block of tile N-1]   (each aligned to tile_block_alignment)
+ *   [TileRecord] x N
+ *   [TileField] x (total number of fields)
+ *   [string table]                                          (tile IDs)
+ *
+ * The point blocks are the raw PointCloud2 data of the tiles. The tile IDs must be unique.
+ */
+constexpr char tile_container_magic[8] = {'A', 'W', 'P', 'C', 'T', 'I', 'L', 'E'};
+constexpr uint32_t tile_container_version = 1;
+constexpr uint64_t tile_block_alignment = 64;
+
+struct TileContainerHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t tile_count;
+  uint64_t record_offset;
+  uint64_t field_offset;
+  uint64_t field_count;
+  uint64_t string_offset;
+  uint64_t string_size;
+};
+
+struct TileRecord
+{
+  float min_x, min_y, min_z;
+  float max_x, max_y, max_z;
+  uint64_t id_offset;  // offset in the string table
+  uint32_t id_length;
+  uint32_t first_field;  // index of the first TileField of this tile
+  uint32_t field_count;
+  uint32_t height;
+  uint32_t width;
+  uint32_t point_step;
+  uint32_t row_step;
+  uint8_t is_bigendian;
+  uint8_t is_dense;
+  uint8_t padding[6];
+  uint64_t data_offset;
+  uint64_t data_size;
+};
+
+struct TileField
+{
+  char name[32];
+  uint32_t offset;
+  uint32_t count;
+  uint8_t datatype;
+  uint8_t padding[7];
+};
+
+/**
+ * @brief Pack the PCD files into a tile container. The file name of each PCD is used as the ID.
+ * @param output_path path of the tile container to create
+ * @param pcd_metadata_dict map of (PCD path, metadata) to pack
+ */
+void write_tile_container(
+  const std::string & output_path,
+  const std::map<std::string, PCDFileMetadata> & pcd_metadata_dict);
+
+/**
+ * @brief Point block of a tile in the memory-mapped tile container
+ *
+ * The data is not copied out of the mapping, and the view keeps the mapping alive so that it can
+ * outlive the reader.
+ */
+struct TileView
+{
+  std::shared_ptr<const uint8_t> data;
+  size_t size{0};
+  const TileRecord * record{nullptr};
+  const TileField * fields{nullptr};  // fields of the tile, record->field_count in total
+};
+
+class TileContainerReader
+{
+public:
+  using PointCloud2 = sensor_msgs::msg::PointCloud2;
+
+  /**
+   * @brief Memory-map the tile container
+   * @param path path of the tile container
+   * @throw std::runtime_error if the file is not a valid tile container or has duplicate tile IDs
+   */
+  explicit TileContainerReader(const std::string & path);
+
+  [[nodiscard]] const std::map<std::string, PCDFileMetadata> & metadata() const
+  {
+    return metadata_;
+  }
+
+  /**
+   * @brief Get the point block of the tile without copying it
+   * @param id ID of the tile
+   * @return view of the tile, or std::nullopt if the ID is not found
+   */
+  [[nodiscard]] std::optional<TileView> view(const std::string & id) const;
+
+  /**
+   * @brief Fill the pointcloud with the tile, copying its point block once from the mapping
+   * @param id ID of the tile
+   * @param pointcloud pointcloud to fill
+   * @return false if the ID is not found
+   */
+  bool load(const std::string & id, PointCloud2 & pointcloud) const;
+
+private:
+  std::shared_ptr<const uint8_t> mapping_;
+  size_t size_{0};
+
+  const TileRecord * records_{nullptr};
+  const TileField * fields_{nullptr};
+  std::unordered_map<std::string, size_t> record_index_;
+  std::map<std::string, PCDFileMetadata> metadata_;
+};
+
+/**
+ * @brief Load the pointcloud map cell from the tile container if it is given, otherwise from the
+ *        PCD file
+ * @param path path of the PCD file, which is the tile ID with the tile container
+ * @param map_id ID of the cell
+ * @param tile_container tile container to serve the tile from, or nullptr
+ * @param logger logger to report the load failure
+ */
+autoware_map_msgs::msg::PointCloudMapCellWithID load_point_cloud_map_cell_with_id(
+  const std::string & path, const std::string & map_id,
+  const TileContainerReader * tile_container, const rclcpp::Logger & logger);
+}  // namespace autoware::map_loader
+
+#endif  // POINTCLOUD_MAP_LOADER__TILE_CONTAINER_HPP_
@@ -0,0 +1,120 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/pcd_metadata_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+using autoware::map_loader::PCDFileMetadata;
+using autoware::map_loader::PCDMetadataIndex;
+using autoware_map_msgs::msg::AreaInfo;
+
+namespace
+{
+std::map<std::string, PCDFileMetadata> create_grid_metadata(const int n, const float resolution)
+{
+  std::map<std::string, PCDFileMetadata> metadata_dict;
+  for (int x = -n; x < n; ++x) {
+    for (int y = -n; y < n; ++y) {
+      PCDFileMetadata metadata;
+      metadata.min = pcl::PointXYZ(x * resolution, y * resolution, 0.0);
+      metadata.max = pcl::PointXYZ((x + 1) * resolution, (y + 1) * resolution, 0.0);
+      metadata_dict[std::to_string(x) + "_" + std::to_string(y) + ".pcd"] = metadata;
+    }
+  }
+  return metadata_dict;
+}
+
+std::vector<std::string> brute_force_query(
+  const std::map<std::string, PCDFileMetadata> & metadata_dict, const AreaInfo & area)
+{
+  std::vector<std::string> ids;
+  for (const auto & [id, metadata] : metadata_dict) {
+    if (autoware::map_loader::is_grid_within_queried_area(area, metadata)) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+
+AreaInfo create_area(const double x, const double y, const double radius)
+{
+  AreaInfo area;
+  area.center_x = static_cast<float>(x);
+  area.center_y = static_cast<float>(y);
+  area.radius = static_cast<float>(radius);
+  return area;
+}
+}  // namespace
+
+TEST(PCDMetadataIndexTest, SameResultAsLinearScan)
+{
+  const auto metadata_dict = create_grid_metadata(10, 20.0);
+  const PCDMetadataIndex index(metadata_dict);
+  EXPECT_DOUBLE_EQ(index.cell_size(), 20.0);
+
+  for (const auto & area :
+       {create_area(0.0, 0.0, 1.0), create_area(13.0, -27.0, 45.0), create_area(-199.0, 5.0, 3.0),
+        create_area(500.0, 500.0, 10.0), create_area(0.0, 0.0, 1000.0),
+        create_area(40.0, 40.0, 0.0)}) {
+    std::vector<std::string> ids;
+    for (const size_t i : index.query(area)) {
+      ids.push_back(index.id(i));
+    }
+    EXPECT_EQ(ids, brute_force_query(metadata_dict, area));
+  }
+}
+
+TEST(PCDMetadataIndexTest, MultiAreaQuery)
+{
+  const auto metadata_dict = create_grid_metadata(5, 10.0);
+  const PCDMetadataIndex index(metadata_dict);
+
+  const std::vector<AreaInfo> areas{
+    create_area(-25.0, -25.0, 3.0), create_area(25.0, 25.0, 3.0), create_area(-24.0, -24.0, 3.0)};
+
+  std::vector<std::string> expected;
+  for (const auto & area : areas) {
+    for (const auto & id : brute_force_query(metadata_dict, area)) {
+      if (std::find(expected.begin(), expected.end(), id) == expected.end()) {
+        expected.push_back(id);
+      }
+    }
+  }
+  std::sort(expected.begin(), expected.end());
+
+  std::vector<std::string> ids;
+  for (const size_t i : index.query(areas)) {
+    ids.push_back(index.id(i));
+  }
+  EXPECT_EQ(ids, expected);
+}
+
+TEST(PCDMetadataIndexTest, Empty)
+{
+  const PCDMetadataIndex index(std::map<std::string, PCDFileMetadata>{});
+  EXPECT_EQ(index.size(), 0u);
+  EXPECT_TRUE(index.query(create_area(0.0, 0.0, 100.0)).empty());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/tile_container.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+
+using autoware::map_loader::PCDFileMetadata;
+using autoware::map_loader::TileContainerReader;
+using autoware::map_loader::TileView;
+
+TEST(TileContainerTest, WriteAndRead)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud_a;
+  cloud_a.push_back(pcl::PointXYZ(1.0, 2.0, 3.0));
+  cloud_a.push_back(pcl::PointXYZ(4.0, 5.0, 6.0));
+  pcl::io::savePCDFileBinary("/tmp/tile_container_a.pcd", cloud_a);
+
+  pcl::PointCloud<pcl::PointXYZ> cloud_b;
+  cloud_b.push_back(pcl::PointXYZ(20.0, 21.0, 22.0));
+  pcl::io::savePCDFileASCII("/tmp/tile_container_b.pcd", cloud_b);
+
+  std::map<std::string, PCDFileMetadata> metadata_dict;
+  metadata_dict["/tmp/tile_container_a.pcd"] = {
+    pcl::PointXYZ(0.0, 0.0, 0.0), pcl::PointXYZ(10.0, 10.0, 10.0)};
+  metadata_dict["/tmp/tile_container_b.pcd"] = {
+    pcl::PointXYZ(20.0, 20.0, 0.0), pcl::PointXYZ(30.0, 30.0, 10.0)};
+
+  autoware::map_loader::write_tile_container("/tmp/tile_container.bin", metadata_dict);
+
+  const TileContainerReader reader("/tmp/tile_container.bin");
+  const auto & metadata = reader.metadata();
+  ASSERT_EQ(metadata.size(), 2u);
+  EXPECT_EQ(metadata.at("tile_container_a.pcd"), metadata_dict.at("/tmp/tile_container_a.pcd"));
+  EXPECT_EQ(metadata.at("tile_container_b.pcd"), metadata_dict.at("/tmp/tile_container_b.pcd"));
+
+  for (const auto & [id, expected] : std::map<std::string, pcl::PointCloud<pcl::PointXYZ>>{
+         {"tile_container_a.pcd", cloud_a}, {"tile_container_b.pcd", cloud_b}}) {
+    sensor_msgs::msg::PointCloud2 pcd;
+    ASSERT_TRUE(reader.load(id, pcd));
+    pcl::PointCloud<pcl::PointXYZ> actual;
+    pcl::fromROSMsg(pcd, actual);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t j = 0; j < actual.size(); ++j) {
+      EXPECT_FLOAT_EQ(actual[j].x, expected[j].x);
+      EXPECT_FLOAT_EQ(actual[j].y, expected[j].y);
+      EXPECT_FLOAT_EQ(actual[j].z, expected[j].z);
+    }
+  }
+
+  sensor_msgs::msg::PointCloud2 pcd;
+  EXPECT_FALSE(reader.load("not_found.pcd", pcd));
+  EXPECT_FALSE(reader.view("not_found.pcd"));
+}
+
+TEST(TileContainerTest, ViewOutlivesReader)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  cloud.push_back(pcl::PointXYZ(1.0, 2.0, 3.0));
+  pcl::io::savePCDFileBinary("/tmp/tile_container_view.pcd", cloud);
+
+  std::map<std::string, PCDFileMetadata> metadata_dict;
+  metadata_dict["/tmp/tile_container_view.pcd"] = {
+    pcl::PointXYZ(0.0, 0.0, 0.0), pcl::PointXYZ(10.0, 10.0, 10.0)};
+  autoware::map_loader::write_tile_container("/tmp/tile_container_view.bin", metadata_dict);
+
+  std::optional<TileView> tile;
+  {
+    const TileContainerReader reader("/tmp/tile_container_view.bin");
+    tile = reader.view("tile_container_view.pcd");
+    ASSERT_TRUE(tile);
+    // The view points into the mapping instead of a copy
+    EXPECT_EQ(tile->data.get(), reader.view("tile_container_view.pcd")->data.get());
+  }
+
+  ASSERT_EQ(tile->size, tile->record->point_step);
+  ASSERT_EQ(tile->record->field_count, 3u);
+  EXPECT_STREQ(tile->fields[0].name, "x");
+  float xyz[3];
+  for (size_t i = 0; i < 3; ++i) {
+    std::memcpy(&xyz[i], tile->data.get() + tile->fields[i].offset, sizeof(float));
+  }
+  EXPECT_FLOAT_EQ(xyz[0], 1.0);
+  EXPECT_FLOAT_EQ(xyz[1], 2.0);
+  EXPECT_FLOAT_EQ(xyz[2], 3.0);
+}
+
+TEST(TileContainerTest, DuplicateFileName)
+{
+  std::filesystem::create_directories("/tmp/tile_container_dir_a");
+  std::filesystem::create_directories("/tmp/tile_container_dir_b");
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  cloud.push_back(pcl::PointXYZ(1.0, 2.0, 3.0));
+  pcl::io::savePCDFileBinary("/tmp/tile_container_dir_a/tile.pcd", cloud);
+  pcl::io::savePCDFileBinary("/tmp/tile_container_dir_b/tile.pcd", cloud);
+
+  // The file name is the tile ID, so one of the tiles would not be served
+  std::map<std::string, PCDFileMetadata> metadata_dict;
+  metadata_dict["/tmp/tile_container_dir_a/tile.pcd"] = {
+    pcl::PointXYZ(0.0, 0.0, 0.0), pcl::PointXYZ(10.0, 10.0, 10.0)};
+  metadata_dict["/tmp/tile_container_dir_b/tile.pcd"] = {
+    pcl::PointXYZ(10.0, 0.0, 0.0), pcl::PointXYZ(20.0, 10.0, 10.0)};
+  EXPECT_THROW(
+    autoware::map_loader::write_tile_container("/tmp/tile_container_dup.bin", metadata_dict),
+    std::runtime_error);
+}
+
+TEST(TileContainerTest, InvalidFile)
+{
+  std::ofstream ofs("/tmp/invalid_tile_container.bin", std::ios::binary);
+  ofs << "this is not a tile container";
+  ofs.close();
+
+  EXPECT_THROW(TileContainerReader("/tmp/invalid_tile_container.bin"), std::runtime_error);
+  EXPECT_THROW(TileContainerReader("/tmp/not_existing_tile_container.bin"), std::runtime_error);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -25,6 +25,7 @@
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <vector>
 
@@ -201,13 +202,13 @@ protected:
   bool detectCollision(const IndexXYT & base_index) const;
   bool detectCollision(const geometry_msgs::msg::Pose & base_pose) const;
 
-  // cspell: ignore Toriwaki
+  // cspell: ignore Felzenszwalb Huttenlocher
   /// @brief Computes the euclidean distance to the nearest obstacle for each grid cell.
-  /// @cite T., Saito, and J., Toriwaki "New algorithms for euclidean distance transformation of an
-  /// n-dimensional digitized picture with applications," Pattern Recognition 27, 1994
-  /// https://doi.org/10.1016/0031-3203(94)90133-3
-  /// @details first, distance values are computed along each row. Then, the computed values are
-  /// used to to compute the minimum distance along each column.
+  /// @cite P. F., Felzenszwalb, and D. P., Huttenlocher "Distance Transforms of Sampled
+  /// Functions," Theory of Computing 8, 2012 https://doi.org/10.4086/toc.2012.v008a019
+  /// @details first, the nearest obstacle along each row is found. Then, the lower envelope of the
+  /// parabolas given by the row distances is computed along each column. Both passes are linear in
+  /// the number of cells and run in parallel over the rows and columns respectively.
   void computeEDTMap();
 
   template <typename IndexType>
@@ -250,7 +251,8 @@ protected:
   template <typename IndexType>
   inline EDTData getObstacleEDT(const IndexType & index) const
   {
-    return edt_map_[indexToId(index)];
+    const int id = indexToId(index);
+    return {edt_distance_[id], edt_angle_[id]};
   }
 
   // compute single dimensional grid cell index from 2 dimensional index
@@ -292,7 +294,11 @@ protected:
   std::vector<bool> is_obstacle_table_;
 
   // Euclidean distance transform map (distance & angle info to nearest obstacle cell)
-  std::vector<EDTData> edt_map_;
+  std::vector<float> edt_distance_;
+  std::vector<float> edt_angle_;
+
+  // x index of the nearest obstacle in the same row, intermediate buffer of computeEDTMap
+  std::vector<int32_t> edt_nearest_x_;
 
   // pose in costmap frame
   geometry_msgs::msg::Pose start_pose_;
@@ -26,12 +26,15 @@
 #include <boost/optional/optional.hpp>
 
 #include <cmath>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <queue>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace autoware::freespace_planning_algorithms
@@ -71,6 +74,7 @@ struct AstarNode
   int steering_index;                    // steering index
   bool is_back;                          // true if the current direction of the vehicle is back
   AstarNode * parent = nullptr;          // parent node
+  int heap_index = -1;                   // position in the open list, -1 if not in it
 
   inline void set(
     const Pose & pose, const double move_cost, const double total_cost, const double steer_ind,
@@ -91,6 +95,58 @@ struct NodeComparison
   bool operator()(const AstarNode * lhs, const AstarNode * rhs) const { return lhs->fc > rhs->fc; }
 };
 
+// open list of A*, a binary heap ordered by NodeComparison. each node appears at most once and its
+// position is kept in AstarNode::heap_index so that its cost can be decreased in place
+class AstarOpenList
+{
+public:
+  bool empty() const { return heap_.empty(); }
+  size_t size() const { return heap_.size(); }
+
+  // push the node, or reorder it if it is already in the list and its cost has changed
+  void push(AstarNode * node);
+  // remove and return the node of the minimum cost. the list must not be empty
+  AstarNode * pop();
+  void clear();
+
+private:
+  void siftUp(size_t heap_index);
+  void siftDown(size_t heap_index);
+
+  std::vector<AstarNode *> heap_;
+};
+
+// nodes of A* indexed by key. a node is created on the first access to its key, and reset() drops
+// all of them by bumping a generation instead of clearing every key
+class AstarNodeStore
+{
+public:
+  // drop all the nodes, and set the number of keys
+  void reset(const size_t key_num);
+  // get the node of the key, creating a default one if the key has not been accessed since reset()
+  AstarNode * get(const size_t key);
+  // number of the nodes created since reset()
+  size_t size() const { return nodes_.size(); }
+
+private:
+  // deque keeps the pointers to the nodes valid while growing
+  std::deque<AstarNode> nodes_;
+  // index of the node in nodes_ for each key, valid only if node_generations_ equals generation_
+  std::vector<uint32_t> node_slots_;
+  std::vector<uint32_t> node_generations_;
+  uint32_t generation_ = 0;
+};
+
+// successor of a node for one steering step, relative to the pose of the node
+struct MotionPrimitive
+{
+  double curvature;  // inverse of the turning radius, 0 for straight motion
+  // offset for the minimum expansion distance forward, in the frame of the node
+  double dx;
+  double dy;
+  double dyaw;
+};
+
 class AstarSearch : public AbstractPlanningAlgorithm
 {
 public:
@@ -135,6 +191,9 @@ public:
 
 private:
   void setCollisionFreeDistanceMap();
+  void setMotionPrimitives();
+  Pose getSuccessorPose(
+    const AstarNode & node, const MotionPrimitive & primitive, const double distance) const;
   bool search();
   void expandNodes(AstarNode & current_node, const bool is_back = false);
   void resetData();
@@ -156,10 +215,17 @@ private:
   AstarParam astar_param_;
 
   // hybrid astar variables
-  std::vector<AstarNode> graph_;
+  // nodes reached in the current plan
+  AstarNodeStore nodes_;
+  std::vector<MotionPrimitive> motion_primitives_;
   std::vector<double> col_free_distance_map_;
 
-  std::priority_queue<AstarNode *, std::vector<AstarNode *>, NodeComparison> openlist_;
+  // buffers of setCollisionFreeDistanceMap reused across plans
+  std::vector<uint8_t> is_traversable_table_;
+  std::vector<uint8_t> col_free_closed_;
+  std::vector<std::pair<IndexXY, double>> col_free_heap_;
+
+  AstarOpenList openlist_;
 
   // goal node, which may helpful in testing and debugging
   AstarNode * goal_node_;
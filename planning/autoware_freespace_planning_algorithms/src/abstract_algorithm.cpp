@@ -20,6 +20,8 @@
 #include <autoware/universe_utils/math/normalization.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <vector>
@@ -144,7 +146,7 @@ double AbstractPlanningAlgorithm::getDistanceToObstacle(const geometry_msgs::msg
 {
   const auto local_pose = global2local(costmap_, pose);
   const auto index = pose2index(costmap_, local_pose, planner_common_param_.theta_size);
-  if (indexToId(index) >= static_cast<int>(edt_map_.size())) {
+  if (indexToId(index) >= static_cast<int>(edt_distance_.size())) {
     return std::numeric_limits<double>::max();
   }
   return getObstacleEDT(index).distance;
@@ -152,78 +154,84 @@ double AbstractPlanningAlgorithm::getDistanceToObstacle(const geometry_msgs::msg
 
 void AbstractPlanningAlgorithm::computeEDTMap()
 {
-  edt_map_.clear();
   const int height = costmap_.info.height;
   const int width = costmap_.info.width;
-  const double resolution_m = costmap_.info.resolution;
-  std::vector<std::pair<double, geometry_msgs::msg::Point>> edt_map;
-  edt_map.reserve(costmap_.data.size());
+  const float resolution_m = costmap_.info.resolution;
+  const size_t nb_of_cells = static_cast<size_t>(height) * width;
 
-  std::vector<std::pair<double, geometry_msgs::msg::Point>> temporary_storage(width);
-  // scan rows
+  // buffers are reused across setMap calls to avoid reallocating them for every replan
+  edt_nearest_x_.resize(nb_of_cells);
+  edt_distance_.resize(nb_of_cells);
+  edt_angle_.resize(nb_of_cells);
+
+  // scan rows: x index of the nearest obstacle in the same row, or -1 if the row has none
+#pragma omp parallel for
   for (int i = 0; i < height; ++i) {
-    double distance = resolution_m;
-    bool found_obstacle = false;
+    int32_t * nearest_x = edt_nearest_x_.data() + static_cast<size_t>(i) * width;
+    int last_obstacle = -1;
     // forward scan
     for (int j = 0; j < width; ++j) {
-      if (isObs(IndexXY{j, i})) {
-        temporary_storage[j].first = 0.0;
-        temporary_storage[j].second.x = 0.0;
-        distance = resolution_m;
-        found_obstacle = true;
-      } else if (found_obstacle) {
-        temporary_storage[j].first = distance;
-        temporary_storage[j].second.x = -distance;
-        distance += resolution_m;
-      } else {
-        temporary_storage[j].first = std::numeric_limits<double>::infinity();
-      }
+      if (isObs(IndexXY{j, i})) last_obstacle = j;
+      nearest_x[j] = last_obstacle;
     }
-
-    distance = resolution_m;
-    found_obstacle = false;
+    last_obstacle = -1;
     // backward scan
     for (int j = width - 1; j >= 0; --j) {
-      if (isObs(IndexXY{j, i})) {
-        distance = resolution_m;
-        found_obstacle = true;
-      } else if (found_obstacle && temporary_storage[j].first > distance) {
-        temporary_storage[j].first = distance;
-        temporary_storage[j].second.x = distance;
-        distance += resolution_m;
+      if (isObs(IndexXY{j, i})) last_obstacle = j;
+      if (last_obstacle >= 0 && (nearest_x[j] < 0 || last_obstacle - j < j - nearest_x[j])) {
+        nearest_x[j] = last_obstacle;
       }
     }
-    edt_map.insert(edt_map.end(), temporary_storage.begin(), temporary_storage.end());
   }
 
-  temporary_storage.clear();
-  temporary_storage.resize(height);
-  // scan columns;
-  for (int j = 0; j < width; ++j) {
-    for (int i = 0; i < height; ++i) {
-      int id = indexToId(IndexXY{j, i});
-      double min_value = edt_map[id].first * edt_map[id].first;
-      geometry_msgs::msg::Point rel_pos = edt_map[id].second;
-      for (int k = 0; k < height; ++k) {
-        id = indexToId(IndexXY{j, k});
-        double dist = resolution_m * std::abs(static_cast<double>(i - k));
-        double value = edt_map[id].first * edt_map[id].first + dist * dist;
-        if (value < min_value) {
-          min_value = value;
-          rel_pos.x = edt_map[id].second.x;
-          rel_pos.y = dist;
+  // scan columns: lower envelope of the parabolas (k - i)^2 + dx(k)^2 over the rows k
+#pragma omp parallel
+  {
+    std::vector<int> parabola_rows(height);
+    std::vector<double> boundaries(height + 1);
+
+#pragma omp for
+    for (int j = 0; j < width; ++j) {
+      const auto squared_dx = [&](const int k) {
+        const int64_t dx = edt_nearest_x_[static_cast<size_t>(k) * width + j] - j;
+        return static_cast<double>(dx * dx);
+      };
+
+      int nb_of_parabolas = 0;
+      for (int q = 0; q < height; ++q) {
+        // rows without obstacle do not contribute to the envelope
+        if (edt_nearest_x_[static_cast<size_t>(q) * width + j] < 0) continue;
+        const double f_q = squared_dx(q) + static_cast<double>(q) * q;
+        double boundary = -std::numeric_limits<double>::infinity();
+        while (nb_of_parabolas > 0) {
+          const int v = parabola_rows[nb_of_parabolas - 1];
+          boundary = (f_q - (squared_dx(v) + static_cast<double>(v) * v)) / (2.0 * (q - v));
+          if (boundary > boundaries[nb_of_parabolas - 1]) break;
+          --nb_of_parabolas;
+          boundary = -std::numeric_limits<double>::infinity();
+        }
+        parabola_rows[nb_of_parabolas] = q;
+        boundaries[nb_of_parabolas] = boundary;
+        ++nb_of_parabolas;
+      }
+
+      int k = 0;
+      for (int i = 0; i < height; ++i) {
+        const size_t id = static_cast<size_t>(i) * width + j;
+        if (nb_of_parabolas == 0) {
+          edt_distance_[id] = std::numeric_limits<float>::infinity();
+          edt_angle_[id] = 0.0f;
+          continue;
         }
+        while (k + 1 < nb_of_parabolas && boundaries[k + 1] < i) ++k;
+        const int v = parabola_rows[k];
+        const int dx = edt_nearest_x_[static_cast<size_t>(v) * width + j] - j;
+        const int dy = v - i;
+        edt_distance_[id] =
+          resolution_m * std::hypot(static_cast<float>(dx), static_cast<float>(dy));
+        edt_angle_[id] = std::atan2(static_cast<float>(dy), static_cast<float>(dx));
       }
-      temporary_storage[i].first = sqrt(min_value);
-      temporary_storage[i].second = rel_pos;
     }
-    for (int i = 0; i < height; ++i) {
-      edt_map[indexToId(IndexXY{j, i})] = temporary_storage[i];
-    }
-  }
-  for (const auto & edt : edt_map) {
-    const double angle = std::atan2(edt.second.y, edt.second.x);
-    edt_map_.push_back({edt.first, angle});
   }
 }
 
@@ -25,7 +25,6 @@
 
 #include <limits>
 #include <memory>
-#include <queue>
 #include <utility>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -67,6 +66,93 @@ Pose calcRelativePose(const Pose & base_pose, const Pose & pose)
   return transformed.pose;
 }
 
+void AstarOpenList::push(AstarNode * node)
+{
+  if (node->heap_index < 0) {
+    node->heap_index = static_cast<int>(heap_.size());
+    heap_.push_back(node);
+  }
+  // the cost of a node already in the open list may have changed
+  siftUp(node->heap_index);
+  siftDown(node->heap_index);
+}
+
+AstarNode * AstarOpenList::pop()
+{
+  AstarNode * top = heap_.front();
+  heap_.front() = heap_.back();
+  heap_.front()->heap_index = 0;
+  heap_.pop_back();
+  if (!heap_.empty()) siftDown(0);
+  top->heap_index = -1;
+  return top;
+}
+
+void AstarOpenList::clear()
+{
+  for (auto * node : heap_) {
+    node->heap_index = -1;
+  }
+  heap_.clear();
+}
+
+void AstarOpenList::siftUp(size_t heap_index)
+{
+  AstarNode * node = heap_[heap_index];
+  while (heap_index > 0) {
+    const size_t parent_index = (heap_index - 1) / 2;
+    if (!NodeComparison{}(heap_[parent_index], node)) break;
+    heap_[heap_index] = heap_[parent_index];
+    heap_[heap_index]->heap_index = static_cast<int>(heap_index);
+    heap_index = parent_index;
+  }
+  heap_[heap_index] = node;
+  node->heap_index = static_cast<int>(heap_index);
+}
+
+void AstarOpenList::siftDown(size_t heap_index)
+{
+  AstarNode * node = heap_[heap_index];
+  const size_t size = heap_.size();
+  while (true) {
+    size_t child_index = 2 * heap_index + 1;
+    if (child_index >= size) break;
+    if (child_index + 1 < size && NodeComparison{}(heap_[child_index], heap_[child_index + 1])) {
+      ++child_index;
+    }
+    if (!NodeComparison{}(node, heap_[child_index])) break;
+    heap_[heap_index] = heap_[child_index];
+    heap_[heap_index]->heap_index = static_cast<int>(heap_index);
+    heap_index = child_index;
+  }
+  heap_[heap_index] = node;
+  node->heap_index = static_cast<int>(heap_index);
+}
+
+void AstarNodeStore::reset(const size_t key_num)
+{
+  if (node_generations_.size() != key_num) {
+    node_generations_.assign(key_num, 0);
+    node_slots_.resize(key_num);
+    generation_ = 0;
+  }
+  if (++generation_ == 0) {
+    std::fill(node_generations_.begin(), node_generations_.end(), 0);
+    generation_ = 1;
+  }
+  nodes_.clear();
+}
+
+AstarNode * AstarNodeStore::get(const size_t key)
+{
+  if (node_generations_[key] != generation_) {
+    node_generations_[key] = generation_;
+    node_slots_[key] = static_cast<uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+  }
+  return &nodes_[node_slots_[key]];
+}
+
 AstarSearch::AstarSearch(
   const PlannerCommonParam & planner_common_param, const VehicleShape & collision_vehicle_shape,
   const AstarParam & astar_param)
@@ -128,16 +214,81 @@ void AstarSearch::setMap(const nav_msgs::msg::OccupancyGrid & costmap)
   min_expansion_dist_ = std::max(astar_param_.expansion_distance, 1.5 * costmap_.info.resolution);
   max_expansion_dist_ = std::max(
     collision_vehicle_shape_.base_length * base_length_max_expansion_factor_, min_expansion_dist_);
+
+  setMotionPrimitives();
+
+  // cells the vehicle center can pass through, used by setCollisionFreeDistanceMap for every plan
+  const size_t nb_of_cells = costmap_.data.size();
+  is_traversable_table_.resize(nb_of_cells);
+  for (size_t id = 0; id < nb_of_cells; ++id) {
+    is_traversable_table_[id] =
+      !is_obstacle_table_[id] && edt_distance_[id] >= 0.5 * collision_vehicle_shape_.width;
+  }
+}
+
+void AstarSearch::setMotionPrimitives()
+{
+  motion_primitives_.clear();
+  const double distance = min_expansion_dist_;
+  for (int steering_index = -1 * planner_common_param_.turning_steps;
+       steering_index <= planner_common_param_.turning_steps; ++steering_index) {
+    const double steering = static_cast<double>(steering_index) * steering_resolution_;
+    MotionPrimitive primitive{};
+    if (std::abs(steering) < kinematic_bicycle_model::eps) {
+      primitive.curvature = 0.0;
+      primitive.dx = distance;
+    } else {
+      primitive.curvature = std::tan(steering) / collision_vehicle_shape_.base_length;
+      primitive.dyaw = distance * primitive.curvature;
+      primitive.dx = std::sin(primitive.dyaw) / primitive.curvature;
+      primitive.dy = (1.0 - std::cos(primitive.dyaw)) / primitive.curvature;
+    }
+    motion_primitives_.push_back(primitive);
+  }
+}
+
+Pose AstarSearch::getSuccessorPose(
+  const AstarNode & node, const MotionPrimitive & primitive, const double distance) const
+{
+  // same motion as kinematic_bicycle_model::getPose, using the offsets computed in advance when
+  // the expansion distance is the minimum one
+  double dx = primitive.dx;
+  double dy = primitive.dy;
+  double dyaw = primitive.dyaw;
+  if (std::abs(distance) != min_expansion_dist_) {
+    if (primitive.curvature == 0.0) {
+      dx = std::abs(distance);
+    } else {
+      dyaw = std::abs(distance) * primitive.curvature;
+      dx = std::sin(dyaw) / primitive.curvature;
+      dy = (1.0 - std::cos(dyaw)) / primitive.curvature;
+    }
+  }
+  // moving backward mirrors the forward motion along the heading
+  if (distance < 0.0) {
+    dx = -dx;
+    dyaw = -dyaw;
+  }
+
+  const double cos_yaw = std::cos(node.theta);
+  const double sin_yaw = std::sin(node.theta);
+  Pose pose;
+  pose.position.x = node.x + cos_yaw * dx - sin_yaw * dy;
+  pose.position.y = node.y + sin_yaw * dx + cos_yaw * dy;
+  pose.position.z = goal_pose_.position.z;
+  pose.orientation = autoware::universe_utils::createQuaternionFromYaw(node.theta + dyaw);
+  return pose;
 }
 
 void AstarSearch::resetData()
 {
   // clearing openlist is necessary because otherwise remaining elements of openlist
   // point to deleted node.
-  openlist_ = std::priority_queue<AstarNode *, std::vector<AstarNode *>, NodeComparison>();
+  openlist_.clear();
   const int nb_of_grid_nodes = costmap_.info.width * costmap_.info.height;
-  const int total_astar_node_count = nb_of_grid_nodes * planner_common_param_.theta_size;
-  graph_.assign(total_astar_node_count, AstarNode{});
+  const size_t total_astar_node_count =
+    static_cast<size_t>(nb_of_grid_nodes) * planner_common_param_.theta_size;
+  nodes_.reset(total_astar_node_count);
   col_free_distance_map_.assign(nb_of_grid_nodes, std::numeric_limits<double>::max());
   shifted_goal_pose_ = {};
 }
@@ -225,20 +376,23 @@ void AstarSearch::setCollisionFreeDistanceMap()
   {
     bool operator()(const Entry & a, const Entry & b) const { return a.second > b.second; }
   };
-  std::priority_queue<Entry, std::vector<Entry>, CompareEntry> heap;
-  std::vector<bool> closed(col_free_distance_map_.size(), false);
+  // the heap and the closed flags reuse the storage of the previous plan
+  auto & heap = col_free_heap_;
+  heap.clear();
+  col_free_closed_.assign(col_free_distance_map_.size(), 0);
   auto goal_index = pose2index(costmap_, goal_pose_, planner_common_param_.theta_size);
   col_free_distance_map_[indexToId(goal_index)] = 0.0;
-  heap.push({IndexXY{goal_index.x, goal_index.y}, 0.0});
+  heap.push_back({IndexXY{goal_index.x, goal_index.y}, 0.0});
 
   Entry current;
   std::array<int, 3> offsets = {1, 0, -1};
   while (!heap.empty()) {
-    current = heap.top();
-    heap.pop();
+    std::pop_heap(heap.begin(), heap.end(), CompareEntry{});
+    current = heap.back();
+    heap.pop_back();
     const int id = indexToId(current.first);
-    if (closed[id]) continue;
-    closed[id] = true;
+    if (col_free_closed_[id]) continue;
+    col_free_closed_[id] = 1;
 
     const auto & index = current.first;
     for (const auto & offset_x : offsets) {
@@ -247,13 +401,14 @@ void AstarSearch::setCollisionFreeDistanceMap()
         const int y = index.y + offset_y;
         const IndexXY n_index{x, y};
         const double offset = std::abs(offset_x) + std::abs(offset_y);
-        if (isOutOfRange(n_index) || isObs(n_index) || offset < 1) continue;
-        if (getObstacleEDT(n_index).distance < 0.5 * collision_vehicle_shape_.width) continue;
+        if (isOutOfRange(n_index) || offset < 1) continue;
         const int n_id = indexToId(n_index);
+        if (!is_traversable_table_[n_id]) continue;
         const double dist = current.second + (sqrt(offset) * costmap_.info.resolution);
-        if (closed[n_id] || col_free_distance_map_[n_id] < dist) continue;
+        if (col_free_closed_[n_id] || col_free_distance_map_[n_id] < dist) continue;
         col_free_distance_map_[n_id] = dist;
-        heap.push({n_index, dist});
+        heap.push_back({n_index, dist});
+        std::push_heap(heap.begin(), heap.end(), CompareEntry{});
       }
     }
   }
@@ -263,7 +418,7 @@ void AstarSearch::setStartNode(const double cost_offset)
 {
   const auto index = pose2index(costmap_, start_pose_, planner_common_param_.theta_size);
   // Set start node
-  AstarNode * start_node = &graph_[getKey(index)];
+  AstarNode * start_node = nodes_.get(getKey(index));
   const double initial_cost = estimateCost(start_pose_, index) + cost_offset;
   start_node->set(start_pose_, 0.0, initial_cost, 0, false);
   start_node->dir_distance = 0.0;
@@ -301,9 +456,7 @@ bool AstarSearch::search()
     }
 
     // Expand minimum cost node
-    AstarNode * current_node = openlist_.top();
-    openlist_.pop();
-    if (current_node->status == NodeStatus::Closed) continue;
+    AstarNode * current_node = openlist_.pop();
     current_node->status = NodeStatus::Closed;
 
     if (isGoal(*current_node)) {
@@ -322,7 +475,6 @@ bool AstarSearch::search()
 
 void AstarSearch::expandNodes(AstarNode & current_node, const bool is_back)
 {
-  const auto current_pose = node2pose(current_node);
   const double direction = (is_back == is_backward_search_) ? 1.0 : -1.0;
   const double distance = getExpansionDistance(current_node) * direction;
   int steering_index = -1 * planner_common_param_.turning_steps;
@@ -334,14 +486,14 @@ void AstarSearch::expandNodes(AstarNode & current_node, const bool is_back)
       continue;
     }
 
-    const double steering = static_cast<double>(steering_index) * steering_resolution_;
-    const auto next_pose = kinematic_bicycle_model::getPose(
-      current_pose, collision_vehicle_shape_.base_length, steering, distance);
+    const auto & primitive =
+      motion_primitives_[steering_index + planner_common_param_.turning_steps];
+    const auto next_pose = getSuccessorPose(current_node, primitive, distance);
     const auto next_index = pose2index(costmap_, next_pose, planner_common_param_.theta_size);
 
     if (isOutOfRange(next_index) || isObs(next_index)) continue;
 
-    AstarNode * next_node = &graph_[getKey(next_index)];
+    AstarNode * next_node = nodes_.get(getKey(next_index));
     if (next_node->status == NodeStatus::Closed || detectCollision(next_index)) continue;
 
     const auto obs_edt = getObstacleEDT(next_index);
@@ -0,0 +1,255 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/freespace_planning_algorithms/astar_search.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+
+using autoware::freespace_planning_algorithms::AstarNode;
+using autoware::freespace_planning_algorithms::AstarNodeStore;
+using autoware::freespace_planning_algorithms::AstarOpenList;
+using autoware::freespace_planning_algorithms::NodeStatus;
+
+namespace
+{
+std::deque<AstarNode> createNodes(const std::vector<double> & costs)
+{
+  std::deque<AstarNode> nodes(costs.size());
+  for (size_t i = 0; i < costs.size(); ++i) {
+    nodes.at(i).fc = costs.at(i);
+  }
+  return nodes;
+}
+
+std::vector<double> popAllCosts(AstarOpenList & openlist)
+{
+  std::vector<double> costs;
+  while (!openlist.empty()) {
+    const AstarNode * node = openlist.pop();
+    EXPECT_EQ(node->heap_index, -1);
+    costs.push_back(node->fc);
+  }
+  return costs;
+}
+}  // namespace
+
+TEST(AstarOpenList, popInCostOrder)
+{
+  auto nodes = createNodes({5.0, 3.0, 8.0, 1.0, 9.0, 2.0, 7.0, 4.0, 6.0, 0.0});
+  AstarOpenList openlist;
+  for (auto & node : nodes) {
+    openlist.push(&node);
+    EXPECT_GE(node.heap_index, 0);
+  }
+  ASSERT_EQ(openlist.size(), nodes.size());
+
+  EXPECT_EQ(
+    popAllCosts(openlist),
+    (std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0}));
+}
+
+TEST(AstarOpenList, popInCostOrderRandom)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> cost_dist(0.0, 100.0);
+  std::uniform_int_distribution<int> size_dist(1, 200);
+
+  for (size_t trial = 0; trial < 20; ++trial) {
+    std::vector<double> costs(static_cast<size_t>(size_dist(engine)));
+    for (auto & cost : costs) {
+      cost = cost_dist(engine);
+    }
+    auto nodes = createNodes(costs);
+    AstarOpenList openlist;
+
+    // pop some nodes in the middle of the pushes as the search does
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      openlist.push(&nodes.at(i));
+      if (i % 3 == 2) {
+        const double min_cost = openlist.pop()->fc;
+        for (size_t j = 0; j <= i; ++j) {
+          if (nodes.at(j).heap_index >= 0) {
+            EXPECT_LE(min_cost, nodes.at(j).fc);
+          }
+        }
+      }
+    }
+    const auto costs_left = popAllCosts(openlist);
+    EXPECT_TRUE(std::is_sorted(costs_left.begin(), costs_left.end()));
+  }
+}
+
+TEST(AstarOpenList, decreaseKey)
+{
+  auto nodes = createNodes({5.0, 3.0, 8.0, 1.0, 9.0, 2.0, 7.0, 4.0, 6.0});
+  AstarOpenList openlist;
+  for (auto & node : nodes) {
+    openlist.push(&node);
+  }
+
+  // a node already in the list is reordered instead of being pushed twice
+  AstarNode & node_9 = nodes.at(4);
+  node_9.fc = 0.5;
+  openlist.push(&node_9);
+  ASSERT_EQ(openlist.size(), nodes.size());
+  EXPECT_EQ(openlist.pop(), &node_9);
+
+  // the cost of a node can also increase, e.g. when its parent is replaced
+  AstarNode & node_1 = nodes.at(3);
+  node_1.fc = 10.0;
+  openlist.push(&node_1);
+  ASSERT_EQ(openlist.size(), nodes.size() - 1);
+
+  EXPECT_EQ(
+    popAllCosts(openlist), (std::vector<double>{2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 10.0}));
+}
+
+TEST(AstarOpenList, pushAfterPop)
+{
+  auto nodes = createNodes({3.0, 1.0, 2.0});
+  AstarOpenList openlist;
+  for (auto & node : nodes) {
+    openlist.push(&node);
+  }
+
+  // a closed node may be reopened with a lower cost
+  AstarNode * node_1 = openlist.pop();
+  ASSERT_EQ(node_1, &nodes.at(1));
+  node_1->fc = 0.5;
+  openlist.push(node_1);
+  ASSERT_EQ(openlist.size(), 3u);
+  EXPECT_EQ(popAllCosts(openlist), (std::vector<double>{0.5, 2.0, 3.0}));
+}
+
+TEST(AstarOpenList, clear)
+{
+  auto nodes = createNodes({3.0, 1.0, 2.0});
+  AstarOpenList openlist;
+  for (auto & node : nodes) {
+    openlist.push(&node);
+  }
+
+  openlist.clear();
+  EXPECT_TRUE(openlist.empty());
+  for (const auto & node : nodes) {
+    EXPECT_EQ(node.heap_index, -1);
+  }
+
+  // the nodes can be pushed again after clear
+  for (auto & node : nodes) {
+    openlist.push(&node);
+  }
+  EXPECT_EQ(popAllCosts(openlist), (std::vector<double>{1.0, 2.0, 3.0}));
+}
+
+TEST(AstarNodeStore, createNodeOnFirstAccess)
+{
+  AstarNodeStore node_store;
+  node_store.reset(100);
+  EXPECT_EQ(node_store.size(), 0u);
+
+  AstarNode * node_3 = node_store.get(3);
+  EXPECT_EQ(node_store.get(3), node_3);
+  EXPECT_EQ(node_store.size(), 1u);
+
+  AstarNode * node_99 = node_store.get(99);
+  EXPECT_NE(node_99, node_3);
+  EXPECT_EQ(node_store.size(), 2u);
+
+  EXPECT_EQ(node_3->status, NodeStatus::None);
+  EXPECT_EQ(node_3->gc, 0.0);
+  EXPECT_EQ(node_3->parent, nullptr);
+  EXPECT_EQ(node_3->heap_index, -1);
+}
+
+TEST(AstarNodeStore, pointersValidWhileGrowing)
+{
+  AstarNodeStore node_store;
+  node_store.reset(10000);
+
+  std::vector<AstarNode *> node_ptrs;
+  for (size_t key = 0; key < 10000; ++key) {
+    node_ptrs.push_back(node_store.get(key));
+    node_ptrs.back()->fc = static_cast<double>(key);
+  }
+  ASSERT_EQ(node_store.size(), 10000u);
+
+  for (size_t key = 0; key < 10000; ++key) {
+    EXPECT_EQ(node_store.get(key), node_ptrs.at(key));
+    EXPECT_EQ(node_ptrs.at(key)->fc, static_cast<double>(key));
+  }
+}
+
+TEST(AstarNodeStore, reuseAfterReset)
+{
+  AstarNodeStore node_store;
+  node_store.reset(100);
+  for (size_t key = 0; key < 100; key += 2) {
+    AstarNode * node = node_store.get(key);
+    node->status = NodeStatus::Closed;
+    node->gc = 1.0;
+    node->fc = 2.0;
+    node->parent = node;
+    node->heap_index = 5;
+  }
+  ASSERT_EQ(node_store.size(), 50u);
+
+  // the nodes of the previous plan are dropped, including the keys not accessed again
+  for (size_t cycle = 0; cycle < 3; ++cycle) {
+    node_store.reset(100);
+    EXPECT_EQ(node_store.size(), 0u);
+    for (size_t key = 0; key < 100; key += 4) {
+      AstarNode * node = node_store.get(key);
+      EXPECT_EQ(node->status, NodeStatus::None);
+      EXPECT_EQ(node->gc, 0.0);
+      EXPECT_EQ(node->fc, 0.0);
+      EXPECT_EQ(node->parent, nullptr);
+      EXPECT_EQ(node->heap_index, -1);
+      node->status = NodeStatus::Open;
+    }
+    EXPECT_EQ(node_store.size(), 25u);
+  }
+
+  // the number of keys may change between the plans, e.g. when the costmap is resized
+  node_store.reset(200);
+  EXPECT_EQ(node_store.size(), 0u);
+  EXPECT_EQ(node_store.get(0)->status, NodeStatus::None);
+  EXPECT_EQ(node_store.get(199)->status, NodeStatus::None);
+  EXPECT_EQ(node_store.size(), 2u);
+}
+
+TEST(AstarNodeStore, withOpenList)
+{
+  AstarNodeStore node_store;
+  AstarOpenList openlist;
+
+  for (size_t cycle = 0; cycle < 3; ++cycle) {
+    openlist.clear();
+    node_store.reset(10);
+    for (const size_t key : {7lu, 2lu, 5lu}) {
+      AstarNode * node = node_store.get(key);
+      node->fc = static_cast<double>(key);
+      openlist.push(node);
+    }
+    // leave a node in the list, which must not leak into the next cycle
+    EXPECT_EQ(openlist.pop(), node_store.get(2));
+    EXPECT_EQ(openlist.pop(), node_store.get(5));
+    EXPECT_EQ(openlist.size(), 1u);
+  }
+}
@@ -28,8 +28,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -388,6 +390,35 @@ TEST(AstarSearchTestSuite, MultiCurvature)
   EXPECT_TRUE(test_algorithm(AlgorithmType::ASTAR_MULTI));
 }
 
+TEST(AstarSearchTestSuite, DistanceToObstacle)
+{
+  const auto costmap_msg = construct_cost_map(150, 150, 0.2, 10);
+  auto algo = configure_astar(false);
+  algo->setMap(costmap_msg);
+
+  const int width = static_cast<int>(costmap_msg.info.width);
+  const int height = static_cast<int>(costmap_msg.info.height);
+  const double resolution = costmap_msg.info.resolution;
+  std::vector<std::array<int, 2>> obstacles;
+  for (int i = 0; i < height; ++i) {
+    for (int j = 0; j < width; ++j) {
+      if (costmap_msg.data[i * width + j] >= 100) obstacles.push_back({j, i});
+    }
+  }
+
+  // compare with the brute force distance on sampled cells
+  for (int i = 0; i < height; i += 7) {
+    for (int j = 0; j < width; j += 7) {
+      double expected = std::numeric_limits<double>::max();
+      for (const auto & obstacle : obstacles) {
+        expected = std::min(expected, resolution * std::hypot(obstacle[0] - j, obstacle[1] - i));
+      }
+      const auto pose = create_pose_msg({j * resolution, i * resolution, 0.0});
+      EXPECT_NEAR(algo->getDistanceToObstacle(pose), expected, 1e-4);
+    }
+  }
+}
+
 TEST(RRTStarTestSuite, Fastest)
 {
   EXPECT_TRUE(test_algorithm(AlgorithmType::RRTSTAR_FASTEST));
@@ -18,6 +18,7 @@
 #include "autoware/obstacle_cruise_planner/common_structs.hpp"
 #include "autoware/obstacle_cruise_planner/optimization_based_planner/optimization_based_planner.hpp"
 #include "autoware/obstacle_cruise_planner/pid_based_planner/pid_based_planner.hpp"
+#include "autoware/obstacle_cruise_planner/trajectory_projection.hpp"
 #include "autoware/obstacle_cruise_planner/type_alias.hpp"
 #include "autoware/signal_processing/lowpass_filter_1d.hpp"
 #include "autoware/universe_utils/ros/logger_level_configure.hpp"
@@ -62,10 +63,12 @@ private:
     const geometry_msgs::msg::Pose & current_ego_pose, const double lat_margin = 0.0) const;
   std::vector<Obstacle> convertToObstacles(
     const Odometry & odometry, const PredictedObjects & objects,
-    const std::vector<TrajectoryPoint> & traj_points) const;
+    const std::vector<TrajectoryPoint> & traj_points,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection) const;
   std::vector<Obstacle> convertToObstacles(
     const Odometry & odometry, const PointCloud2 & pointcloud,
     const std::vector<TrajectoryPoint> & traj_points,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
     const std_msgs::msg::Header & traj_header) const;
   std::tuple<std::vector<StopObstacle>, std::vector<CruiseObstacle>, std::vector<SlowDownObstacle>>
   determineEgoBehaviorAgainstPredictedObjectObstacles(
@@ -79,12 +82,12 @@ private:
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points) const;
   std::optional<StopObstacle> createStopObstacleForPredictedObject(
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
-    const std::vector<Polygon2d> & traj_polys, const Obstacle & obstacle,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
     const double precise_lateral_dist) const;
   std::optional<std::pair<geometry_msgs::msg::Point, double>>
   createCollisionPointForOutsideStopObstacle(
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
-    const std::vector<Polygon2d> & traj_polys, const Obstacle & obstacle,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
     const PredictedPath & resampled_predicted_path, double max_lat_margin_for_stop) const;
   std::optional<StopObstacle> createStopObstacleForPointCloud(
     const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle,
@@ -97,24 +100,31 @@ private:
   bool isCruiseObstacle(const uint8_t label) const;
   bool isSlowDownObstacle(const uint8_t label) const;
   std::optional<CruiseObstacle> createYieldCruiseObstacle(
-    const Obstacle & obstacle, const std::vector<TrajectoryPoint> & traj_points);
+    const Obstacle & obstacle, const std::vector<TrajectoryPoint> & traj_points,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection);
   std::optional<std::vector<CruiseObstacle>> findYieldCruiseObstacles(
-    const std::vector<Obstacle> & obstacles, const std::vector<TrajectoryPoint> & traj_points);
+    const std::vector<Obstacle> & obstacles, const std::vector<TrajectoryPoint> & traj_points,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection);
   std::optional<CruiseObstacle> createCruiseObstacle(
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
-    const std::vector<Polygon2d> & traj_polys, const Obstacle & obstacle,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
     const double precise_lat_dist);
   std::optional<std::vector<PointWithStamp>> createCollisionPointsForInsideCruiseObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+    const std::vector<TrajectoryPoint> & traj_points,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
     const Obstacle & obstacle) const;
   std::optional<std::vector<PointWithStamp>> createCollisionPointsForOutsideCruiseObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+    const std::vector<TrajectoryPoint> & traj_points,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
     const Obstacle & obstacle) const;
   bool isObstacleCrossing(
-    const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle) const;
+    const std::vector<TrajectoryPoint> & traj_points,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+    const Obstacle & obstacle) const;
   double calcCollisionTimeMargin(
     const Odometry & odometry, const std::vector<PointWithStamp> & collision_points,
-    const std::vector<TrajectoryPoint> & traj_points, const bool is_driving_forward) const;
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+    const bool is_driving_forward) const;
   std::optional<SlowDownObstacle> createSlowDownObstacleForPredictedObject(
     const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
     const Obstacle & obstacle, const double precise_lat_dist);
@@ -134,11 +144,12 @@ private:
   void publishCalculationTime(const double calculation_time) const;
 
   bool isFrontCollideObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle,
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
     const size_t first_collision_idx) const;
   double calcTimeToReachCollisionPoint(
     const Odometry & odometry, const geometry_msgs::msg::Point & collision_point,
-    const std::vector<TrajectoryPoint> & traj_points, const double abs_ego_offset) const;
+    const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+    const double abs_ego_offset) const;
   bool enable_debug_info_;
   bool enable_calculation_time_info_;
   bool use_pointcloud_for_stop_;
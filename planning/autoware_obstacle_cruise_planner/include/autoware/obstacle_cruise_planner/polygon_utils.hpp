@@ -16,6 +16,7 @@
 #define AUTOWARE__OBSTACLE_CRUISE_PLANNER__POLYGON_UTILS_HPP_
 
 #include "autoware/obstacle_cruise_planner/common_structs.hpp"
+#include "autoware/obstacle_cruise_planner/trajectory_projection.hpp"
 #include "autoware/obstacle_cruise_planner/type_alias.hpp"
 #include "autoware/universe_utils/geometry/boost_geometry.hpp"
 #include "autoware_vehicle_info_utils/vehicle_info_utils.hpp"
@@ -43,6 +44,11 @@ std::optional<std::pair<geometry_msgs::msg::Point, double>> getCollisionPoint(
   const Obstacle & obstacle, const bool is_driving_forward,
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info);
 
+std::optional<std::pair<geometry_msgs::msg::Point, double>> getCollisionPoint(
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
+  const bool is_driving_forward, const autoware::vehicle_info_utils::VehicleInfo & vehicle_info);
+
 std::optional<std::pair<geometry_msgs::msg::Point, double>> getCollisionPoint(
   const std::vector<TrajectoryPoint> & traj_points, const size_t collision_idx,
   const std::vector<PointWithStamp> & collision_points, const bool is_driving_forward,
@@ -55,6 +61,14 @@ std::vector<PointWithStamp> getCollisionPoints(
   std::vector<size_t> & collision_index, const double max_dist = std::numeric_limits<double>::max(),
   const double max_prediction_time_for_collision_check = std::numeric_limits<double>::max());
 
+std::vector<PointWithStamp> getCollisionPoints(
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+  const rclcpp::Time & obstacle_stamp, const PredictedPath & predicted_path, const Shape & shape,
+  const rclcpp::Time & current_time, const bool is_driving_forward,
+  std::vector<size_t> & collision_index, const double max_dist = std::numeric_limits<double>::max(),
+  const double max_prediction_time_for_collision_check = std::numeric_limits<double>::max());
+
 }  // namespace polygon_utils
 
 #endif  // AUTOWARE__OBSTACLE_CRUISE_PLANNER__POLYGON_UTILS_HPP_
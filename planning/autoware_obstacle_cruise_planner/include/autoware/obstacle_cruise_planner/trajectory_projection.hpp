@@ -0,0 +1,119 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__OBSTACLE_CRUISE_PLANNER__TRAJECTORY_PROJECTION_HPP_
+#define AUTOWARE__OBSTACLE_CRUISE_PLANNER__TRAJECTORY_PROJECTION_HPP_
+
+#include "autoware/motion_utils/trajectory/trajectory_index.hpp"
+#include "autoware/obstacle_cruise_planner/type_alias.hpp"
+#include "autoware/universe_utils/geometry/boost_geometry.hpp"
+
+#include <optional>
+#include <vector>
+
+namespace obstacle_cruise_utils
+{
+using autoware::universe_utils::Polygon2d;
+
+/**
+ * @brief Projection of the obstacles onto a trajectory and its one step polygons.
+ *
+ * It is built once per cycle, then shared by all the obstacles and their predicted poses.
+ * The nearest point search and the arc length use motion_utils::TrajectoryIndex, the segment frames
+ * for the lateral offset and the bounding circles of the polygons are stored in SoA form. The
+ * collision and distance queries run boost::geometry only for the polygons whose bounding circle
+ * can reach the obstacle polygon. The results are the same as the brute force calculation.
+ */
+class TrajectoryProjection
+{
+public:
+  /**
+   * @brief build the projection of the trajectory
+   * @param traj_points trajectory points
+   * @param traj_polygons one step polygons of the trajectory points, which can be empty if the
+   * polygon queries are not used
+   */
+  explicit TrajectoryProjection(
+    const std::vector<TrajectoryPoint> & traj_points,
+    const std::vector<Polygon2d> & traj_polygons = {});
+
+  size_t size() const { return index_.size(); }
+  const std::vector<Polygon2d> & polygons() const { return polygons_; }
+
+  /**
+   * @brief find the nearest trajectory point. Same as motion_utils::findNearestIndex(traj_points,
+   * point).
+   */
+  size_t findNearestIndex(const geometry_msgs::msg::Point & point) const;
+
+  /**
+   * @brief calculate the signed arc length between two trajectory points in constant time
+   */
+  double calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const;
+
+  /**
+   * @brief calculate the signed arc length between two points. Same as
+   * motion_utils::calcSignedArcLength(traj_points, src_point, dst_point).
+   */
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const;
+
+  /**
+   * @brief calculate the lateral offset from the trajectory. Same as
+   * motion_utils::calcLateralOffset(traj_points, point).
+   * @return lateral offset, which is positive on the left side, or NaN if the trajectory has less
+   * than two distinct points
+   */
+  double calcLateralOffset(const geometry_msgs::msg::Point & point) const;
+
+  /**
+   * @brief find the polygons which can intersect the given polygon
+   * @param polygon obstacle polygon
+   * @return indices of the candidate polygons in ascending order
+   */
+  std::vector<size_t> findCollisionCandidates(const Polygon2d & polygon) const;
+
+  /**
+   * @brief calculate the minimum distance between the polygons and the given polygon. Same as the
+   * minimum of boost::geometry::distance over all the polygons.
+   * @param polygon obstacle polygon
+   * @return minimum distance, or the max value of double if there is no polygon
+   */
+  double calcMinDistance(const Polygon2d & polygon) const;
+
+private:
+  autoware::motion_utils::TrajectoryIndex index_;
+
+  // segment frames of the trajectory without overlapping points
+  std::optional<autoware::motion_utils::TrajectoryIndex> overlap_removed_index_;
+  std::vector<double> seg_xs_;
+  std::vector<double> seg_ys_;
+  std::vector<double> seg_dxs_;
+  std::vector<double> seg_dys_;
+  std::vector<double> seg_lengths_;
+
+  // bounding circles of the polygons
+  std::vector<Polygon2d> polygons_;
+  std::vector<double> circle_xs_;
+  std::vector<double> circle_ys_;
+  std::vector<double> circle_radii_;
+
+  const autoware::motion_utils::TrajectoryIndex & overlapRemovedIndex() const
+  {
+    return overlap_removed_index_ ? *overlap_removed_index_ : index_;
+  }
+};
+}  // namespace obstacle_cruise_utils
+
+#endif  // AUTOWARE__OBSTACLE_CRUISE_PLANNER__TRAJECTORY_PROJECTION_HPP_
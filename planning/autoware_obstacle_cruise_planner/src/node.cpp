@@ -67,12 +67,11 @@ std::optional<T> getObstacleFromUuid(
 }
 
 std::optional<double> calcDistanceToFrontVehicle(
-  const std::vector<TrajectoryPoint> & traj_points, const size_t ego_idx,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const size_t ego_idx,
   const geometry_msgs::msg::Point & obstacle_pos)
 {
-  const size_t obstacle_idx = autoware::motion_utils::findNearestIndex(traj_points, obstacle_pos);
-  const auto ego_to_obstacle_distance =
-    autoware::motion_utils::calcSignedArcLength(traj_points, ego_idx, obstacle_idx);
+  const size_t obstacle_idx = traj_projection.findNearestIndex(obstacle_pos);
+  const auto ego_to_obstacle_distance = traj_projection.calcSignedArcLength(ego_idx, obstacle_idx);
   if (ego_to_obstacle_distance < 0.0) return std::nullopt;
   return ego_to_obstacle_distance;
 }
@@ -113,10 +112,11 @@ std::vector<PredictedPath> resampleHighestConfidencePredictedPaths(
 }
 
 double calcDiffAngleAgainstTrajectory(
-  const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Pose & target_pose)
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+  const geometry_msgs::msg::Pose & target_pose)
 {
-  const size_t nearest_idx =
-    autoware::motion_utils::findNearestIndex(traj_points, target_pose.position);
+  const size_t nearest_idx = traj_projection.findNearestIndex(target_pose.position);
   const double traj_yaw = tf2::getYaw(traj_points.at(nearest_idx).pose.orientation);
 
   const double target_yaw = tf2::getYaw(target_pose.orientation);
@@ -134,16 +134,17 @@ double calcDiffAngleAgainstTrajectory(
  * obstacle is getting far away from the trajectory.
  *
  * @param traj_points The trajectory points.
+ * @param traj_projection The projection of the trajectory points.
  * @param obstacle_pose The current pose of the obstacle.
  * @param obstacle_twist The twist (velocity) of the obstacle.
  * @return A pair containing the longitudinal and approach velocity components.
  */
 std::pair<double, double> calculateObstacleVelocitiesRelativeToTrajectory(
-  const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Pose & obstacle_pose,
-  const geometry_msgs::msg::Twist & obstacle_twist)
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+  const geometry_msgs::msg::Pose & obstacle_pose, const geometry_msgs::msg::Twist & obstacle_twist)
 {
-  const size_t object_idx =
-    autoware::motion_utils::findNearestIndex(traj_points, obstacle_pose.position);
+  const size_t object_idx = traj_projection.findNearestIndex(obstacle_pose.position);
 
   const auto & nearest_point = traj_points.at(object_idx);
 
@@ -666,6 +667,9 @@ void ObstacleCruisePlannerNode::onTrajectory(const Trajectory::ConstSharedPtr ms
   const auto is_driving_forward = autoware::motion_utils::isDrivingForwardWithTwist(traj_points);
   is_driving_forward_ = is_driving_forward ? is_driving_forward.value() : is_driving_forward_;
 
+  // NOTE: The projection is shared by all the obstacles of this cycle.
+  const obstacle_cruise_utils::TrajectoryProjection traj_projection(traj_points);
+
   const auto & [stop_obstacles, cruise_obstacles, slow_down_obstacles] = [&]() {
     std::vector<StopObstacle> stop_obstacles;
     std::vector<CruiseObstacle> cruise_obstacles;
@@ -675,7 +679,8 @@ void ObstacleCruisePlannerNode::onTrajectory(const Trajectory::ConstSharedPtr ms
       //    (1) with a proper label
       //    (2) in front of ego
       //    (3) not too far from trajectory
-      const auto target_obstacles = convertToObstacles(ego_odom, *objects_ptr, traj_points);
+      const auto target_obstacles =
+        convertToObstacles(ego_odom, *objects_ptr, traj_points, traj_projection);
 
       //  2. Determine ego's behavior against each obstacle from stop, cruise and slow down.
       const auto & [stop_object_obstacles, cruise_object_obstacles, slow_down_object_obstacles] =
@@ -687,8 +692,8 @@ void ObstacleCruisePlannerNode::onTrajectory(const Trajectory::ConstSharedPtr ms
       concatenate(slow_down_obstacles, slow_down_object_obstacles);
     }
     if (pointcloud_ptr) {
-      const auto target_obstacles =
-        convertToObstacles(ego_odom, *pointcloud_ptr, traj_points, msg->header);
+      const auto target_obstacles = convertToObstacles(
+        ego_odom, *pointcloud_ptr, traj_points, traj_projection, msg->header);
 
       const auto & [stop_pc_obstacles, cruise_pc_obstacles, slow_down_pc_obstacles] =
         determineEgoBehaviorAgainstPointCloudObstacles(ego_odom, traj_points, target_obstacles);
@@ -821,7 +826,8 @@ std::vector<Polygon2d> ObstacleCruisePlannerNode::createOneStepPolygons(
 
 std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
   const Odometry & odometry, const PredictedObjects & objects,
-  const std::vector<TrajectoryPoint> & traj_points) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection) const
 {
   stop_watch_.tic(__func__);
 
@@ -858,12 +864,12 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
     }
 
     const auto projected_vel = calculateObstacleVelocitiesRelativeToTrajectory(
-      traj_points, current_obstacle_pose.pose,
+      traj_points, traj_projection, current_obstacle_pose.pose,
       predicted_object.kinematics.initial_twist_with_covariance.twist);
 
     // 2. Check if the obstacle is in front of the ego.
     const auto ego_to_obstacle_distance =
-      calcDistanceToFrontVehicle(traj_points, ego_idx, current_obstacle_pose.pose.position);
+      calcDistanceToFrontVehicle(traj_projection, ego_idx, current_obstacle_pose.pose.position);
     if (!ego_to_obstacle_distance) {
       RCLCPP_INFO_EXPRESSION(
         get_logger(), enable_debug_info_, "Ignore obstacle (%s) since it is not front obstacle.",
@@ -874,7 +880,7 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
     // 3. Check if rough lateral distance and time to reach trajectory are smaller than the
     // threshold
     const double lat_dist_from_obstacle_to_traj =
-      autoware::motion_utils::calcLateralOffset(traj_points, current_obstacle_pose.pose.position);
+      traj_projection.calcLateralOffset(current_obstacle_pose.pose.position);
 
     const double min_lat_dist_to_traj_poly = [&]() {
       const double obstacle_max_length = calcObstacleMaxLength(predicted_object.shape);
@@ -916,7 +922,9 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
 
 std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
   const Odometry & odometry, const PointCloud2 & pointcloud,
-  const std::vector<TrajectoryPoint> & traj_points, const std_msgs::msg::Header & traj_header) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+  const std_msgs::msg::Header & traj_header) const
 {
   stop_watch_.tic(__func__);
 
@@ -981,13 +989,13 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
       for (const auto & index : cluster_indices.indices) {
         const auto obstacle_point = toGeomPoint(filtered_points_ptr->points[index]);
         const auto current_lat_dist_from_obstacle_to_traj =
-          autoware::motion_utils::calcLateralOffset(traj_points, obstacle_point);
+          traj_projection.calcLateralOffset(obstacle_point);
         const auto min_lat_dist_to_traj_poly =
           std::abs(current_lat_dist_from_obstacle_to_traj) - vehicle_info_.vehicle_width_m;
 
         if (min_lat_dist_to_traj_poly < max_lat_margin) {
           const auto current_ego_to_obstacle_distance =
-            calcDistanceToFrontVehicle(traj_points, ego_idx, obstacle_point);
+            calcDistanceToFrontVehicle(traj_projection, ego_idx, obstacle_point);
           if (current_ego_to_obstacle_distance) {
             ego_to_obstacle_distance =
               std::min(ego_to_obstacle_distance, *current_ego_to_obstacle_distance);
@@ -1073,14 +1081,13 @@ bool ObstacleCruisePlannerNode::isSlowDownObstacle(const uint8_t label) const
 }
 
 bool ObstacleCruisePlannerNode::isFrontCollideObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
   const size_t first_collision_idx) const
 {
-  const auto obstacle_idx =
-    autoware::motion_utils::findNearestIndex(traj_points, obstacle.pose.position);
+  const auto obstacle_idx = traj_projection.findNearestIndex(obstacle.pose.position);
 
   const double obstacle_to_col_points_distance =
-    autoware::motion_utils::calcSignedArcLength(traj_points, obstacle_idx, first_collision_idx);
+    traj_projection.calcSignedArcLength(obstacle_idx, first_collision_idx);
   const double obstacle_max_length = calcObstacleMaxLength(obstacle.shape);
 
   // If the obstacle is far in front of the collision point, the obstacle is behind the ego.
@@ -1099,6 +1106,8 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstPredictedObjectObstacles(
   const auto decimated_traj_polys =
     createOneStepPolygons(decimated_traj_points, vehicle_info_, odometry.pose.pose);
   debug_data_ptr_->detection_polygons = decimated_traj_polys;
+  const obstacle_cruise_utils::TrajectoryProjection decimated_traj_projection(
+    decimated_traj_points, decimated_traj_polys);
 
   // determine ego's behavior from stop, cruise and slow down
   std::vector<StopObstacle> stop_obstacles;
@@ -1109,21 +1118,17 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstPredictedObjectObstacles(
     const auto obstacle_poly = autoware::universe_utils::toPolygon2d(obstacle.pose, obstacle.shape);
 
     // Calculate distance between trajectory and obstacle first
-    double precise_lat_dist = std::numeric_limits<double>::max();
-    for (const auto & traj_poly : decimated_traj_polys) {
-      const double current_precise_lat_dist = bg::distance(traj_poly, obstacle_poly);
-      precise_lat_dist = std::min(precise_lat_dist, current_precise_lat_dist);
-    }
+    const double precise_lat_dist = decimated_traj_projection.calcMinDistance(obstacle_poly);
 
     // Filter obstacles for cruise, stop and slow down
     const auto cruise_obstacle = createCruiseObstacle(
-      odometry, decimated_traj_points, decimated_traj_polys, obstacle, precise_lat_dist);
+      odometry, decimated_traj_points, decimated_traj_projection, obstacle, precise_lat_dist);
     if (cruise_obstacle) {
       cruise_obstacles.push_back(*cruise_obstacle);
       continue;
     }
     const auto stop_obstacle = createStopObstacleForPredictedObject(
-      odometry, decimated_traj_points, decimated_traj_polys, obstacle, precise_lat_dist);
+      odometry, decimated_traj_points, decimated_traj_projection, obstacle, precise_lat_dist);
     if (stop_obstacle) {
       stop_obstacles.push_back(*stop_obstacle);
       continue;
@@ -1137,7 +1142,8 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstPredictedObjectObstacles(
   }
   const auto & p = behavior_determination_param_;
   if (p.enable_yield) {
-    const auto yield_obstacles = findYieldCruiseObstacles(obstacles, decimated_traj_points);
+    const auto yield_obstacles =
+      findYieldCruiseObstacles(obstacles, decimated_traj_points, decimated_traj_projection);
     if (yield_obstacles) {
       for (const auto & y : yield_obstacles.value()) {
         // Check if there is no member with the same UUID in cruise_obstacles
@@ -1266,7 +1272,7 @@ std::vector<TrajectoryPoint> ObstacleCruisePlannerNode::decimateTrajectoryPoints
 
 std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
   const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
-  const std::vector<Polygon2d> & traj_polys, const Obstacle & obstacle,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
   const double precise_lat_dist)
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1295,7 +1301,7 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
     }
   }
 
-  if (isObstacleCrossing(traj_points, obstacle)) {
+  if (isObstacleCrossing(traj_points, traj_projection, obstacle)) {
     RCLCPP_INFO_EXPRESSION(
       get_logger(), enable_debug_info_,
       "[Cruise] Ignore obstacle (%s) since it's crossing the ego's trajectory..",
@@ -1307,14 +1313,14 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
     constexpr double epsilon = 1e-6;
     if (precise_lat_dist < epsilon) {
       // obstacle is inside the trajectory
-      return createCollisionPointsForInsideCruiseObstacle(traj_points, traj_polys, obstacle);
+      return createCollisionPointsForInsideCruiseObstacle(traj_points, traj_projection, obstacle);
     }
     // obstacle is outside the trajectory
     // If the ego is stopping, do not plan cruise for outside obstacles. Stop will be planned.
     if (odometry.twist.twist.linear.x < 0.1) {
       return std::nullopt;
     }
-    return createCollisionPointsForOutsideCruiseObstacle(traj_points, traj_polys, obstacle);
+    return createCollisionPointsForOutsideCruiseObstacle(traj_points, traj_projection, obstacle);
   }();
   if (!collision_points) {
     return std::nullopt;
@@ -1330,7 +1336,8 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
 }
 
 std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createYieldCruiseObstacle(
-  const Obstacle & obstacle, const std::vector<TrajectoryPoint> & traj_points)
+  const Obstacle & obstacle, const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection)
 {
   if (traj_points.empty()) return std::nullopt;
   // check label
@@ -1353,7 +1360,7 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createYieldCruiseObstac
     return std::nullopt;
   }
 
-  if (isObstacleCrossing(traj_points, obstacle)) {
+  if (isObstacleCrossing(traj_points, traj_projection, obstacle)) {
     RCLCPP_INFO_EXPRESSION(
       get_logger(), enable_debug_info_,
       "[Cruise] Ignore yield obstacle (%s) since it's crossing the ego's trajectory..",
@@ -1390,7 +1397,8 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createYieldCruiseObstac
 }
 
 std::optional<std::vector<CruiseObstacle>> ObstacleCruisePlannerNode::findYieldCruiseObstacles(
-  const std::vector<Obstacle> & obstacles, const std::vector<TrajectoryPoint> & traj_points)
+  const std::vector<Obstacle> & obstacles, const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection)
 {
   if (obstacles.empty() || traj_points.empty()) return std::nullopt;
   const auto & p = behavior_determination_param_;
@@ -1454,7 +1462,8 @@ std::optional<std::vector<CruiseObstacle>> ObstacleCruisePlannerNode::findYieldC
         longitudinal_distance_between_obstacles / moving_obstacle_speed <
         p.max_obstacles_collision_time;
       if (are_obstacles_aligned && obstacles_collide_within_threshold_time) {
-        const auto yield_obstacle = createYieldCruiseObstacle(moving_obstacle, traj_points);
+        const auto yield_obstacle =
+          createYieldCruiseObstacle(moving_obstacle, traj_points, traj_projection);
         if (yield_obstacle) {
           yield_obstacles.push_back(*yield_obstacle);
           using autoware::objects_of_interest_marker_interface::ColorName;
@@ -1470,7 +1479,8 @@ std::optional<std::vector<CruiseObstacle>> ObstacleCruisePlannerNode::findYieldC
 
 std::optional<std::vector<PointWithStamp>>
 ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
   const Obstacle & obstacle) const
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1517,7 +1527,7 @@ ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
   // calculate nearest collision point
   std::vector<size_t> collision_index;
   const auto collision_points = polygon_utils::getCollisionPoints(
-    traj_points, traj_polys, obstacle.stamp, resampled_predicted_paths.front(), obstacle.shape,
+    traj_points, traj_projection, obstacle.stamp, resampled_predicted_paths.front(), obstacle.shape,
     now(), is_driving_forward_, collision_index,
     calcObstacleMaxLength(obstacle.shape) + p.decimate_trajectory_step_length +
       std::hypot(
@@ -1528,7 +1538,8 @@ ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
 
 std::optional<std::vector<PointWithStamp>>
 ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
   const Obstacle & obstacle) const
 {
   const auto & p = behavior_determination_param_;
@@ -1562,7 +1573,7 @@ ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
   const auto getCollisionPoints = [&]() -> std::vector<PointWithStamp> {
     for (const auto & predicted_path : resampled_predicted_paths) {
       const auto collision_points = polygon_utils::getCollisionPoints(
-        traj_points, traj_polys, obstacle.stamp, predicted_path, obstacle.shape, now(),
+        traj_points, traj_projection, obstacle.stamp, predicted_path, obstacle.shape, now(),
         is_driving_forward_, collision_index,
         calcObstacleMaxLength(obstacle.shape) + p.decimate_trajectory_step_length +
           std::hypot(
@@ -1606,7 +1617,7 @@ ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
   // Note: Only using isFrontObstacle(), behind obstacles cannot be filtered
   // properly when the trajectory is crossing or overlapping.
   const size_t first_collision_index = collision_index.front();
-  if (!isFrontCollideObstacle(traj_points, obstacle, first_collision_index)) {
+  if (!isFrontCollideObstacle(traj_projection, obstacle, first_collision_index)) {
     return std::nullopt;
   }
   return collision_points;
@@ -1615,7 +1626,7 @@ ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
 std::optional<std::pair<geometry_msgs::msg::Point, double>>
 ObstacleCruisePlannerNode::createCollisionPointForOutsideStopObstacle(
   const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
-  const std::vector<Polygon2d> & traj_polys, const Obstacle & obstacle,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
   const PredictedPath & resampled_predicted_path, double max_lat_margin_for_stop) const
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1623,7 +1634,7 @@ ObstacleCruisePlannerNode::createCollisionPointForOutsideStopObstacle(
 
   std::vector<size_t> collision_index;
   const auto collision_points = polygon_utils::getCollisionPoints(
-    traj_points, traj_polys, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
+    traj_points, traj_projection, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
     is_driving_forward_, collision_index,
     calcObstacleMaxLength(obstacle.shape) + p.decimate_trajectory_step_length +
       std::hypot(
@@ -1641,7 +1652,7 @@ ObstacleCruisePlannerNode::createCollisionPointForOutsideStopObstacle(
   }
 
   const double collision_time_margin =
-    calcCollisionTimeMargin(odometry, collision_points, traj_points, is_driving_forward_);
+    calcCollisionTimeMargin(odometry, collision_points, traj_projection, is_driving_forward_);
   if (p.collision_time_margin < collision_time_margin) {
     RCLCPP_INFO_EXPRESSION(
       get_logger(), enable_debug_info_,
@@ -1657,7 +1668,7 @@ ObstacleCruisePlannerNode::createCollisionPointForOutsideStopObstacle(
 
 std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacleForPredictedObject(
   const Odometry & odometry, const std::vector<TrajectoryPoint> & traj_points,
-  const std::vector<Polygon2d> & traj_polys, const Obstacle & obstacle,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
   const double precise_lat_dist) const
 {
   const auto & p = behavior_determination_param_;
@@ -1710,7 +1721,8 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacleForPred
       [&]() -> std::optional<std::pair<geometry_msgs::msg::Point, double>> {
       for (const auto & predicted_path : resampled_predicted_paths) {
         const auto collision_point = createCollisionPointForOutsideStopObstacle(
-          odometry, traj_points, traj_polys, obstacle, predicted_path, max_lat_margin_for_stop);
+          odometry, traj_points, traj_projection, obstacle, predicted_path,
+          max_lat_margin_for_stop);
         if (collision_point) {
           return collision_point;
         }
@@ -1743,9 +1755,11 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacleForPred
   // calculate collision points with trajectory with lateral stop margin
   const auto traj_polys_with_lat_margin =
     createOneStepPolygons(traj_points, vehicle_info_, odometry.pose.pose, max_lat_margin_for_stop);
+  const obstacle_cruise_utils::TrajectoryProjection traj_projection_with_lat_margin(
+    traj_points, traj_polys_with_lat_margin);
 
   const auto collision_point = polygon_utils::getCollisionPoint(
-    traj_points, traj_polys_with_lat_margin, obstacle, is_driving_forward_, vehicle_info_);
+    traj_points, traj_projection_with_lat_margin, obstacle, is_driving_forward_, vehicle_info_);
   if (!collision_point) {
     return std::nullopt;
   }
@@ -1756,8 +1770,8 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacleForPred
                                    ? std::abs(vehicle_info_.max_longitudinal_offset_m)
                                    : std::abs(vehicle_info_.min_longitudinal_offset_m));
 
-  const double time_to_reach_stop_point =
-    calcTimeToReachCollisionPoint(odometry, collision_point->first, traj_points, abs_ego_offset);
+  const double time_to_reach_stop_point = calcTimeToReachCollisionPoint(
+    odometry, collision_point->first, traj_projection, abs_ego_offset);
   const bool is_transient_obstacle = [&]() {
     if (time_to_reach_stop_point <= p.collision_time_margin) {
       return false;
@@ -1776,7 +1790,8 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacleForPred
     tmp_future_obs.pose =
       future_obj_pose ? future_obj_pose.value() : resampled_predicted_paths.front().path.back();
     const auto future_collision_point = polygon_utils::getCollisionPoint(
-      traj_points, traj_polys_with_lat_margin, tmp_future_obs, is_driving_forward_, vehicle_info_);
+      traj_points, traj_projection_with_lat_margin, tmp_future_obs, is_driving_forward_,
+      vehicle_info_);
 
     return !future_collision_point;
   }();
@@ -1897,12 +1912,22 @@ std::optional<SlowDownObstacle> ObstacleCruisePlannerNode::createSlowDownObstacl
   const auto traj_polys_with_lat_margin = createOneStepPolygons(
     traj_points, vehicle_info_, odometry.pose.pose,
     p.max_lat_margin_for_slow_down + p.lat_hysteresis_margin_for_slow_down);
+  const obstacle_cruise_utils::TrajectoryProjection traj_projection_with_lat_margin(
+    traj_points, traj_polys_with_lat_margin);
 
   std::vector<Polygon2d> front_collision_polygons;
   size_t front_seg_idx = 0;
   std::vector<Polygon2d> back_collision_polygons;
   size_t back_seg_idx = 0;
-  for (size_t i = 0; i < traj_polys_with_lat_margin.size(); ++i) {
+  // NOTE: The polygons which are not candidates do not collide with the obstacle.
+  std::optional<size_t> prev_candidate_idx;
+  for (const size_t i : traj_projection_with_lat_margin.findCollisionCandidates(obstacle_poly)) {
+    const bool is_non_candidate_skipped = prev_candidate_idx && *prev_candidate_idx + 1 < i;
+    prev_candidate_idx = i;
+    if (!back_collision_polygons.empty() && is_non_candidate_skipped) {
+      break;  // for efficient calculation
+    }
+
     std::vector<Polygon2d> collision_polygons;
     bg::intersection(traj_polys_with_lat_margin.at(i), obstacle_poly, collision_polygons);
 
@@ -2028,9 +2053,12 @@ void ObstacleCruisePlannerNode::checkConsistency(
 }
 
 bool ObstacleCruisePlannerNode::isObstacleCrossing(
-  const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+  const Obstacle & obstacle) const
 {
-  const double diff_angle = calcDiffAngleAgainstTrajectory(traj_points, obstacle.pose);
+  const double diff_angle =
+    calcDiffAngleAgainstTrajectory(traj_points, traj_projection, obstacle.pose);
 
   // NOTE: Currently predicted objects does not have orientation availability even
   // though sometimes orientation is not available.
@@ -2048,7 +2076,8 @@ bool ObstacleCruisePlannerNode::isObstacleCrossing(
 
 double ObstacleCruisePlannerNode::calcCollisionTimeMargin(
   const Odometry & odometry, const std::vector<PointWithStamp> & collision_points,
-  const std::vector<TrajectoryPoint> & traj_points, const bool is_driving_forward) const
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+  const bool is_driving_forward) const
 {
   const auto & p = behavior_determination_param_;
   const double abs_ego_offset =
@@ -2056,7 +2085,7 @@ double ObstacleCruisePlannerNode::calcCollisionTimeMargin(
                                    ? std::abs(vehicle_info_.max_longitudinal_offset_m)
                                    : std::abs(vehicle_info_.min_longitudinal_offset_m));
   const double time_to_reach_stop_point = calcTimeToReachCollisionPoint(
-    odometry, collision_points.front().point, traj_points, abs_ego_offset);
+    odometry, collision_points.front().point, traj_projection, abs_ego_offset);
 
   const double time_to_leave_collision_point =
     time_to_reach_stop_point +
@@ -2254,12 +2283,12 @@ void ObstacleCruisePlannerNode::publishCalculationTime(const double calculation_
 
 double ObstacleCruisePlannerNode::calcTimeToReachCollisionPoint(
   const Odometry & odometry, const geometry_msgs::msg::Point & collision_point,
-  const std::vector<TrajectoryPoint> & traj_points, const double abs_ego_offset) const
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+  const double abs_ego_offset) const
 {
   const auto & p = behavior_determination_param_;
   const double dist_from_ego_to_obstacle =
-    std::abs(autoware::motion_utils::calcSignedArcLength(
-      traj_points, odometry.pose.pose.position, collision_point)) -
+    std::abs(traj_projection.calcSignedArcLength(odometry.pose.pose.position, collision_point)) -
     abs_ego_offset;
   return dist_from_ego_to_obstacle /
          std::max(p.min_velocity_to_reach_collision_point, std::abs(odometry.twist.twist.linear.x));
@@ -52,12 +52,16 @@ PointWithStamp calcNearestCollisionPoint(
 // NOTE: max_dist is used for efficient calculation to suppress boost::geometry's polygon
 // calculation.
 std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
   const geometry_msgs::msg::Pose & object_pose, const rclcpp::Time & object_time,
   const Shape & object_shape, const double max_dist = std::numeric_limits<double>::max())
 {
+  const auto & traj_polygons = traj_projection.polygons();
   const auto obj_polygon = autoware::universe_utils::toPolygon2d(object_pose, object_shape);
-  for (size_t i = 0; i < traj_polygons.size(); ++i) {
+
+  // NOTE: the polygons whose bounding circle does not reach the object polygon cannot collide
+  for (const size_t i : traj_projection.findCollisionCandidates(obj_polygon)) {
     const double approximated_dist =
       autoware::universe_utils::calcDistance2d(traj_points.at(i).pose, object_pose);
     if (approximated_dist > max_dist) {
@@ -101,9 +105,19 @@ std::optional<std::pair<geometry_msgs::msg::Point, double>> getCollisionPoint(
   const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
   const Obstacle & obstacle, const bool is_driving_forward,
   const autoware::vehicle_info_utils::VehicleInfo & vehicle_info)
+{
+  return getCollisionPoint(
+    traj_points, obstacle_cruise_utils::TrajectoryProjection(traj_points, traj_polygons), obstacle,
+    is_driving_forward, vehicle_info);
+}
+
+std::optional<std::pair<geometry_msgs::msg::Point, double>> getCollisionPoint(
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection, const Obstacle & obstacle,
+  const bool is_driving_forward, const autoware::vehicle_info_utils::VehicleInfo & vehicle_info)
 {
   const auto collision_info =
-    getCollisionIndex(traj_points, traj_polygons, obstacle.pose, obstacle.stamp, obstacle.shape);
+    getCollisionIndex(traj_points, traj_projection, obstacle.pose, obstacle.stamp, obstacle.shape);
   if (!collision_info) {
     return std::nullopt;
   }
@@ -169,6 +183,20 @@ std::vector<PointWithStamp> getCollisionPoints(
   const rclcpp::Time & current_time, const bool is_driving_forward,
   std::vector<size_t> & collision_index, const double max_lat_dist,
   const double max_prediction_time_for_collision_check)
+{
+  return getCollisionPoints(
+    traj_points, obstacle_cruise_utils::TrajectoryProjection(traj_points, traj_polygons),
+    obstacle_stamp, predicted_path, shape, current_time, is_driving_forward, collision_index,
+    max_lat_dist, max_prediction_time_for_collision_check);
+}
+
+std::vector<PointWithStamp> getCollisionPoints(
+  const std::vector<TrajectoryPoint> & traj_points,
+  const obstacle_cruise_utils::TrajectoryProjection & traj_projection,
+  const rclcpp::Time & obstacle_stamp, const PredictedPath & predicted_path, const Shape & shape,
+  const rclcpp::Time & current_time, const bool is_driving_forward,
+  std::vector<size_t> & collision_index, const double max_lat_dist,
+  const double max_prediction_time_for_collision_check)
 {
   std::vector<PointWithStamp> collision_points;
   for (size_t i = 0; i < predicted_path.path.size(); ++i) {
@@ -186,7 +214,7 @@ std::vector<PointWithStamp> getCollisionPoints(
     }
 
     const auto collision_info = getCollisionIndex(
-      traj_points, traj_polygons, predicted_path.path.at(i), object_time, shape, max_lat_dist);
+      traj_points, traj_projection, predicted_path.path.at(i), object_time, shape, max_lat_dist);
     if (collision_info) {
       const auto nearest_collision_point = calcNearestCollisionPoint(
         collision_info->first, collision_info->second, traj_points, is_driving_forward);
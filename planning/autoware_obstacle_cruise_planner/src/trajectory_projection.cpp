@@ -0,0 +1,161 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/obstacle_cruise_planner/trajectory_projection.hpp"
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+
+#include <boost/geometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace obstacle_cruise_utils
+{
+namespace
+{
+// NOTE: The bounding circles are enlarged by this margin so that the rounding errors of the circle
+// test never reject a polygon which boost::geometry would find in collision.
+constexpr double circle_margin = 1e-6;
+
+struct Circle
+{
+  double x;
+  double y;
+  double radius;
+};
+
+Circle calcBoundingCircle(const Polygon2d & polygon)
+{
+  if (polygon.outer().empty()) {
+    return {0.0, 0.0, std::numeric_limits<double>::infinity()};
+  }
+
+  autoware::universe_utils::Box2d box;
+  boost::geometry::envelope(polygon, box);
+  const double x = (box.min_corner().x() + box.max_corner().x()) * 0.5;
+  const double y = (box.min_corner().y() + box.max_corner().y()) * 0.5;
+  double radius = 0.0;
+  for (const auto & p : polygon.outer()) {
+    radius = std::max(radius, std::hypot(p.x() - x, p.y() - y));
+  }
+  return {x, y, radius + circle_margin};
+}
+}  // namespace
+
+TrajectoryProjection::TrajectoryProjection(
+  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons)
+: index_(traj_points), polygons_(traj_polygons)
+{
+  const auto overlap_removed_points = autoware::motion_utils::removeOverlapPoints(traj_points);
+  if (overlap_removed_points.size() != traj_points.size()) {
+    overlap_removed_index_.emplace(overlap_removed_points);
+  }
+  for (size_t i = 0; i + 1 < overlap_removed_points.size(); ++i) {
+    const auto & p_front = overlap_removed_points.at(i).pose.position;
+    const auto & p_back = overlap_removed_points.at(i + 1).pose.position;
+    const double dx = p_back.x - p_front.x;
+    const double dy = p_back.y - p_front.y;
+    seg_xs_.push_back(p_front.x);
+    seg_ys_.push_back(p_front.y);
+    seg_dxs_.push_back(dx);
+    seg_dys_.push_back(dy);
+    seg_lengths_.push_back(std::sqrt(dx * dx + dy * dy));
+  }
+
+  circle_xs_.reserve(polygons_.size());
+  circle_ys_.reserve(polygons_.size());
+  circle_radii_.reserve(polygons_.size());
+  for (const auto & polygon : polygons_) {
+    const auto circle = calcBoundingCircle(polygon);
+    circle_xs_.push_back(circle.x);
+    circle_ys_.push_back(circle.y);
+    circle_radii_.push_back(circle.radius);
+  }
+}
+
+size_t TrajectoryProjection::findNearestIndex(const geometry_msgs::msg::Point & point) const
+{
+  return index_.findNearestIndex(point);
+}
+
+double TrajectoryProjection::calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const
+{
+  return index_.calcSignedArcLength(src_idx, dst_idx);
+}
+
+double TrajectoryProjection::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const
+{
+  return index_.calcSignedArcLength(src_point, dst_point);
+}
+
+double TrajectoryProjection::calcLateralOffset(const geometry_msgs::msg::Point & point) const
+{
+  if (seg_xs_.empty()) {
+    return std::nan("");
+  }
+
+  const size_t seg_idx =
+    std::min(overlapRemovedIndex().findNearestSegmentIndex(point), seg_xs_.size() - 1);
+  const double target_x = point.x - seg_xs_[seg_idx];
+  const double target_y = point.y - seg_ys_[seg_idx];
+  return (seg_dxs_[seg_idx] * target_y - seg_dys_[seg_idx] * target_x) / seg_lengths_[seg_idx];
+}
+
+std::vector<size_t> TrajectoryProjection::findCollisionCandidates(const Polygon2d & polygon) const
+{
+  std::vector<size_t> candidate_indices;
+  const auto circle = calcBoundingCircle(polygon);
+  for (size_t i = 0; i < circle_xs_.size(); ++i) {
+    const double dx = circle_xs_[i] - circle.x;
+    const double dy = circle_ys_[i] - circle.y;
+    const double radius = circle_radii_[i] + circle.radius;
+    if (dx * dx + dy * dy <= radius * radius) {
+      candidate_indices.push_back(i);
+    }
+  }
+  return candidate_indices;
+}
+
+double TrajectoryProjection::calcMinDistance(const Polygon2d & polygon) const
+{
+  if (polygons_.empty()) {
+    return std::numeric_limits<double>::max();
+  }
+
+  // lower bounds of the distances given by the bounding circles
+  const auto circle = calcBoundingCircle(polygon);
+  std::vector<double> lower_bounds(polygons_.size());
+  for (size_t i = 0; i < polygons_.size(); ++i) {
+    const double dx = circle_xs_[i] - circle.x;
+    const double dy = circle_ys_[i] - circle.y;
+    lower_bounds[i] = std::sqrt(dx * dx + dy * dy) - circle_radii_[i] - circle.radius;
+  }
+
+  // start from the most promising polygon so that the others are mostly skipped
+  const size_t first_idx =
+    std::min_element(lower_bounds.begin(), lower_bounds.end()) - lower_bounds.begin();
+  double min_dist = boost::geometry::distance(polygons_.at(first_idx), polygon);
+  for (size_t i = 0; i < polygons_.size() && 0.0 < min_dist; ++i) {
+    if (i == first_idx || min_dist <= lower_bounds[i]) {
+      continue;
+    }
+    min_dist = std::min(min_dist, boost::geometry::distance(polygons_.at(i), polygon));
+  }
+  return min_dist;
+}
+}  // namespace obstacle_cruise_utils
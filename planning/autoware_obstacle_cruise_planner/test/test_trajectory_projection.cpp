@@ -0,0 +1,142 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+#include "autoware/obstacle_cruise_planner/trajectory_projection.hpp"
+
+#include <boost/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using obstacle_cruise_utils::Polygon2d;
+using obstacle_cruise_utils::TrajectoryProjection;
+
+std::vector<TrajectoryPoint> generateTrajectory(const size_t size, const double curvature)
+{
+  std::vector<TrajectoryPoint> traj_points;
+  double x = 0.0;
+  double y = 0.0;
+  double yaw = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    TrajectoryPoint p;
+    p.pose.position.x = x;
+    p.pose.position.y = y;
+    p.pose.orientation.z = std::sin(yaw / 2.0);
+    p.pose.orientation.w = std::cos(yaw / 2.0);
+    traj_points.push_back(p);
+    x += std::cos(yaw);
+    y += std::sin(yaw);
+    yaw += curvature;
+  }
+  return traj_points;
+}
+
+Polygon2d createBox(const double x, const double y, const double yaw, const double half_length)
+{
+  Polygon2d polygon;
+  for (const auto & [lon, lat] :
+       std::vector<std::pair<double, double>>{{1.0, 1.0}, {1.0, -1.0}, {-1.0, -1.0}, {-1.0, 1.0}}) {
+    polygon.outer().emplace_back(
+      x + half_length * (lon * std::cos(yaw) - lat * std::sin(yaw)),
+      y + half_length * (lon * std::sin(yaw) + lat * std::cos(yaw)));
+  }
+  polygon.outer().push_back(polygon.outer().front());
+  boost::geometry::correct(polygon);
+  return polygon;
+}
+
+std::vector<Polygon2d> createPolygons(const std::vector<TrajectoryPoint> & traj_points)
+{
+  std::vector<Polygon2d> polygons;
+  for (const auto & p : traj_points) {
+    polygons.push_back(createBox(p.pose.position.x, p.pose.position.y, 0.3, 1.5));
+  }
+  return polygons;
+}
+}  // namespace
+
+TEST(trajectory_projection, projection)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist(-20.0, 40.0);
+
+  for (const double curvature : {0.0, 0.05, 0.3}) {
+    auto traj_points = generateTrajectory(40, curvature);
+    // overlapping points are skipped by the lateral offset
+    traj_points.insert(traj_points.begin() + 10, traj_points.at(10));
+    const TrajectoryProjection traj_projection(traj_points);
+    ASSERT_EQ(traj_projection.size(), traj_points.size());
+
+    for (size_t i = 0; i < 200; ++i) {
+      geometry_msgs::msg::Point point;
+      point.x = dist(engine);
+      point.y = dist(engine);
+      const size_t nearest_idx = traj_projection.findNearestIndex(point);
+      EXPECT_EQ(nearest_idx, autoware::motion_utils::findNearestIndex(traj_points, point));
+      EXPECT_NEAR(
+        traj_projection.calcSignedArcLength(0, nearest_idx),
+        autoware::motion_utils::calcSignedArcLength(traj_points, 0, nearest_idx), 1e-6);
+      EXPECT_NEAR(
+        traj_projection.calcLateralOffset(point),
+        autoware::motion_utils::calcLateralOffset(traj_points, point), 1e-6);
+    }
+  }
+
+  // less than two distinct points
+  const auto traj_points = generateTrajectory(1, 0.0);
+  EXPECT_TRUE(std::isnan(TrajectoryProjection(traj_points).calcLateralOffset({})));
+}
+
+TEST(trajectory_projection, polygons)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist(-20.0, 40.0);
+  std::uniform_real_distribution<double> yaw_dist(-M_PI, M_PI);
+
+  const auto traj_points = generateTrajectory(40, 0.1);
+  const auto traj_polygons = createPolygons(traj_points);
+  const TrajectoryProjection traj_projection(traj_points, traj_polygons);
+  ASSERT_EQ(traj_projection.polygons().size(), traj_polygons.size());
+
+  for (size_t i = 0; i < 500; ++i) {
+    const auto polygon = createBox(dist(engine), dist(engine), yaw_dist(engine), 1.0);
+
+    const auto candidate_indices = traj_projection.findCollisionCandidates(polygon);
+    EXPECT_TRUE(std::is_sorted(candidate_indices.begin(), candidate_indices.end()));
+    double expected_min_dist = std::numeric_limits<double>::max();
+    for (size_t j = 0; j < traj_polygons.size(); ++j) {
+      expected_min_dist =
+        std::min(expected_min_dist, boost::geometry::distance(traj_polygons.at(j), polygon));
+      if (boost::geometry::intersects(traj_polygons.at(j), polygon)) {
+        EXPECT_TRUE(
+          std::find(candidate_indices.begin(), candidate_indices.end(), j) !=
+          candidate_indices.end());
+      }
+    }
+    EXPECT_DOUBLE_EQ(traj_projection.calcMinDistance(polygon), expected_min_dist);
+  }
+
+  EXPECT_EQ(
+    TrajectoryProjection(traj_points).calcMinDistance(createBox(0.0, 0.0, 0.0, 1.0)),
+    std::numeric_limits<double>::max());
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <string>
@@ -76,6 +77,7 @@ ObstacleStopPlannerNode::ObstacleStopPlannerNode(const rclcpp::NodeOptions & nod
     p.voxel_grid_z = declare_parameter<double>("voxel_grid_z");
     p.use_predicted_objects = declare_parameter<bool>("use_predicted_objects");
     p.publish_obstacle_polygon = declare_parameter<bool>("publish_obstacle_polygon");
+    p.enable_swept_corridor_search = declare_parameter<bool>("enable_swept_corridor_search");
     p.predicted_object_filtering_threshold =
       declare_parameter<double>("predicted_object_filtering_threshold");
   }
@@ -410,98 +412,104 @@ void ObstacleStopPlannerNode::searchObstacle(
 
   updateObstacleHistory(now);
 
-  for (size_t i = 0; i < decimate_trajectory.size() - 1; ++i) {
-    // create one step circle center for vehicle
-    const auto & p_front = decimate_trajectory.at(i).pose;
-    const auto & p_back = decimate_trajectory.at(i + 1).pose;
-    const auto z_axis_min = p_front.position.z;
-    const auto z_axis_max =
-      p_front.position.z + vehicle_info.vehicle_height_m + node_param_.z_axis_filtering_buffer;
-    const auto prev_center_pose = getVehicleCenterFromBase(p_front, vehicle_info);
-    const Point2d prev_center_point(prev_center_pose.position.x, prev_center_pose.position.y);
-    const auto next_center_pose = getVehicleCenterFromBase(p_back, vehicle_info);
-    const Point2d next_center_point(next_center_pose.position.x, next_center_pose.position.y);
-
-    if (node_param_.enable_slow_down) {
-      Polygon2d one_step_move_slow_down_range_polygon;
-      // create one step polygon for slow_down range
-      createOneStepPolygon(
-        p_front, p_back, one_step_move_slow_down_range_polygon, vehicle_info,
-        slow_down_param_.lateral_margin);
-      debug_ptr_->pushPolygon(
-        one_step_move_slow_down_range_polygon, p_front.position.z, PolygonType::SlowDownRange);
-
-      if (node_param_.enable_z_axis_obstacle_filtering) {
-        planner_data.found_slow_down_points = withinPolyhedron(
-          one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
-          prev_center_point, next_center_point, obstacle_candidate_pointcloud_ptr,
-          slow_down_pointcloud_ptr, z_axis_min, z_axis_max);
-      } else {
-        planner_data.found_slow_down_points = withinPolygon(
-          one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
-          prev_center_point, next_center_point, obstacle_candidate_pointcloud_ptr,
-          slow_down_pointcloud_ptr);
-      }
-      const auto found_first_slow_down_points =
-        planner_data.found_slow_down_points && !planner_data.slow_down_require;
-
-      if (found_first_slow_down_points) {
-        // found nearest slow down obstacle
-        planner_data.decimate_trajectory_slow_down_index = i;
-        planner_data.slow_down_require = true;
-        getNearestPoint(
-          *slow_down_pointcloud_ptr, p_front, &planner_data.nearest_slow_down_point,
-          &planner_data.nearest_collision_point_time);
-        getLateralNearestPoint(
-          *slow_down_pointcloud_ptr, p_front, &planner_data.lateral_nearest_slow_down_point,
-          &planner_data.lateral_deviation);
-
-        debug_ptr_->pushObstaclePoint(planner_data.nearest_slow_down_point, PointType::SlowDown);
+  if (node_param_.enable_swept_corridor_search) {
+    searchObstacleInSweptCorridor(
+      decimate_trajectory, planner_data, vehicle_info, stop_param,
+      *obstacle_candidate_pointcloud_ptr, now);
+  } else {
+    for (size_t i = 0; i < decimate_trajectory.size() - 1; ++i) {
+      // create one step circle center for vehicle
+      const auto & p_front = decimate_trajectory.at(i).pose;
+      const auto & p_back = decimate_trajectory.at(i + 1).pose;
+      const auto z_axis_min = p_front.position.z;
+      const auto z_axis_max =
+        p_front.position.z + vehicle_info.vehicle_height_m + node_param_.z_axis_filtering_buffer;
+      const auto prev_center_pose = getVehicleCenterFromBase(p_front, vehicle_info);
+      const Point2d prev_center_point(prev_center_pose.position.x, prev_center_pose.position.y);
+      const auto next_center_pose = getVehicleCenterFromBase(p_back, vehicle_info);
+      const Point2d next_center_point(next_center_pose.position.x, next_center_pose.position.y);
+
+      if (node_param_.enable_slow_down) {
+        Polygon2d one_step_move_slow_down_range_polygon;
+        // create one step polygon for slow_down range
+        createOneStepPolygon(
+          p_front, p_back, one_step_move_slow_down_range_polygon, vehicle_info,
+          slow_down_param_.lateral_margin);
         debug_ptr_->pushPolygon(
-          one_step_move_slow_down_range_polygon, p_front.position.z, PolygonType::SlowDown);
-      }
+          one_step_move_slow_down_range_polygon, p_front.position.z, PolygonType::SlowDownRange);
 
-    } else {
-      slow_down_pointcloud_ptr = obstacle_candidate_pointcloud_ptr;
-    }
+        if (node_param_.enable_z_axis_obstacle_filtering) {
+          planner_data.found_slow_down_points = withinPolyhedron(
+            one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
+            prev_center_point, next_center_point, obstacle_candidate_pointcloud_ptr,
+            slow_down_pointcloud_ptr, z_axis_min, z_axis_max);
+        } else {
+          planner_data.found_slow_down_points = withinPolygon(
+            one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
+            prev_center_point, next_center_point, obstacle_candidate_pointcloud_ptr,
+            slow_down_pointcloud_ptr);
+        }
+        const auto found_first_slow_down_points =
+          planner_data.found_slow_down_points && !planner_data.slow_down_require;
+
+        if (found_first_slow_down_points) {
+          // found nearest slow down obstacle
+          planner_data.decimate_trajectory_slow_down_index = i;
+          planner_data.slow_down_require = true;
+          getNearestPoint(
+            *slow_down_pointcloud_ptr, p_front, &planner_data.nearest_slow_down_point,
+            &planner_data.nearest_collision_point_time);
+          getLateralNearestPoint(
+            *slow_down_pointcloud_ptr, p_front, &planner_data.lateral_nearest_slow_down_point,
+            &planner_data.lateral_deviation);
+
+          debug_ptr_->pushObstaclePoint(planner_data.nearest_slow_down_point, PointType::SlowDown);
+          debug_ptr_->pushPolygon(
+            one_step_move_slow_down_range_polygon, p_front.position.z, PolygonType::SlowDown);
+        }
 
-    {
-      Polygon2d one_step_move_vehicle_polygon;
-      // create one step polygon for vehicle
-      createOneStepPolygon(
-        p_front, p_back, one_step_move_vehicle_polygon, vehicle_info, stop_param.lateral_margin);
-      if (node_param_.enable_z_axis_obstacle_filtering) {
-        debug_ptr_->pushPolyhedron(
-          one_step_move_vehicle_polygon, z_axis_min, z_axis_max, PolygonType::Vehicle);
       } else {
-        debug_ptr_->pushPolygon(
-          one_step_move_vehicle_polygon, p_front.position.z, PolygonType::Vehicle);
+        slow_down_pointcloud_ptr = obstacle_candidate_pointcloud_ptr;
       }
 
-      PointCloud::Ptr collision_pointcloud_ptr(new PointCloud);
-      collision_pointcloud_ptr->header = obstacle_candidate_pointcloud_ptr->header;
+      {
+        Polygon2d one_step_move_vehicle_polygon;
+        // create one step polygon for vehicle
+        createOneStepPolygon(
+          p_front, p_back, one_step_move_vehicle_polygon, vehicle_info, stop_param.lateral_margin);
+        if (node_param_.enable_z_axis_obstacle_filtering) {
+          debug_ptr_->pushPolyhedron(
+            one_step_move_vehicle_polygon, z_axis_min, z_axis_max, PolygonType::Vehicle);
+        } else {
+          debug_ptr_->pushPolygon(
+            one_step_move_vehicle_polygon, p_front.position.z, PolygonType::Vehicle);
+        }
 
-      const auto found_collision_points =
-        node_param_.enable_z_axis_obstacle_filtering
-          ? withinPolyhedron(
-              one_step_move_vehicle_polygon, stop_param.stop_search_radius, prev_center_point,
-              next_center_point, slow_down_pointcloud_ptr, collision_pointcloud_ptr, z_axis_min,
-              z_axis_max)
-          : withinPolygon(
-              one_step_move_vehicle_polygon, stop_param.stop_search_radius, prev_center_point,
-              next_center_point, slow_down_pointcloud_ptr, collision_pointcloud_ptr);
+        PointCloud::Ptr collision_pointcloud_ptr(new PointCloud);
+        collision_pointcloud_ptr->header = obstacle_candidate_pointcloud_ptr->header;
 
-      if (found_collision_points) {
-        pcl::PointXYZ nearest_collision_point;
-        rclcpp::Time nearest_collision_point_time;
+        const auto found_collision_points =
+          node_param_.enable_z_axis_obstacle_filtering
+            ? withinPolyhedron(
+                one_step_move_vehicle_polygon, stop_param.stop_search_radius, prev_center_point,
+                next_center_point, slow_down_pointcloud_ptr, collision_pointcloud_ptr, z_axis_min,
+                z_axis_max)
+            : withinPolygon(
+                one_step_move_vehicle_polygon, stop_param.stop_search_radius, prev_center_point,
+                next_center_point, slow_down_pointcloud_ptr, collision_pointcloud_ptr);
 
-        getNearestPoint(
-          *collision_pointcloud_ptr, p_front, &nearest_collision_point,
-          &nearest_collision_point_time);
+        if (found_collision_points) {
+          pcl::PointXYZ nearest_collision_point;
+          rclcpp::Time nearest_collision_point_time;
 
-        obstacle_history_.emplace_back(now, nearest_collision_point);
+          getNearestPoint(
+            *collision_pointcloud_ptr, p_front, &nearest_collision_point,
+            &nearest_collision_point_time);
 
-        break;
+          obstacle_history_.emplace_back(now, nearest_collision_point);
+
+          break;
+        }
       }
     }
   }
@@ -587,6 +595,78 @@ void ObstacleStopPlannerNode::searchObstacle(
   }
 }
 
+void ObstacleStopPlannerNode::searchObstacleInSweptCorridor(
+  const TrajectoryPoints & decimate_trajectory, PlannerData & planner_data,
+  const VehicleInfo & vehicle_info, const StopParam & stop_param,
+  const PointCloud & obstacle_candidate_pointcloud, const rclcpp::Time & now)
+{
+  // there is no step to check as in the polygon scan
+  if (decimate_trajectory.size() < 2) {
+    return;
+  }
+
+  SweptCorridorSearchParam param;
+  param.enable_slow_down = node_param_.enable_slow_down;
+  param.slow_down_lateral_margin = slow_down_param_.lateral_margin;
+  param.slow_down_search_radius = slow_down_param_.slow_down_search_radius;
+  param.stop_lateral_margin = stop_param.lateral_margin;
+  param.stop_search_radius = stop_param.stop_search_radius;
+  param.enable_z_axis_obstacle_filtering = node_param_.enable_z_axis_obstacle_filtering;
+  param.z_axis_filtering_buffer = node_param_.z_axis_filtering_buffer;
+  const auto result =
+    searchSweptCorridor(decimate_trajectory, obstacle_candidate_pointcloud, vehicle_info, param);
+
+  // scan the steps in order until the first collision
+  const size_t last_step =
+    result.collision_step ? *result.collision_step : result.vehicle_polygons.size() - 1;
+  for (size_t i = 0; i <= last_step; ++i) {
+    const auto & p_front = decimate_trajectory.at(i).pose;
+    const auto z_axis_min = p_front.position.z;
+    const auto z_axis_max =
+      p_front.position.z + vehicle_info.vehicle_height_m + node_param_.z_axis_filtering_buffer;
+
+    if (param.enable_slow_down) {
+      const auto & slow_down_range_polygon = result.slow_down_range_polygons.at(i);
+      debug_ptr_->pushPolygon(
+        slow_down_range_polygon, p_front.position.z, PolygonType::SlowDownRange);
+
+      if (result.slow_down_step == i && !planner_data.slow_down_require) {
+        // found nearest slow down obstacle
+        planner_data.found_slow_down_points = true;
+        planner_data.decimate_trajectory_slow_down_index = i;
+        planner_data.slow_down_require = true;
+        getNearestPoint(
+          result.slow_down_pointcloud, p_front, &planner_data.nearest_slow_down_point,
+          &planner_data.nearest_collision_point_time);
+        getLateralNearestPoint(
+          result.slow_down_pointcloud, p_front, &planner_data.lateral_nearest_slow_down_point,
+          &planner_data.lateral_deviation);
+
+        debug_ptr_->pushObstaclePoint(planner_data.nearest_slow_down_point, PointType::SlowDown);
+        debug_ptr_->pushPolygon(slow_down_range_polygon, p_front.position.z, PolygonType::SlowDown);
+      }
+    }
+
+    if (node_param_.enable_z_axis_obstacle_filtering) {
+      debug_ptr_->pushPolyhedron(
+        result.vehicle_polygons.at(i), z_axis_min, z_axis_max, PolygonType::Vehicle);
+    } else {
+      debug_ptr_->pushPolygon(
+        result.vehicle_polygons.at(i), p_front.position.z, PolygonType::Vehicle);
+    }
+  }
+
+  if (result.collision_step) {
+    pcl::PointXYZ nearest_collision_point;
+    rclcpp::Time nearest_collision_point_time;
+    getNearestPoint(
+      result.collision_pointcloud, decimate_trajectory.at(*result.collision_step).pose,
+      &nearest_collision_point, &nearest_collision_point_time);
+
+    obstacle_history_.emplace_back(now, nearest_collision_point);
+  }
+}
+
 void ObstacleStopPlannerNode::searchPredictedObject(
   const TrajectoryPoints & decimate_trajectory, TrajectoryPoints & output,
   PlannerData & planner_data, const Header & trajectory_header, const VehicleInfo & vehicle_info,
@@ -202,6 +202,13 @@ private:
     PlannerData & planner_data, const Header & trajectory_header, const VehicleInfo & vehicle_info,
     const StopParam & stop_param, const PointCloud2::SharedPtr obstacle_ros_pointcloud_ptr);
 
+  // same result as the step by step polygon scan of searchObstacle, but each candidate point is
+  // only tested against the steps around it
+  void searchObstacleInSweptCorridor(
+    const TrajectoryPoints & decimate_trajectory, PlannerData & planner_data,
+    const VehicleInfo & vehicle_info, const StopParam & stop_param,
+    const PointCloud & obstacle_candidate_pointcloud, const rclcpp::Time & now);
+
   void searchPredictedObject(
     const TrajectoryPoints & decimate_trajectory, TrajectoryPoints & output,
     PlannerData & planner_data, const Header & trajectory_header, const VehicleInfo & vehicle_info,
@@ -96,6 +96,10 @@ struct NodeParam
 
   // If use_predicted_objects is true, node publishes collision polygon
   bool publish_obstacle_polygon;
+
+  // set True, assign the pointcloud to the trajectory steps around each point instead of testing
+  // all the points at every step
+  bool enable_swept_corridor_search;
 };
 
 struct StopParam
@@ -30,10 +30,14 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace autoware::motion_planning
 {
@@ -509,6 +513,158 @@ pcl::PointXYZ pointToPcl(const double x, const double y, const double z)
   return {pcl_x, pcl_y, pcl_z};
 }
 
+SweptCorridorSearchResult searchSweptCorridor(
+  const TrajectoryPoints & decimate_trajectory, const PointCloud & candidate_pointcloud,
+  const VehicleInfo & vehicle_info, const SweptCorridorSearchParam & param)
+{
+  SweptCorridorSearchResult result;
+  if (decimate_trajectory.size() < 2) {
+    return result;
+  }
+
+  const size_t step_num = decimate_trajectory.size() - 1;
+  const bool enable_slow_down = param.enable_slow_down;
+  const double slow_down_radius = param.slow_down_search_radius;
+  const double stop_radius = param.stop_search_radius;
+
+  // create the one step polygons and circle centers of all the steps
+  std::vector<Point2d> center_points;
+  center_points.reserve(decimate_trajectory.size());
+  for (const auto & trajectory_point : decimate_trajectory) {
+    const auto center_pose = getVehicleCenterFromBase(trajectory_point.pose, vehicle_info);
+    center_points.emplace_back(center_pose.position.x, center_pose.position.y);
+  }
+  auto & slow_down_range_polygons = result.slow_down_range_polygons;
+  auto & vehicle_polygons = result.vehicle_polygons;
+  slow_down_range_polygons.resize(enable_slow_down ? step_num : 0);
+  vehicle_polygons.resize(step_num);
+  for (size_t i = 0; i < step_num; ++i) {
+    const auto & p_front = decimate_trajectory.at(i).pose;
+    const auto & p_back = decimate_trajectory.at(i + 1).pose;
+    if (enable_slow_down) {
+      createOneStepPolygon(
+        p_front, p_back, slow_down_range_polygons.at(i), vehicle_info,
+        param.slow_down_lateral_margin);
+    }
+    createOneStepPolygon(
+      p_front, p_back, vehicle_polygons.at(i), vehicle_info, param.stop_lateral_margin);
+  }
+
+  // grid of the circle centers, a step is a candidate for a point only if one of its centers is
+  // within the search radius, i.e. in the neighboring cells
+  const double cell_size =
+    std::max(enable_slow_down ? std::max(slow_down_radius, stop_radius) : stop_radius, 1e-3);
+  const auto to_cell_index = [&](const double v) {
+    return static_cast<int64_t>(std::floor(v / cell_size));
+  };
+  const auto to_cell_key = [](const int64_t ix, const int64_t iy) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(ix)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(iy));
+  };
+  std::unordered_map<uint64_t, std::vector<size_t>> center_grid;
+  for (size_t i = 0; i < center_points.size(); ++i) {
+    const auto & center_point = center_points.at(i);
+    center_grid[to_cell_key(to_cell_index(center_point.x()), to_cell_index(center_point.y()))]
+      .push_back(i);
+  }
+
+  // same condition as withinPolygon and withinPolyhedron
+  const auto is_within = [&](
+                           const pcl::PointXYZ & point, const size_t step,
+                           const Polygon2d & polygon, const double radius) {
+    const Point2d point2d(point.x, point.y);
+    if (
+      bg::distance(center_points.at(step), point2d) >= radius &&
+      bg::distance(center_points.at(step + 1), point2d) >= radius) {
+      return false;
+    }
+    if (!bg::within(point2d, polygon)) {
+      return false;
+    }
+    if (!param.enable_z_axis_obstacle_filtering) {
+      return true;
+    }
+    const auto z_axis_min = decimate_trajectory.at(step).pose.position.z;
+    const auto z_axis_max =
+      z_axis_min + vehicle_info.vehicle_height_m + param.z_axis_filtering_buffer;
+    return point.z < z_axis_max && point.z > z_axis_min;
+  };
+
+  // find the first slow down step and the first collision step of each point
+  constexpr size_t no_step = std::numeric_limits<size_t>::max();
+  const size_t point_num = candidate_pointcloud.size();
+  std::vector<size_t> first_slow_down_steps(point_num, no_step);
+  std::vector<size_t> first_collision_steps(point_num, no_step);
+  size_t collision_step = no_step;
+  std::vector<size_t> candidate_steps;
+  for (size_t k = 0; k < point_num; ++k) {
+    const auto & point = candidate_pointcloud.at(k);
+    candidate_steps.clear();
+    const int64_t ix = to_cell_index(point.x);
+    const int64_t iy = to_cell_index(point.y);
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        const auto itr = center_grid.find(to_cell_key(ix + dx, iy + dy));
+        if (itr == center_grid.end()) continue;
+        for (const size_t center_idx : itr->second) {
+          if (0 < center_idx) candidate_steps.push_back(center_idx - 1);
+          if (center_idx < step_num) candidate_steps.push_back(center_idx);
+        }
+      }
+    }
+    std::sort(candidate_steps.begin(), candidate_steps.end());
+    candidate_steps.erase(
+      std::unique(candidate_steps.begin(), candidate_steps.end()), candidate_steps.end());
+
+    size_t first_slow_down_step = enable_slow_down ? no_step : 0;
+    for (const size_t step : candidate_steps) {
+      if (!enable_slow_down || collision_step < step) break;
+      if (is_within(point, step, slow_down_range_polygons.at(step), slow_down_radius)) {
+        first_slow_down_step = step;
+        break;
+      }
+    }
+    first_slow_down_steps.at(k) = first_slow_down_step;
+    if (first_slow_down_step == no_step) continue;
+
+    for (const size_t step : candidate_steps) {
+      if (collision_step < step) break;
+      if (step < first_slow_down_step) continue;
+      if (is_within(point, step, vehicle_polygons.at(step), stop_radius)) {
+        first_collision_steps.at(k) = step;
+        collision_step = std::min(collision_step, step);
+        break;
+      }
+    }
+  }
+
+  if (enable_slow_down && point_num != 0) {
+    const size_t slow_down_step =
+      *std::min_element(first_slow_down_steps.begin(), first_slow_down_steps.end());
+    if (slow_down_step != no_step && slow_down_step <= collision_step) {
+      result.slow_down_step = slow_down_step;
+      result.slow_down_pointcloud.header = candidate_pointcloud.header;
+      for (size_t k = 0; k < point_num; ++k) {
+        if (first_slow_down_steps.at(k) == slow_down_step) {
+          result.slow_down_pointcloud.push_back(candidate_pointcloud.at(k));
+        }
+      }
+    }
+  }
+
+  if (collision_step != no_step) {
+    result.collision_step = collision_step;
+    result.collision_pointcloud.header = candidate_pointcloud.header;
+    for (size_t k = 0; k < point_num; ++k) {
+      if (first_collision_steps.at(k) == collision_step) {
+        result.collision_pointcloud.push_back(candidate_pointcloud.at(k));
+      }
+    }
+  }
+
+  return result;
+}
+
 void getNearestPoint(
   const PointCloud & pointcloud, const Pose & base_pose, pcl::PointXYZ * nearest_collision_point,
   rclcpp::Time * nearest_collision_point_time)
@@ -29,6 +29,7 @@
 #include <geometry_msgs/msg/pose_array.hpp>
 
 #include <map>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -92,6 +93,38 @@ void createOneStepPolygon(
   const Pose & base_step_pose, const Pose & next_step_pose, Polygon2d & hull_polygon,
   const VehicleInfo & vehicle_info, const double expand_width = 0.0);
 
+struct SweptCorridorSearchParam
+{
+  bool enable_slow_down;
+  double slow_down_lateral_margin;
+  double slow_down_search_radius;
+  double stop_lateral_margin;
+  double stop_search_radius;
+  bool enable_z_axis_obstacle_filtering;
+  double z_axis_filtering_buffer;
+};
+
+struct SweptCorridorSearchResult
+{
+  // one step polygons of the steps, where the slow down ones are empty if slow down is disabled
+  std::vector<Polygon2d> slow_down_range_polygons;
+  std::vector<Polygon2d> vehicle_polygons;
+  // first step with slow down points and the points found at that step
+  std::optional<size_t> slow_down_step;
+  PointCloud slow_down_pointcloud;
+  // first step with collision points and the points found at that step
+  std::optional<size_t> collision_step;
+  PointCloud collision_pointcloud;
+};
+
+// same result as the step by step scan with withinPolygon or withinPolyhedron, where a point is a
+// collision point only from the step where it is found in the slow down range and the steps after
+// the first collision are not checked. Each candidate point is only tested against the steps whose
+// circle centers are around it.
+SweptCorridorSearchResult searchSweptCorridor(
+  const TrajectoryPoints & decimate_trajectory, const PointCloud & candidate_pointcloud,
+  const VehicleInfo & vehicle_info, const SweptCorridorSearchParam & param);
+
 void getNearestPoint(
   const PointCloud & pointcloud, const Pose & base_pose, pcl::PointXYZ * nearest_collision_point,
   rclcpp::Time * nearest_collision_point_time);
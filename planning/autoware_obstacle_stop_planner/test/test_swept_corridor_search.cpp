@@ -0,0 +1,203 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "planner_utils.hpp"
+
+#include <autoware/universe_utils/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using autoware::motion_planning::PointCloud;
+using autoware::motion_planning::SweptCorridorSearchParam;
+using autoware::motion_planning::TrajectoryPoints;
+using autoware::vehicle_info_utils::VehicleInfo;
+
+struct ScanResult
+{
+  std::optional<size_t> slow_down_step;
+  PointCloud slow_down_pointcloud;
+  std::optional<size_t> collision_step;
+  PointCloud collision_pointcloud;
+};
+
+// step by step polygon scan of ObstacleStopPlannerNode::searchObstacle
+ScanResult scanPolygons(
+  const TrajectoryPoints & decimate_trajectory, const PointCloud & candidate_pointcloud,
+  const VehicleInfo & vehicle_info, const SweptCorridorSearchParam & param)
+{
+  using autoware::motion_planning::createOneStepPolygon;
+  using autoware::motion_planning::getVehicleCenterFromBase;
+  using autoware::motion_planning::Point2d;
+  using autoware::motion_planning::Polygon2d;
+
+  ScanResult result;
+  const auto candidate_pointcloud_ptr = PointCloud::Ptr(new PointCloud(candidate_pointcloud));
+  auto slow_down_pointcloud_ptr = PointCloud::Ptr(new PointCloud);
+  const auto within = [&](
+                        const Polygon2d & polygon, const double radius, const Point2d & prev_point,
+                        const Point2d & next_point, const PointCloud::Ptr & src,
+                        const PointCloud::Ptr & dst, const double z_min, const double z_max) {
+    return param.enable_z_axis_obstacle_filtering
+             ? autoware::motion_planning::withinPolyhedron(
+                 polygon, radius, prev_point, next_point, src, dst, z_min, z_max)
+             : autoware::motion_planning::withinPolygon(
+                 polygon, radius, prev_point, next_point, src, dst);
+  };
+
+  for (size_t i = 0; i + 1 < decimate_trajectory.size(); ++i) {
+    const auto & p_front = decimate_trajectory.at(i).pose;
+    const auto & p_back = decimate_trajectory.at(i + 1).pose;
+    const auto z_axis_min = p_front.position.z;
+    const auto z_axis_max =
+      p_front.position.z + vehicle_info.vehicle_height_m + param.z_axis_filtering_buffer;
+    const auto prev_center_pose = getVehicleCenterFromBase(p_front, vehicle_info);
+    const Point2d prev_center_point(prev_center_pose.position.x, prev_center_pose.position.y);
+    const auto next_center_pose = getVehicleCenterFromBase(p_back, vehicle_info);
+    const Point2d next_center_point(next_center_pose.position.x, next_center_pose.position.y);
+
+    if (param.enable_slow_down) {
+      Polygon2d slow_down_range_polygon;
+      createOneStepPolygon(
+        p_front, p_back, slow_down_range_polygon, vehicle_info, param.slow_down_lateral_margin);
+      const bool found_slow_down_points = within(
+        slow_down_range_polygon, param.slow_down_search_radius, prev_center_point,
+        next_center_point, candidate_pointcloud_ptr, slow_down_pointcloud_ptr, z_axis_min,
+        z_axis_max);
+      if (found_slow_down_points && !result.slow_down_step) {
+        result.slow_down_step = i;
+        result.slow_down_pointcloud = *slow_down_pointcloud_ptr;
+      }
+    } else {
+      slow_down_pointcloud_ptr = candidate_pointcloud_ptr;
+    }
+
+    Polygon2d vehicle_polygon;
+    createOneStepPolygon(p_front, p_back, vehicle_polygon, vehicle_info, param.stop_lateral_margin);
+    const auto collision_pointcloud_ptr = PointCloud::Ptr(new PointCloud);
+    if (within(
+          vehicle_polygon, param.stop_search_radius, prev_center_point, next_center_point,
+          slow_down_pointcloud_ptr, collision_pointcloud_ptr, z_axis_min, z_axis_max)) {
+      result.collision_step = i;
+      result.collision_pointcloud = *collision_pointcloud_ptr;
+      break;
+    }
+  }
+  return result;
+}
+
+// the scan may find the same point at several steps
+std::vector<std::tuple<float, float, float>> toSortedPoints(const PointCloud & pointcloud)
+{
+  std::vector<std::tuple<float, float, float>> points;
+  for (const auto & p : pointcloud) {
+    points.emplace_back(p.x, p.y, p.z);
+  }
+  std::sort(points.begin(), points.end());
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+  return points;
+}
+
+TrajectoryPoints generateTrajectory(const size_t size, const double curvature)
+{
+  TrajectoryPoints trajectory;
+  double x = 0.0;
+  double y = 0.0;
+  double yaw = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    autoware_planning_msgs::msg::TrajectoryPoint p;
+    p.pose.position.x = x;
+    p.pose.position.y = y;
+    p.pose.orientation = autoware::universe_utils::createQuaternionFromYaw(yaw);
+    trajectory.push_back(p);
+    x += std::cos(yaw);
+    y += std::sin(yaw);
+    yaw += curvature;
+  }
+  return trajectory;
+}
+}  // namespace
+
+TEST(swept_corridor_search, same_as_polygon_scan)
+{
+  const auto vehicle_info = autoware::vehicle_info_utils::createVehicleInfo(
+    0.39, 0.42, 2.74, 1.63, 1.0, 1.03, 0.1, 0.1, 2.5, 0.7);
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> x_dist(-5.0, 30.0);
+  std::uniform_real_distribution<double> y_dist(-8.0, 8.0);
+  std::uniform_real_distribution<double> z_dist(-1.0, 4.0);
+
+  for (const double curvature : {0.0, 0.05, -0.1}) {
+    const auto trajectory = generateTrajectory(25, curvature);
+    for (const bool enable_slow_down : {false, true}) {
+      for (const bool enable_z_axis_obstacle_filtering : {false, true}) {
+        SweptCorridorSearchParam param;
+        param.enable_slow_down = enable_slow_down;
+        param.slow_down_lateral_margin = 1.0;
+        param.slow_down_search_radius = std::hypot(vehicle_info.vehicle_width_m / 2.0 + 1.0, 3.0);
+        param.stop_lateral_margin = 0.0;
+        param.stop_search_radius = std::hypot(vehicle_info.vehicle_width_m / 2.0, 3.0);
+        param.enable_z_axis_obstacle_filtering = enable_z_axis_obstacle_filtering;
+        param.z_axis_filtering_buffer = 0.5;
+
+        for (size_t trial = 0; trial < 20; ++trial) {
+          PointCloud pointcloud;
+          for (size_t i = 0; i < 30; ++i) {
+            pointcloud.push_back(pcl::PointXYZ(x_dist(engine), y_dist(engine), z_dist(engine)));
+          }
+
+          const auto result = autoware::motion_planning::searchSweptCorridor(
+            trajectory, pointcloud, vehicle_info, param);
+          const auto expected = scanPolygons(trajectory, pointcloud, vehicle_info, param);
+
+          ASSERT_EQ(result.vehicle_polygons.size(), trajectory.size() - 1);
+          EXPECT_EQ(result.collision_step, expected.collision_step);
+          EXPECT_EQ(
+            toSortedPoints(result.collision_pointcloud),
+            toSortedPoints(expected.collision_pointcloud));
+          EXPECT_EQ(result.slow_down_step, expected.slow_down_step);
+          EXPECT_EQ(
+            toSortedPoints(result.slow_down_pointcloud),
+            toSortedPoints(expected.slow_down_pointcloud));
+        }
+      }
+    }
+  }
+}
+
+TEST(swept_corridor_search, trajectory_without_step)
+{
+  const auto vehicle_info = autoware::vehicle_info_utils::createVehicleInfo(
+    0.39, 0.42, 2.74, 1.63, 1.0, 1.03, 0.1, 0.1, 2.5, 0.7);
+  SweptCorridorSearchParam param{true, 1.0, 5.0, 0.0, 4.0, false, 0.5};
+  PointCloud pointcloud;
+  pointcloud.push_back(pcl::PointXYZ(0.0, 0.0, 0.0));
+
+  // a decimated trajectory trimmed to one point has no step to check
+  for (const size_t size : {0lu, 1lu}) {
+    const auto result = autoware::motion_planning::searchSweptCorridor(
+      generateTrajectory(size, 0.0), pointcloud, vehicle_info, param);
+    EXPECT_TRUE(result.vehicle_polygons.empty());
+    EXPECT_FALSE(result.slow_down_step);
+    EXPECT_FALSE(result.collision_step);
+  }
+}
@@ -17,6 +17,7 @@
 
 #include "autoware/interpolation/linear_interpolation.hpp"
 #include "autoware/interpolation/spline_interpolation_points_2d.hpp"
+#include "autoware/motion_utils/resample/resample.hpp"
 #include "autoware/osqp_interface/osqp_interface.hpp"
 #include "autoware/path_optimizer/common_structs.hpp"
 #include "autoware/path_optimizer/state_equation_generator.hpp"
@@ -35,6 +36,8 @@
 #include <utility>
 #include <vector>
 
+class MPTOptimizerTest;
+
 namespace autoware::path_optimizer
 {
 struct Bounds
@@ -128,15 +131,18 @@ private:
     Eigen::SparseMatrix<double> R;
   };
 
+  // NOTE: The sparsity patterns of the hessian and the linear constraint matrix depend only on the
+  //       problem size, the constraint options and the fixed points, so that the QP solver
+  //       workspace can be updated in place between cycles.
   struct ObjectiveMatrix
   {
-    Eigen::MatrixXd hessian;
+    Eigen::SparseMatrix<double> hessian;
     Eigen::VectorXd gradient;
   };
 
   struct ConstraintMatrix
   {
-    Eigen::MatrixXd linear;
+    Eigen::SparseMatrix<double> linear;
     Eigen::VectorXd lower_bound;
     Eigen::VectorXd upper_bound;
   };
@@ -224,6 +230,7 @@ private:
   TrajectoryParam traj_param_;
   mutable std::shared_ptr<DebugData> debug_data_ptr_;
   mutable std::shared_ptr<autoware::universe_utils::TimeKeeper> time_keeper_;
+  mutable autoware::motion_utils::ResampleWorkspace resample_workspace_;
   rclcpp::Logger logger_;
   MPTParam mpt_param_;
 
@@ -237,9 +244,6 @@ private:
   std::vector<double> vehicle_circle_radiuses_;
 
   // previous data
-  int prev_mat_n_ = 0;
-  int prev_mat_m_ = 0;
-  int prev_solution_status_ = 0;
   std::shared_ptr<std::vector<ReferencePoint>> prev_ref_points_ptr_{nullptr};
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_optimized_traj_points_ptr_{nullptr};
 
@@ -309,6 +313,8 @@ private:
 
   size_t getNumberOfSlackVariables() const;
   std::optional<double> calcNormalizedAvoidanceCost(const ReferencePoint & ref_point) const;
+
+  friend class ::MPTOptimizerTest;
 };
 }  // namespace autoware::path_optimizer
 #endif  // AUTOWARE__PATH_OPTIMIZER__MPT_OPTIMIZER_HPP_
@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__PATH_OPTIMIZER__NODE_HPP_
 #define AUTOWARE__PATH_OPTIMIZER__NODE_HPP_
 
+#include "autoware/motion_utils/resample/resample.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware/path_optimizer/common_structs.hpp"
 #include "autoware/path_optimizer/mpt_optimizer.hpp"
@@ -68,6 +69,7 @@ protected:  // for the static_centerline_generator package
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_{};
   mutable std::shared_ptr<DebugData> debug_data_ptr_{nullptr};
   mutable std::shared_ptr<autoware::universe_utils::TimeKeeper> time_keeper_{nullptr};
+  mutable autoware::motion_utils::ResampleWorkspace resample_workspace_;
 
   // flags for some functions
   bool enable_pub_debug_marker_;
@@ -30,10 +30,11 @@ struct ReferencePoint;
 class StateEquationGenerator
 {
 public:
+  // NOTE: The sparsity pattern of A and B depends only on the number of reference points.
   struct Matrix
   {
-    Eigen::MatrixXd A;
-    Eigen::MatrixXd B;
+    Eigen::SparseMatrix<double> A;
+    Eigen::SparseMatrix<double> B;
     Eigen::VectorXd W;
   };
 
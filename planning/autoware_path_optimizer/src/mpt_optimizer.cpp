@@ -559,7 +559,7 @@ std::vector<ReferencePoint> MPTOptimizer::calcReferencePoints(
   auto ref_points = [&]() {
     const auto resampled_smoothed_points =
       trajectory_utils::resampleTrajectoryPointsWithoutStopPoint(
-        smoothed_points, mpt_param_.delta_arc_length);
+        smoothed_points, mpt_param_.delta_arc_length, resample_workspace_);
     return trajectory_utils::convertToReferencePoints(resampled_smoothed_points);
   }();
   time_keeper_->end_track("resampleReferencePoints");
@@ -664,7 +664,8 @@ void MPTOptimizer::updateFixedPoint(std::vector<ReferencePoint> & ref_points) co
 
     // resample to make ref_points' interval constant.
     // NOTE: Only pose, velocity and curvature will be interpolated.
-    ref_points = trajectory_utils::resampleReferencePoints(ref_points, mpt_param_.delta_arc_length);
+    ref_points = trajectory_utils::resampleReferencePoints(
+      ref_points, mpt_param_.delta_arc_length, resample_workspace_);
 
     // update pose which is previous one, and fixed kinematic state
     // NOTE: There may be a lateral error between the previous and input points.
@@ -679,7 +680,8 @@ void MPTOptimizer::updateFixedPoint(std::vector<ReferencePoint> & ref_points) co
   } else {
     // resample to make ref_points' interval constant.
     // NOTE: Only pose, velocity and curvature will be interpolated.
-    ref_points = trajectory_utils::resampleReferencePoints(ref_points, mpt_param_.delta_arc_length);
+    ref_points = trajectory_utils::resampleReferencePoints(
+      ref_points, mpt_param_.delta_arc_length, resample_workspace_);
 
     ref_points.front().pose = front_point.pose;
     ref_points.front().curvature = front_point.curvature;
@@ -1264,14 +1266,23 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   sparse_T_mat.setFromTriplets(triplet_T_vec.begin(), triplet_T_vec.end());
 
   // NOTE: min J(v) = min (v'Hv + v'g)
-  Eigen::MatrixXd H_x = Eigen::MatrixXd::Zero(N_x, N_x);
-  H_x.triangularView<Eigen::Upper>() =
-    Eigen::MatrixXd(sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat);
-  H_x.triangularView<Eigen::Lower>() = H_x.transpose();
-
-  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(N_v, N_v);
-  H.block(0, 0, N_x, N_x) = H_x;
-  H.block(N_x, N_x, N_u, N_u) = val_mat.R;
+  // NOTE: The sparse product keeps the structural zeros of the operands.
+  const Eigen::SparseMatrix<double> H_x = sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat;
+
+  std::vector<Eigen::Triplet<double>> H_triplet_vec;
+  H_triplet_vec.reserve(H_x.nonZeros() + val_mat.R.nonZeros());
+  for (int k = 0; k < H_x.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(H_x, k); it; ++it) {
+      H_triplet_vec.push_back(Eigen::Triplet<double>(it.row(), it.col(), it.value()));
+    }
+  }
+  for (int k = 0; k < val_mat.R.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(val_mat.R, k); it; ++it) {
+      H_triplet_vec.push_back(Eigen::Triplet<double>(N_x + it.row(), N_x + it.col(), it.value()));
+    }
+  }
+  Eigen::SparseMatrix<double> H(N_v, N_v);
+  H.setFromTriplets(H_triplet_vec.begin(), H_triplet_vec.end());
 
   Eigen::VectorXd g = Eigen::VectorXd::Zero(N_v);
   g.segment(0, N_x) = T_vec.transpose() * val_mat.Q * sparse_T_mat;
@@ -1332,15 +1343,25 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows += N_u;
   }
 
-  // NOTE: The following takes 1 [ms]
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(A_rows, N_v);
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
   Eigen::VectorXd lb = Eigen::VectorXd::Constant(A_rows, -autoware::osqp_interface::INF);
   Eigen::VectorXd ub = Eigen::VectorXd::Constant(A_rows, autoware::osqp_interface::INF);
   size_t A_rows_end = 0;
 
   // 1. State equation
-  A.block(0, 0, N_x, N_x) = Eigen::MatrixXd::Identity(N_x, N_x) - mpt_mat.A;
-  A.block(0, N_x, N_x, N_u) = -mpt_mat.B;
+  for (size_t i = 0; i < N_x; ++i) {
+    A_triplet_vec.push_back(Eigen::Triplet<double>(i, i, 1.0));
+  }
+  for (int k = 0; k < mpt_mat.A.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mpt_mat.A, k); it; ++it) {
+      A_triplet_vec.push_back(Eigen::Triplet<double>(it.row(), it.col(), -it.value()));
+    }
+  }
+  for (int k = 0; k < mpt_mat.B.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mpt_mat.B, k); it; ++it) {
+      A_triplet_vec.push_back(Eigen::Triplet<double>(it.row(), N_x + it.col(), -it.value()));
+    }
+  }
   lb.segment(0, N_x) = mpt_mat.W;
   ub.segment(0, N_x) = mpt_mat.W;
   A_rows_end += N_x;
@@ -1349,7 +1370,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // CX = C(Bv + w) + C \in R^{N_ref, N_ref * D_x}
   for (size_t l_idx = 0; l_idx < N_collision_check; ++l_idx) {
     // create C := [cos(beta) | l cos(beta)]
-    Eigen::SparseMatrix<double> C_sparse_mat(N_ref, N_x);
     std::vector<Eigen::Triplet<double>> C_triplet_vec;
     Eigen::VectorXd C_vec = Eigen::VectorXd::Zero(N_ref);
 
@@ -1362,7 +1382,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       C_triplet_vec.push_back(Eigen::Triplet<double>(i, i * D_x + 1, lon_offset * std::cos(beta)));
       C_vec(i) = lon_offset * std::sin(beta);
     }
-    C_sparse_mat.setFromTriplets(C_triplet_vec.begin(), C_triplet_vec.end());
 
     // calculate bounds
     const double bounds_offset =
@@ -1376,16 +1395,19 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       // A := [C | O | ... | O | I | O | ...
       //      -C | O | ... | O | I | O | ...
       //          O    | O | ... | O | I | O | ... ]
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_x) = C_sparse_mat;
-      A_blk.block(N_ref, 0, N_ref, N_x) = -C_sparse_mat;
+      for (const auto & c : C_triplet_vec) {
+        A_triplet_vec.push_back(Eigen::Triplet<double>(A_rows_end + c.row(), c.col(), c.value()));
+        A_triplet_vec.push_back(
+          Eigen::Triplet<double>(A_rows_end + N_ref + c.row(), c.col(), -c.value()));
+      }
 
       const size_t local_A_offset_cols = N_x + N_u + (!mpt_param_.l_inf_norm ? N_ref * l_idx : 0);
-      A_blk.block(0, local_A_offset_cols, N_ref, N_ref) = Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(2 * N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
+      for (size_t i = 0; i < N_ref; ++i) {
+        for (size_t blk_idx = 0; blk_idx < 3; ++blk_idx) {
+          A_triplet_vec.push_back(
+            Eigen::Triplet<double>(A_rows_end + blk_idx * N_ref + i, local_A_offset_cols + i, 1.0));
+        }
+      }
 
       // lb := [lower_bound - C
       //        C - upper_bound
@@ -1394,7 +1416,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       lb_blk.segment(0, N_ref) = -C_vec + part_lb;
       lb_blk.segment(N_ref, N_ref) = C_vec - part_ub;
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = lb_blk;
 
       A_rows_end += A_blk_rows;
@@ -1404,10 +1425,10 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     if (mpt_param_.hard_constraint) {
       const size_t A_blk_rows = N_ref;
 
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_ref) = C_sparse_mat;
+      for (const auto & c : C_triplet_vec) {
+        A_triplet_vec.push_back(Eigen::Triplet<double>(A_rows_end + c.row(), c.col(), c.value()));
+      }
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = part_lb - C_vec;
       ub.segment(A_rows_end, A_blk_rows) = part_ub - C_vec;
 
@@ -1418,7 +1439,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // 3. fixed points constraint
   // X = B v + w where point is fixed
   for (const size_t i : fixed_points_indices) {
-    A.block(A_rows_end, D_x * i, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    for (size_t d = 0; d < D_x; ++d) {
+      A_triplet_vec.push_back(Eigen::Triplet<double>(A_rows_end + d, D_x * i + d, 1.0));
+    }
 
     lb.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
     ub.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
@@ -1428,7 +1451,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
 
   // 4. steer angle limit
   if (mpt_param_.steer_limit_constraint) {
-    A.block(A_rows_end, N_x, N_u, N_u) = Eigen::MatrixXd::Identity(N_u, N_u);
+    for (size_t i = 0; i < N_u; ++i) {
+      A_triplet_vec.push_back(Eigen::Triplet<double>(A_rows_end + i, N_x + i, 1.0));
+    }
 
     // TODO(murooka) use curvature by stabling optimization
     // Currently, when using curvature, the optimization result is weird with sample_map.
@@ -1446,6 +1471,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows_end += N_u;
   }
 
+  Eigen::SparseMatrix<double> A(A_rows, N_v);
+  A.setFromTriplets(A_triplet_vec.begin(), A_triplet_vec.end());
+
   return ConstraintMatrix{A, lb, ub};
 }
 
@@ -1497,8 +1525,8 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
     updateMatrixForManualWarmStart(obj_mat, const_mat, u0);
 
   // calculate matrices for qp
-  const Eigen::MatrixXd & H = updated_obj_mat.hessian;
-  const Eigen::MatrixXd & A = updated_const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = updated_obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = updated_const_mat.linear;
   const auto f = toStdVector(updated_obj_mat.gradient);
   const auto upper_bound = toStdVector(updated_const_mat.upper_bound);
   const auto lower_bound = toStdVector(updated_const_mat.lower_bound);
@@ -1509,38 +1537,36 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   const autoware::osqp_interface::CSC_Matrix P_csc =
     autoware::osqp_interface::calCSCMatrixTrapezoidal(H);
   const autoware::osqp_interface::CSC_Matrix A_csc = autoware::osqp_interface::calCSCMatrix(A);
-  if (
-    prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
-    prev_mat_m_ == A.rows()) {
-    RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
-    osqp_solver_ptr_->updateCscP(P_csc);
-    osqp_solver_ptr_->updateQ(f);
-    osqp_solver_ptr_->updateCscA(A_csc);
-    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
-  } else {
-    RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "no warm start");
-    osqp_solver_ptr_ = std::make_unique<autoware::osqp_interface::OSQPInterface>(
-      P_csc, A_csc, f, lower_bound, upper_bound, osqp_epsilon_);
-  }
-  prev_mat_n_ = H.rows();
-  prev_mat_m_ = A.rows();
+  // NOTE: The workspace is updated in place only when the previous problem was solved and has the
+  //       same sparsity pattern. Otherwise, the problem is set up again.
+  const bool is_warm_start = [&]() {
+    if (!mpt_param_.enable_warm_start) {
+      osqp_solver_ptr_ = std::make_unique<autoware::osqp_interface::OSQPInterface>(
+        P_csc, A_csc, f, lower_bound, upper_bound, osqp_epsilon_);
+      return false;
+    }
+    return osqp_solver_ptr_->initializeOrUpdateProblem(P_csc, A_csc, f, lower_bound, upper_bound);
+  }();
+  RCLCPP_INFO_EXPRESSION(
+    logger_, enable_debug_info_, "%s", is_warm_start ? "warm start" : "no warm start");
+  time_keeper_->comment(is_warm_start ? "warm start" : "no warm start");
   time_keeper_->end_track("initOsqp");
 
   // solve qp
   time_keeper_->start_track("solveOsqp");
   const auto result = osqp_solver_ptr_->optimize();
+  const int iteration_status = std::get<4>(result);
+  time_keeper_->comment("iteration: " + std::to_string(iteration_status));
   time_keeper_->end_track("solveOsqp");
 
   // check solution status
   const int solution_status = std::get<3>(result);
-  prev_solution_status_ = solution_status;
   if (solution_status != 1) {
     osqp_solver_ptr_->logUnsolvedStatus("[MPT]");
     return std::nullopt;
   }
 
   // print iteration
-  const int iteration_status = std::get<4>(result);
   RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "iteration: %d", iteration_status);
 
   // get optimization result
@@ -1613,8 +1639,8 @@ MPTOptimizer::updateMatrixForManualWarmStart(
     return {obj_mat, const_mat};
   }
 
-  const Eigen::MatrixXd & H = obj_mat.hessian;
-  const Eigen::MatrixXd & A = const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = const_mat.linear;
 
   auto updated_obj_mat = obj_mat;
   auto updated_const_mat = const_mat;
@@ -603,7 +603,7 @@ std::vector<TrajectoryPoint> PathOptimizer::extendTrajectory(
     joint_traj_max_length_for_smoothing, joint_traj_min_length_for_smoothing);
   if (!joint_end_traj_point_idx) {
     return trajectory_utils::resampleTrajectoryPoints(
-      optimized_traj_points, traj_param_.output_delta_arc_length);
+      optimized_traj_points, traj_param_.output_delta_arc_length, resample_workspace_);
   }
 
   // calculate full trajectory points
@@ -624,7 +624,7 @@ std::vector<TrajectoryPoint> PathOptimizer::extendTrajectory(
 
   // resample trajectory points
   auto resampled_traj_points = trajectory_utils::resampleTrajectoryPoints(
-    full_traj_points, traj_param_.output_delta_arc_length);
+    full_traj_points, traj_param_.output_delta_arc_length, resample_workspace_);
 
   // update stop velocity on joint
   for (size_t i = joint_start_traj_seg_idx + 1; i <= *joint_end_traj_point_idx; ++i) {
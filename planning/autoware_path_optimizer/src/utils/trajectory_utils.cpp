@@ -113,35 +113,40 @@ geometry_msgs::msg::Point getNearestPosition(
 }
 
 std::vector<TrajectoryPoint> resampleTrajectoryPoints(
-  const std::vector<TrajectoryPoint> & traj_points, const double interval)
+  const std::vector<TrajectoryPoint> & traj_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace)
 {
   constexpr bool enable_resampling_stop_point = true;
 
   const auto traj = autoware::motion_utils::convertToTrajectory(traj_points);
-  const auto resampled_traj = autoware::motion_utils::resampleTrajectory(
-    traj, interval, false, true, true, enable_resampling_stop_point);
+  Trajectory resampled_traj;
+  autoware::motion_utils::resampleTrajectory(
+    traj, interval, workspace, resampled_traj, false, true, true, enable_resampling_stop_point);
   return autoware::motion_utils::convertToTrajectoryPointArray(resampled_traj);
 }
 
 // NOTE: stop point will not be resampled
 std::vector<TrajectoryPoint> resampleTrajectoryPointsWithoutStopPoint(
-  const std::vector<TrajectoryPoint> & traj_points, const double interval)
+  const std::vector<TrajectoryPoint> & traj_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace)
 {
   constexpr bool enable_resampling_stop_point = false;
 
   const auto traj = autoware::motion_utils::convertToTrajectory(traj_points);
-  const auto resampled_traj = autoware::motion_utils::resampleTrajectory(
-    traj, interval, false, true, true, enable_resampling_stop_point);
+  Trajectory resampled_traj;
+  autoware::motion_utils::resampleTrajectory(
+    traj, interval, workspace, resampled_traj, false, true, true, enable_resampling_stop_point);
   return autoware::motion_utils::convertToTrajectoryPointArray(resampled_traj);
 }
 
 std::vector<ReferencePoint> resampleReferencePoints(
-  const std::vector<ReferencePoint> & ref_points, const double interval)
+  const std::vector<ReferencePoint> & ref_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace)
 {
   // resample pose and velocity
   const auto traj_points = convertToTrajectoryPoints(ref_points);
   const auto resampled_traj_points =
-    resampleTrajectoryPointsWithoutStopPoint(traj_points, interval);
+    resampleTrajectoryPointsWithoutStopPoint(traj_points, interval, workspace);
   const auto resampled_ref_points = convertToReferencePoints(resampled_traj_points);
 
   // resample curvature
@@ -0,0 +1,309 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/path_optimizer/mpt_optimizer.hpp"
+#include "autoware/path_optimizer/vehicle_model/vehicle_model_bicycle_kinematics.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/osqp_interface/csc_matrix_conv.hpp>
+#include <autoware/osqp_interface/osqp_interface.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using autoware::path_optimizer::DebugData;
+using autoware::path_optimizer::EgoNearestParam;
+using autoware::path_optimizer::MPTOptimizer;
+using autoware::path_optimizer::ReferencePoint;
+using autoware::path_optimizer::TrajectoryParam;
+using autoware::path_optimizer::TrajectoryPoint;
+
+namespace
+{
+void expectNear(const Eigen::MatrixXd & actual, const Eigen::MatrixXd & expected)
+{
+  ASSERT_EQ(actual.rows(), expected.rows());
+  ASSERT_EQ(actual.cols(), expected.cols());
+  if (expected.size() != 0) {
+    EXPECT_LT((actual - expected).cwiseAbs().maxCoeff(), 1e-9);
+  }
+}
+
+std::vector<ReferencePoint> createReferencePoints(
+  const size_t num_points, const size_t num_collision_check)
+{
+  std::vector<ReferencePoint> ref_points(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    auto & p = ref_points.at(i);
+    p.pose.position.x = static_cast<double>(i);
+    p.pose.orientation.w = 1.0;
+    p.longitudinal_velocity_mps = 5.0;
+    p.curvature = 0.01 * std::sin(0.5 * i);
+    p.delta_arc_length = 1.0;
+    p.alpha = 0.05 * std::sin(0.3 * i);
+    p.normalized_avoidance_cost = (i % 4 == 0) ? 0.5 : 0.0;
+    for (size_t l = 0; l < num_collision_check; ++l) {
+      p.beta.push_back(0.02 * std::cos(static_cast<double>(i + l)));
+      p.bounds_on_constraints.push_back({-1.5 - 0.1 * l, 1.5 + 0.05 * i});
+    }
+  }
+  ref_points.front().fixed_kinematic_state = autoware::path_optimizer::KinematicState{0.1, 0.02};
+  return ref_points;
+}
+}  // namespace
+
+class MPTOptimizerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+
+    const auto autoware_test_utils_dir =
+      ament_index_cpp::get_package_share_directory("autoware_test_utils");
+    const auto path_optimizer_dir =
+      ament_index_cpp::get_package_share_directory("autoware_path_optimizer");
+    auto node_options = rclcpp::NodeOptions{};
+    node_options.arguments(
+      {"--ros-args", "--params-file",
+       autoware_test_utils_dir + "/config/test_vehicle_info.param.yaml", "--params-file",
+       autoware_test_utils_dir + "/config/test_common.param.yaml", "--params-file",
+       autoware_test_utils_dir + "/config/test_nearest_search.param.yaml", "--params-file",
+       path_optimizer_dir + "/config/path_optimizer.param.yaml"});
+    node_ = std::make_shared<rclcpp::Node>("test_mpt_optimizer", node_options);
+
+    const auto vehicle_info =
+      autoware::vehicle_info_utils::VehicleInfoUtils(*node_).getVehicleInfo();
+    mpt_optimizer_ = std::make_shared<MPTOptimizer>(
+      node_.get(), false, EgoNearestParam(node_.get()), vehicle_info, TrajectoryParam(node_.get()),
+      std::make_shared<DebugData>(), std::make_shared<autoware::universe_utils::TimeKeeper>());
+  }
+
+  void TearDown() override
+  {
+    mpt_optimizer_ = nullptr;
+    node_ = nullptr;
+    rclcpp::shutdown();
+  }
+
+  void setConstraintOptions(
+    const bool soft_constraint, const bool hard_constraint, const bool l_inf_norm,
+    const bool steer_limit_constraint)
+  {
+    auto & p = mpt_optimizer_->mpt_param_;
+    p.soft_constraint = soft_constraint;
+    p.hard_constraint = hard_constraint;
+    p.l_inf_norm = l_inf_norm;
+    p.steer_limit_constraint = steer_limit_constraint;
+  }
+
+  // compare the sparse problem with the one assembled with dense matrices as done before
+  void expectSameAsDenseProblem() const
+  {
+    const auto & mpt = *mpt_optimizer_;
+    const auto & p = mpt.mpt_param_;
+    const auto & vehicle_info = mpt.vehicle_info_;
+    const auto & lon_offsets = mpt.vehicle_circle_longitudinal_offsets_;
+    const auto & radiuses = mpt.vehicle_circle_radiuses_;
+
+    const size_t N_ref = 12;
+    const size_t N_collision_check = lon_offsets.size();
+    const auto ref_points = createReferencePoints(N_ref, N_collision_check);
+    std::vector<TrajectoryPoint> traj_points(1);
+    traj_points.front().pose.position.x = 100.0;
+
+    const size_t D_x = mpt.state_equation_generator_.getDimX();
+    const size_t D_u = mpt.state_equation_generator_.getDimU();
+    const size_t N_x = N_ref * D_x;
+    const size_t N_u = (N_ref - 1) * D_u;
+    const size_t N_s = N_ref * mpt.getNumberOfSlackVariables();
+    const size_t N_v = N_x + N_u + N_s;
+
+    const auto mpt_mat = mpt.state_equation_generator_.calcMatrix(ref_points);
+    const auto val_mat = mpt.calcValueMatrix(ref_points, traj_points);
+    const auto obj_mat = mpt.calcObjectiveMatrix(mpt_mat, val_mat, ref_points);
+    const auto const_mat = mpt.calcConstraintMatrix(mpt_mat, ref_points);
+
+    // 1. state equation
+    KinematicsBicycleModel vehicle_model(vehicle_info.wheel_base_m, p.max_steer_rad);
+    Eigen::MatrixXd A_state = Eigen::MatrixXd::Zero(N_x, N_x);
+    Eigen::MatrixXd B_state = Eigen::MatrixXd::Zero(N_x, N_u);
+    Eigen::VectorXd W_state = Eigen::VectorXd::Zero(N_x);
+    Eigen::MatrixXd Ad(D_x, D_x);
+    Eigen::MatrixXd Bd(D_x, D_u);
+    Eigen::MatrixXd Wd(D_x, 1);
+    A_state.block(0, 0, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    for (size_t i = 1; i < N_ref; ++i) {
+      vehicle_model.calculateStateEquationMatrix(
+        Ad, Bd, Wd, 0.0, ref_points.at(i - 1).delta_arc_length);
+      A_state.block(i * D_x, (i - 1) * D_x, D_x, D_x) = Ad;
+      B_state.block(i * D_x, (i - 1) * D_u, D_x, D_u) = Bd;
+      W_state.segment(i * D_x, D_x) = Wd;
+    }
+    expectNear(Eigen::MatrixXd(mpt_mat.A), A_state);
+    expectNear(Eigen::MatrixXd(mpt_mat.B), B_state);
+    expectNear(mpt_mat.W, W_state);
+
+    // 2. objective
+    Eigen::MatrixXd T_mat = Eigen::MatrixXd::Zero(N_x, N_x);
+    Eigen::VectorXd T_vec = Eigen::VectorXd::Zero(N_x);
+    for (size_t i = 0; i < N_ref; ++i) {
+      const double alpha = ref_points.at(i).alpha;
+      T_mat(i * D_x, i * D_x) = std::cos(alpha);
+      T_mat(i * D_x, i * D_x + 1) = p.optimization_center_offset * std::cos(alpha);
+      T_mat(i * D_x + 1, i * D_x + 1) = 1.0;
+      T_vec(i * D_x) = -p.optimization_center_offset * std::sin(alpha);
+    }
+    const Eigen::MatrixXd Q = val_mat.Q;
+    const Eigen::MatrixXd R = val_mat.R;
+    Eigen::MatrixXd H_x = Eigen::MatrixXd::Zero(N_x, N_x);
+    H_x.triangularView<Eigen::Upper>() = Eigen::MatrixXd(T_mat.transpose() * Q * T_mat);
+    H_x.triangularView<Eigen::Lower>() = H_x.transpose();
+    Eigen::MatrixXd H = Eigen::MatrixXd::Zero(N_v, N_v);
+    H.block(0, 0, N_x, N_x) = H_x;
+    H.block(N_x, N_x, N_u, N_u) = R;
+    Eigen::VectorXd g = Eigen::VectorXd::Zero(N_v);
+    g.segment(0, N_x) = T_vec.transpose() * Q * T_mat;
+    g.segment(N_x + N_u, N_s) = p.soft_collision_free_weight * Eigen::VectorXd::Ones(N_s);
+    expectNear(Eigen::MatrixXd(obj_mat.hessian), H);
+    expectNear(obj_mat.gradient, g);
+
+    // 3. constraints
+    size_t A_rows = N_x;
+    A_rows += p.soft_constraint ? 3 * N_ref * N_collision_check : 0;
+    A_rows += p.hard_constraint ? N_ref * N_collision_check : 0;
+    A_rows += D_x;  // the first point is fixed
+    A_rows += p.steer_limit_constraint ? N_u : 0;
+    Eigen::MatrixXd A = Eigen::MatrixXd::Zero(A_rows, N_v);
+    Eigen::VectorXd lb = Eigen::VectorXd::Constant(A_rows, -autoware::osqp_interface::INF);
+    Eigen::VectorXd ub = Eigen::VectorXd::Constant(A_rows, autoware::osqp_interface::INF);
+    size_t A_rows_end = 0;
+
+    A.block(0, 0, N_x, N_x) = Eigen::MatrixXd::Identity(N_x, N_x) - A_state;
+    A.block(0, N_x, N_x, N_u) = -B_state;
+    lb.segment(0, N_x) = W_state;
+    ub.segment(0, N_x) = W_state;
+    A_rows_end += N_x;
+
+    for (size_t l_idx = 0; l_idx < N_collision_check; ++l_idx) {
+      Eigen::MatrixXd C_mat = Eigen::MatrixXd::Zero(N_ref, N_x);
+      Eigen::VectorXd C_vec = Eigen::VectorXd::Zero(N_ref);
+      Eigen::VectorXd part_lb(N_ref);
+      Eigen::VectorXd part_ub(N_ref);
+      const double bounds_offset = vehicle_info.vehicle_width_m / 2.0 - radiuses.at(l_idx);
+      for (size_t i = 0; i < N_ref; ++i) {
+        const double beta = *ref_points.at(i).beta.at(l_idx);
+        C_mat(i, i * D_x) = std::cos(beta);
+        C_mat(i, i * D_x + 1) = lon_offsets.at(l_idx) * std::cos(beta);
+        C_vec(i) = lon_offsets.at(l_idx) * std::sin(beta);
+        part_lb(i) = ref_points.at(i).bounds_on_constraints.at(l_idx).lower_bound - bounds_offset;
+        part_ub(i) = ref_points.at(i).bounds_on_constraints.at(l_idx).upper_bound + bounds_offset;
+      }
+
+      if (p.soft_constraint) {
+        const size_t local_A_offset_cols = N_x + N_u + (!p.l_inf_norm ? N_ref * l_idx : 0);
+        A.block(A_rows_end, 0, N_ref, N_x) = C_mat;
+        A.block(A_rows_end + N_ref, 0, N_ref, N_x) = -C_mat;
+        for (size_t blk_idx = 0; blk_idx < 3; ++blk_idx) {
+          A.block(A_rows_end + blk_idx * N_ref, local_A_offset_cols, N_ref, N_ref) =
+            Eigen::MatrixXd::Identity(N_ref, N_ref);
+        }
+        lb.segment(A_rows_end, 3 * N_ref) = Eigen::VectorXd::Zero(3 * N_ref);
+        lb.segment(A_rows_end, N_ref) = -C_vec + part_lb;
+        lb.segment(A_rows_end + N_ref, N_ref) = C_vec - part_ub;
+        A_rows_end += 3 * N_ref;
+      }
+
+      // NOTE: C is placed over the state columns, as the soft constraints do.
+      if (p.hard_constraint) {
+        A.block(A_rows_end, 0, N_ref, N_x) = C_mat;
+        lb.segment(A_rows_end, N_ref) = part_lb - C_vec;
+        ub.segment(A_rows_end, N_ref) = part_ub - C_vec;
+        A_rows_end += N_ref;
+      }
+    }
+
+    A.block(A_rows_end, 0, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    lb.segment(A_rows_end, D_x) = ref_points.front().fixed_kinematic_state->toEigenVector();
+    ub.segment(A_rows_end, D_x) = ref_points.front().fixed_kinematic_state->toEigenVector();
+    A_rows_end += D_x;
+
+    if (p.steer_limit_constraint) {
+      A.block(A_rows_end, N_x, N_u, N_u) = Eigen::MatrixXd::Identity(N_u, N_u);
+      for (size_t i = 0; i < N_u; ++i) {
+        const double ref_steer_angle =
+          std::atan2(vehicle_info.wheel_base_m * ref_points.at(i).curvature, 1.0);
+        lb(A_rows_end + i) = ref_steer_angle - p.max_steer_rad;
+        ub(A_rows_end + i) = ref_steer_angle + p.max_steer_rad;
+      }
+    }
+
+    expectNear(Eigen::MatrixXd(const_mat.linear), A);
+    expectNear(const_mat.lower_bound, lb);
+    expectNear(const_mat.upper_bound, ub);
+
+    // 4. the sparse and the dense problems have the same solution
+    const auto to_std_vector = [](const Eigen::VectorXd & vec) {
+      return std::vector<double>(vec.data(), vec.data() + vec.size());
+    };
+    constexpr double eps = 1e-6;
+    autoware::osqp_interface::OSQPInterface sparse_solver(
+      autoware::osqp_interface::calCSCMatrixTrapezoidal(obj_mat.hessian),
+      autoware::osqp_interface::calCSCMatrix(const_mat.linear), to_std_vector(obj_mat.gradient),
+      to_std_vector(const_mat.lower_bound), to_std_vector(const_mat.upper_bound), eps);
+    autoware::osqp_interface::OSQPInterface dense_solver(
+      autoware::osqp_interface::calCSCMatrixTrapezoidal(H),
+      autoware::osqp_interface::calCSCMatrix(A), to_std_vector(g), to_std_vector(lb),
+      to_std_vector(ub), eps);
+    const auto sparse_result = sparse_solver.optimize();
+    const auto dense_result = dense_solver.optimize();
+    ASSERT_EQ(std::get<3>(sparse_result), 1);
+    ASSERT_EQ(std::get<3>(dense_result), 1);
+    const auto & sparse_solution = std::get<0>(sparse_result);
+    const auto & dense_solution = std::get<0>(dense_result);
+    ASSERT_EQ(sparse_solution.size(), dense_solution.size());
+    for (size_t i = 0; i < sparse_solution.size(); ++i) {
+      EXPECT_NEAR(sparse_solution.at(i), dense_solution.at(i), 1e-4);
+    }
+  }
+
+  std::shared_ptr<rclcpp::Node> node_;
+  std::shared_ptr<MPTOptimizer> mpt_optimizer_;
+};
+
+TEST_F(MPTOptimizerTest, SparseProblemWithSoftConstraint)
+{
+  setConstraintOptions(true, false, true, false);
+  expectSameAsDenseProblem();
+
+  setConstraintOptions(true, false, false, false);
+  expectSameAsDenseProblem();
+}
+
+TEST_F(MPTOptimizerTest, SparseProblemWithHardConstraint)
+{
+  setConstraintOptions(false, true, false, false);
+  expectSameAsDenseProblem();
+}
+
+TEST_F(MPTOptimizerTest, SparseProblemWithSteerLimitConstraint)
+{
+  setConstraintOptions(true, false, true, true);
+  expectSameAsDenseProblem();
+}
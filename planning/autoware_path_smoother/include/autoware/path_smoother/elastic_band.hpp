@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__PATH_SMOOTHER__ELASTIC_BAND_HPP_
 #define AUTOWARE__PATH_SMOOTHER__ELASTIC_BAND_HPP_
 
+#include "autoware/motion_utils/resample/resample.hpp"
 #include "autoware/osqp_interface/osqp_interface.hpp"
 #include "autoware/path_smoother/common_structs.hpp"
 #include "autoware/path_smoother/type_alias.hpp"
@@ -111,6 +112,7 @@ private:
 
   std::unique_ptr<autoware::osqp_interface::OSQPInterface> osqp_solver_ptr_;
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_eb_traj_points_ptr_{nullptr};
+  autoware::motion_utils::ResampleWorkspace resample_workspace_;
 
   std::vector<TrajectoryPoint> insertFixedPoint(
     const std::vector<TrajectoryPoint> & traj_point) const;
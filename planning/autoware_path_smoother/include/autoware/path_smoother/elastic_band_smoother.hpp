@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__PATH_SMOOTHER__ELASTIC_BAND_SMOOTHER_HPP_
 #define AUTOWARE__PATH_SMOOTHER__ELASTIC_BAND_SMOOTHER_HPP_
 
+#include "autoware/motion_utils/resample/resample.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware/path_smoother/common_structs.hpp"
 #include "autoware/path_smoother/elastic_band.hpp"
@@ -61,6 +62,7 @@ private:
 
   // argument variables
   mutable std::shared_ptr<TimeKeeper> time_keeper_ptr_{nullptr};
+  mutable autoware::motion_utils::ResampleWorkspace resample_workspace_;
 
   // flags for some functions
   bool enable_debug_info_;
@@ -18,6 +18,7 @@
 #include "autoware/interpolation/linear_interpolation.hpp"
 #include "autoware/interpolation/spline_interpolation.hpp"
 #include "autoware/interpolation/spline_interpolation_points_2d.hpp"
+#include "autoware/motion_utils/resample/resample.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware/path_smoother/common_structs.hpp"
 #include "autoware/path_smoother/type_alias.hpp"
@@ -116,10 +117,12 @@ size_t findEgoSegmentIndex(
 Path create_path(Path path_msg, const std::vector<TrajectoryPoint> & traj_points);
 
 std::vector<TrajectoryPoint> resampleTrajectoryPoints(
-  const std::vector<TrajectoryPoint> & traj_points, const double interval);
+  const std::vector<TrajectoryPoint> & traj_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace);
 
 std::vector<TrajectoryPoint> resampleTrajectoryPointsWithoutStopPoint(
-  const std::vector<TrajectoryPoint> & traj_points, const double interval);
+  const std::vector<TrajectoryPoint> & traj_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace);
 
 template <typename T>
 std::optional<size_t> updateFrontPointForFix(
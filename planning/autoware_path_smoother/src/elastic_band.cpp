@@ -231,7 +231,7 @@ std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
     // NOTE: If the interval of points is not constant, the optimization is sometimes unstable.
     //       Therefore, we do not resample a stop point here.
     auto tmp_traj_points = trajectory_utils::resampleTrajectoryPointsWithoutStopPoint(
-      traj_points_with_fixed_point, eb_param_.delta_arc_length);
+      traj_points_with_fixed_point, eb_param_.delta_arc_length, resample_workspace_);
 
     // NOTE: The front point is previous optimized one, and the others are the input ones.
     //       There may be a lateral error between the points, which makes orientation unexpected.
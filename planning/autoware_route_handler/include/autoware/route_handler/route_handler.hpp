@@ -25,6 +25,7 @@
 #include <unique_identifier_msgs/msg/uuid.hpp>
 
 #include <lanelet2_core/Forward.h>
+#include <lanelet2_core/primitives/BoundingBox.h>
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_routing/Forward.h>
 #include <lanelet2_routing/RoutingCost.h>
@@ -33,6 +34,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 namespace autoware::route_handler
@@ -330,6 +332,28 @@ public:
     const lanelet::ConstLanelets & lanelet_sequence, const double s) const;
 
 private:
+  /**
+   * @brief Precomputed relations of a lanelet on the route, or of a lateral neighbor of it.
+   */
+  struct RouteLaneletEntry
+  {
+    lanelet::ConstLanelet lanelet;
+    bool is_route{false};
+    bool is_start{false};
+    bool is_goal{false};
+    double length{0.0};  // centerline length
+    // following and preceding lanelets within the route
+    lanelet::ConstLanelets next_lanelets;
+    lanelet::ConstLanelets prev_lanelets;
+    // routable or adjacent (i.e. non-routable) lanelets
+    std::optional<lanelet::ConstLanelet> left_lanelet;
+    std::optional<lanelet::ConstLanelet> right_lanelet;
+    std::optional<lanelet::ConstLanelet> left_shoulder_lanelet;
+    std::optional<lanelet::ConstLanelet> right_shoulder_lanelet;
+    lanelet::Lanelets left_opposite_lanelets;
+    lanelet::Lanelets right_opposite_lanelets;
+  };
+
   // MUST
   lanelet::routing::RoutingGraphPtr routing_graph_ptr_;
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr_;
@@ -341,6 +365,12 @@ private:
   lanelet::ConstLanelets goal_lanelets_;
   std::shared_ptr<LaneletRoute> route_ptr_{nullptr};
 
+  // table of the route lanelets and their lateral neighbors, rebuilt whenever the route changes
+  std::vector<RouteLaneletEntry> route_lanelet_table_;
+  std::unordered_map<lanelet::Id, size_t> route_lanelet_table_index_;
+  // bounding boxes of route_lanelets_ in the same order
+  std::vector<lanelet::BoundingBox2d> route_lanelet_boxes_;
+
   rclcpp::Logger logger_{rclcpp::get_logger("route_handler")};
 
   bool is_map_msg_ready_{false};
@@ -352,6 +382,15 @@ private:
 
   // non-const methods
   void setLaneletsFromRouteMsg();
+  void buildRouteLaneletTable();
+
+  /**
+   * @brief find the table entry of the lanelet
+   * @return pointer to the entry, or nullptr if the lanelet is neither on the route nor a lateral
+   * neighbor of it
+   */
+  const RouteLaneletEntry * findRouteLaneletEntry(const lanelet::ConstLanelet & lanelet) const;
+  double getLaneletLength(const lanelet::ConstLanelet & lanelet) const;
 
   // const methods
   // for routing
@@ -35,6 +35,7 @@
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -43,6 +44,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace autoware::route_handler
@@ -79,6 +81,42 @@ bool exists(const std::vector<T> & vectors, const T & item)
   return false;
 }
 
+lanelet::Lanelets findLeftOppositeLanelets(
+  lanelet::LaneletMap & lanelet_map, const lanelet::ConstLanelet & lanelet)
+{
+  const auto opposite_candidate_lanelets =
+    lanelet_map.laneletLayer.findUsages(lanelet.leftBound().invert());
+
+  lanelet::Lanelets opposite_lanelets;
+  for (const auto & candidate_lanelet : opposite_candidate_lanelets) {
+    if (candidate_lanelet.rightBound().id() == lanelet.leftBound().id()) {
+      continue;
+    }
+
+    opposite_lanelets.push_back(candidate_lanelet);
+  }
+
+  return opposite_lanelets;
+}
+
+lanelet::Lanelets findRightOppositeLanelets(
+  lanelet::LaneletMap & lanelet_map, const lanelet::ConstLanelet & lanelet)
+{
+  const auto opposite_candidate_lanelets =
+    lanelet_map.laneletLayer.findUsages(lanelet.rightBound().invert());
+
+  lanelet::Lanelets opposite_lanelets;
+  for (const auto & candidate_lanelet : opposite_candidate_lanelets) {
+    if (candidate_lanelet.leftBound().id() == lanelet.rightBound().id()) {
+      continue;
+    }
+
+    opposite_lanelets.push_back(candidate_lanelet);
+  }
+
+  return opposite_lanelets;
+}
+
 lanelet::ConstPoint3d get3DPointFrom2DArcLength(
   const lanelet::ConstLanelets & lanelet_sequence, const double s)
 {
@@ -355,6 +393,7 @@ void RouteHandler::setRouteLanelets(const lanelet::ConstLanelets & path_lanelets
   for (const auto & id : route_lanelets_id) {
     route_lanelets_.push_back(lanelet_map_ptr_->laneletLayer.get(id));
   }
+  buildRouteLaneletTable();
   is_handler_ready_ = true;
 }
 
@@ -365,6 +404,7 @@ void RouteHandler::clearRoute()
   start_lanelets_.clear();
   goal_lanelets_.clear();
   route_ptr_ = nullptr;
+  buildRouteLaneletTable();
   is_handler_ready_ = false;
 }
 
@@ -377,6 +417,7 @@ void RouteHandler::setLaneletsFromRouteMsg()
   preferred_lanelets_.clear();
   const bool is_route_valid = lanelet::utils::route::isRouteValid(*route_ptr_, lanelet_map_ptr_);
   if (!is_route_valid) {
+    buildRouteLaneletTable();
     return;
   }
 
@@ -412,9 +453,114 @@ void RouteHandler::setLaneletsFromRouteMsg()
       start_lanelets_.push_back(llt);
     }
   }
+  buildRouteLaneletTable();
   is_handler_ready_ = true;
 }
 
+void RouteHandler::buildRouteLaneletTable()
+{
+  route_lanelet_table_.clear();
+  route_lanelet_table_index_.clear();
+  route_lanelet_boxes_.clear();
+  if (route_lanelets_.empty() || !routing_graph_ptr_ || !lanelet_map_ptr_) {
+    return;
+  }
+
+  const auto add_entry = [&](const lanelet::ConstLanelet & llt, const bool is_route) {
+    if (!route_lanelet_table_index_.emplace(llt.id(), route_lanelet_table_.size()).second) {
+      return;
+    }
+    RouteLaneletEntry entry;
+    entry.lanelet = llt;
+    entry.is_route = is_route;
+    route_lanelet_table_.push_back(entry);
+  };
+
+  route_lanelet_boxes_.reserve(route_lanelets_.size());
+  for (const auto & llt : route_lanelets_) {
+    add_entry(llt, true);
+    route_lanelet_boxes_.push_back(lanelet::geometry::boundingBox2d(llt));
+  }
+
+  // lateral neighbors are added while iterating so that the shared linestring lanelets are
+  // served from the table as well
+  for (size_t i = 0; i < route_lanelet_table_.size(); ++i) {
+    const auto llt = route_lanelet_table_.at(i).lanelet;
+
+    std::optional<lanelet::ConstLanelet> left_lanelet;
+    if (const auto & left_lane = routing_graph_ptr_->left(llt)) {
+      left_lanelet = *left_lane;
+    } else if (const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(llt)) {
+      left_lanelet = *adjacent_left_lane;
+    }
+    std::optional<lanelet::ConstLanelet> right_lanelet;
+    if (const auto & right_lane = routing_graph_ptr_->right(llt)) {
+      right_lanelet = *right_lane;
+    } else if (const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(llt)) {
+      right_lanelet = *adjacent_right_lane;
+    }
+    const auto left_opposite_lanelets = findLeftOppositeLanelets(*lanelet_map_ptr_, llt);
+    const auto right_opposite_lanelets = findRightOppositeLanelets(*lanelet_map_ptr_, llt);
+
+    if (left_lanelet) add_entry(*left_lanelet, false);
+    if (right_lanelet) add_entry(*right_lanelet, false);
+    for (const auto & opposite_lanelets : {left_opposite_lanelets, right_opposite_lanelets}) {
+      for (const auto & opposite_lanelet : opposite_lanelets) {
+        add_entry(opposite_lanelet, false);
+      }
+    }
+
+    auto & entry = route_lanelet_table_.at(i);
+    entry.left_lanelet = left_lanelet;
+    entry.right_lanelet = right_lanelet;
+    entry.left_shoulder_lanelet = getLeftShoulderLanelet(llt);
+    entry.right_shoulder_lanelet = getRightShoulderLanelet(llt);
+    entry.left_opposite_lanelets = left_opposite_lanelets;
+    entry.right_opposite_lanelets = right_opposite_lanelets;
+  }
+
+  // NOTE: the route membership is looked up in the table from here
+  const auto start_lane_id = route_ptr_ && !route_ptr_->segments.empty()
+                               ? route_ptr_->segments.front().preferred_primitive.id
+                               : lanelet::InvalId;
+  for (auto & entry : route_lanelet_table_) {
+    const auto & llt = entry.lanelet;
+    entry.is_start = exists(start_lanelets_, llt);
+    entry.is_goal = exists(goal_lanelets_, llt);
+    entry.length = static_cast<double>(boost::geometry::length(llt.centerline().basicLineString()));
+    for (const auto & next_lanelet : routing_graph_ptr_->following(llt)) {
+      if (start_lane_id != next_lanelet.id() && isRouteLanelet(next_lanelet)) {
+        entry.next_lanelets.push_back(next_lanelet);
+      }
+    }
+    for (const auto & prev_lanelet : routing_graph_ptr_->previous(llt)) {
+      if (isRouteLanelet(prev_lanelet)) {
+        entry.prev_lanelets.push_back(prev_lanelet);
+      }
+    }
+  }
+}
+
+const RouteHandler::RouteLaneletEntry * RouteHandler::findRouteLaneletEntry(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  const auto itr = route_lanelet_table_index_.find(lanelet.id());
+  if (itr == route_lanelet_table_index_.end()) {
+    return nullptr;
+  }
+  const auto & entry = route_lanelet_table_.at(itr->second);
+  // NOTE: an inverted lanelet has the same id but is not on the route
+  return entry.lanelet == lanelet ? &entry : nullptr;
+}
+
+double RouteHandler::getLaneletLength(const lanelet::ConstLanelet & lanelet) const
+{
+  if (const auto entry = findRouteLaneletEntry(lanelet)) {
+    return entry->length;
+  }
+  return static_cast<double>(boost::geometry::length(lanelet.centerline().basicLineString()));
+}
+
 Header RouteHandler::getRouteHeader() const
 {
   if (!route_ptr_) {
@@ -566,7 +712,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
   lanelet::ConstLanelets lanelet_sequence_forward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence_forward;
   }
 
@@ -590,8 +736,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
     }
     lanelet_sequence_forward.push_back(next_lanelet);
     current_lanelet = next_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
+    length += getLaneletLength(next_lanelet);
   }
 
   return lanelet_sequence_forward;
@@ -601,7 +746,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
   lanelet::ConstLanelets lanelet_sequence_backward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence_backward;
   }
 
@@ -644,8 +789,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
     for (const auto & prev_lanelet : previous_lanelets) {
       if (!isNewLanelet(prev_lanelet) || exists(goal_lanelets_, prev_lanelet)) continue;
       lanelet_sequence_backward.push_back(prev_lanelet);
-      length +=
-        static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
+      length += getLaneletLength(prev_lanelet);
       current_lanelet = prev_lanelet;
       break;
     }
@@ -666,7 +810,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   }
 
   lanelet::ConstLanelets lanelet_sequence;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence;
   }
 
@@ -709,7 +853,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   const lanelet::ConstLanelet & lanelet, const Pose & current_pose, const double backward_distance,
   const double forward_distance, const bool only_route_lanes) const
 {
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return {};
   }
 
@@ -909,7 +1053,49 @@ lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequence(
 bool RouteHandler::getClosestLaneletWithinRoute(
   const Pose & search_pose, lanelet::ConstLanelet * closest_lanelet) const
 {
-  return lanelet::utils::query::getClosestLanelet(route_lanelets_, search_pose, closest_lanelet);
+  if (route_lanelet_boxes_.size() != route_lanelets_.size()) {
+    return lanelet::utils::query::getClosestLanelet(route_lanelets_, search_pose, closest_lanelet);
+  }
+
+  // NOTE: The distance to the bounding box is a lower bound of the distance to the lanelet, and the
+  // distance to a bound point is an upper bound of it. Only the lanelets whose lower bound does not
+  // exceed the smallest upper bound can be the closest one, so the others are dropped before the
+  // exact search. The order of the route lanelets is kept so that the tie-break does not change.
+  constexpr double margin = 1e-6;
+  const lanelet::BasicPoint2d search_point(search_pose.position.x, search_pose.position.y);
+  std::vector<std::pair<double, size_t>> lower_bounds;
+  lower_bounds.reserve(route_lanelets_.size());
+  for (size_t i = 0; i < route_lanelets_.size(); ++i) {
+    const auto & box = route_lanelet_boxes_.at(i);
+    lower_bounds.emplace_back(
+      box.isEmpty() ? 0.0 : lanelet::geometry::distance2d(box, search_point), i);
+  }
+  std::sort(lower_bounds.begin(), lower_bounds.end());
+
+  std::vector<size_t> candidate_indices;
+  double min_upper_bound = std::numeric_limits<double>::max();
+  for (const auto & [lower_bound, idx] : lower_bounds) {
+    if (min_upper_bound + margin < lower_bound) {
+      break;
+    }
+    candidate_indices.push_back(idx);
+    const auto & llt = route_lanelets_.at(idx);
+    for (const auto & bound : {llt.leftBound2d(), llt.rightBound2d()}) {
+      for (const auto & p : bound) {
+        min_upper_bound = std::min(
+          min_upper_bound, std::hypot(p.x() - search_point.x(), p.y() - search_point.y()));
+      }
+    }
+  }
+  std::sort(candidate_indices.begin(), candidate_indices.end());
+
+  lanelet::ConstLanelets candidate_lanelets;
+  candidate_lanelets.reserve(candidate_indices.size());
+  for (const auto idx : candidate_indices) {
+    candidate_lanelets.push_back(route_lanelets_.at(idx));
+  }
+  return lanelet::utils::query::getClosestLanelet(
+    candidate_lanelets, search_pose, closest_lanelet);
 }
 
 bool RouteHandler::getClosestPreferredLaneletWithinRoute(
@@ -954,6 +1140,14 @@ bool RouteHandler::getClosestRouteLaneletFromLanelet(
 bool RouteHandler::getNextLaneletsWithinRoute(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelets * next_lanelets) const
 {
+  if (const auto entry = findRouteLaneletEntry(lanelet)) {
+    if (entry->is_goal) {
+      return false;
+    }
+    *next_lanelets = entry->next_lanelets;
+    return !(next_lanelets->empty());
+  }
+
   if (exists(goal_lanelets_, lanelet)) {
     return false;
   }
@@ -963,7 +1157,7 @@ bool RouteHandler::getNextLaneletsWithinRoute(
   const auto following_lanelets = routing_graph_ptr_->following(lanelet);
   next_lanelets->clear();
   for (const auto & llt : following_lanelets) {
-    if (start_lane_id != llt.id() && exists(route_lanelets_, llt)) {
+    if (start_lane_id != llt.id() && isRouteLanelet(llt)) {
       next_lanelets->push_back(llt);
     }
   }
@@ -989,13 +1183,21 @@ lanelet::ConstLanelets RouteHandler::getNextLanelets(const lanelet::ConstLanelet
 bool RouteHandler::getPreviousLaneletsWithinRoute(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelets * prev_lanelets) const
 {
+  if (const auto entry = findRouteLaneletEntry(lanelet)) {
+    if (entry->is_start) {
+      return false;
+    }
+    *prev_lanelets = entry->prev_lanelets;
+    return !(prev_lanelets->empty());
+  }
+
   if (exists(start_lanelets_, lanelet)) {
     return false;
   }
   const auto candidate_lanelets = routing_graph_ptr_->previous(lanelet);
   prev_lanelets->clear();
   for (const auto & llt : candidate_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       prev_lanelets->push_back(llt);
     }
   }
@@ -1020,22 +1222,32 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getRightLanelet(
     return std::nullopt;
   }
 
+  const auto entry = findRouteLaneletEntry(lanelet);
+
   // right shoulder lanelet
   if (get_shoulder_lane) {
-    const auto right_shoulder_lanelet = getRightShoulderLanelet(lanelet);
+    const auto right_shoulder_lanelet =
+      entry ? entry->right_shoulder_lanelet : getRightShoulderLanelet(lanelet);
     if (right_shoulder_lanelet) return *right_shoulder_lanelet;
   }
 
-  // routable lane
-  const auto & right_lane = routing_graph_ptr_->right(lanelet);
-  if (right_lane) {
-    return *right_lane;
-  }
+  if (entry) {
+    // routable or non-routable lane from the table
+    if (entry->right_lanelet) {
+      return *entry->right_lanelet;
+    }
+  } else {
+    // routable lane
+    const auto & right_lane = routing_graph_ptr_->right(lanelet);
+    if (right_lane) {
+      return *right_lane;
+    }
 
-  // non-routable lane (e.g. lane change infeasible)
-  const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(lanelet);
-  if (adjacent_right_lane) {
-    return *adjacent_right_lane;
+    // non-routable lane (e.g. lane change infeasible)
+    const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(lanelet);
+    if (adjacent_right_lane) {
+      return *adjacent_right_lane;
+    }
   }
 
   // same root right lanelet
@@ -1086,22 +1298,32 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getLeftLanelet(
     return std::nullopt;
   }
 
+  const auto entry = findRouteLaneletEntry(lanelet);
+
   // left shoulder lanelet
   if (get_shoulder_lane) {
-    const auto left_shoulder_lanelet = getLeftShoulderLanelet(lanelet);
+    const auto left_shoulder_lanelet =
+      entry ? entry->left_shoulder_lanelet : getLeftShoulderLanelet(lanelet);
     if (left_shoulder_lanelet) return *left_shoulder_lanelet;
   }
 
-  // routable lane
-  const auto & left_lane = routing_graph_ptr_->left(lanelet);
-  if (left_lane) {
-    return *left_lane;
-  }
+  if (entry) {
+    // routable or non-routable lane from the table
+    if (entry->left_lanelet) {
+      return *entry->left_lanelet;
+    }
+  } else {
+    // routable lane
+    const auto & left_lane = routing_graph_ptr_->left(lanelet);
+    if (left_lane) {
+      return *left_lane;
+    }
 
-  // non-routable lane (e.g. lane change infeasible)
-  const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(lanelet);
-  if (adjacent_left_lane) {
-    return *adjacent_left_lane;
+    // non-routable lane (e.g. lane change infeasible)
+    const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(lanelet);
+    if (adjacent_left_lane) {
+      return *adjacent_left_lane;
+    }
   }
 
   // same root right lanelet
@@ -1143,19 +1365,10 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getLeftLanelet(
 lanelet::Lanelets RouteHandler::getRightOppositeLanelets(
   const lanelet::ConstLanelet & lanelet) const
 {
-  const auto opposite_candidate_lanelets =
-    lanelet_map_ptr_->laneletLayer.findUsages(lanelet.rightBound().invert());
-
-  lanelet::Lanelets opposite_lanelets;
-  for (const auto & candidate_lanelet : opposite_candidate_lanelets) {
-    if (candidate_lanelet.leftBound().id() == lanelet.rightBound().id()) {
-      continue;
-    }
-
-    opposite_lanelets.push_back(candidate_lanelet);
+  if (const auto entry = findRouteLaneletEntry(lanelet)) {
+    return entry->right_opposite_lanelets;
   }
-
-  return opposite_lanelets;
+  return findRightOppositeLanelets(*lanelet_map_ptr_, lanelet);
 }
 
 lanelet::ConstLanelets RouteHandler::getAllLeftSharedLinestringLanelets(
@@ -1251,19 +1464,10 @@ lanelet::ConstLanelets RouteHandler::getAllSharedLineStringLanelets(
 
 lanelet::Lanelets RouteHandler::getLeftOppositeLanelets(const lanelet::ConstLanelet & lanelet) const
 {
-  const auto opposite_candidate_lanelets =
-    lanelet_map_ptr_->laneletLayer.findUsages(lanelet.leftBound().invert());
-
-  lanelet::Lanelets opposite_lanelets;
-  for (const auto & candidate_lanelet : opposite_candidate_lanelets) {
-    if (candidate_lanelet.rightBound().id() == lanelet.leftBound().id()) {
-      continue;
-    }
-
-    opposite_lanelets.push_back(candidate_lanelet);
+  if (const auto entry = findRouteLaneletEntry(lanelet)) {
+    return entry->left_opposite_lanelets;
   }
-
-  return opposite_lanelets;
+  return findLeftOppositeLanelets(*lanelet_map_ptr_, lanelet);
 }
 
 lanelet::ConstLanelet RouteHandler::getMostRightLanelet(
@@ -1800,7 +2004,8 @@ bool RouteHandler::isShoulderLanelet(const lanelet::ConstLanelet & lanelet) cons
 
 bool RouteHandler::isRouteLanelet(const lanelet::ConstLanelet & lanelet) const
 {
-  return lanelet::utils::contains(route_lanelets_, lanelet);
+  const auto entry = findRouteLaneletEntry(lanelet);
+  return entry && entry->is_route;
 }
 
 bool RouteHandler::isRoadLanelet(const lanelet::ConstLanelet & lanelet) const
@@ -1848,7 +2053,7 @@ lanelet::ConstLanelets RouteHandler::getNeighborsWithinRoute(
     lanelet::utils::query::getAllNeighbors(routing_graph_ptr_, lanelet);
   lanelet::ConstLanelets neighbors_within_route;
   for (const auto & llt : neighbor_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       neighbors_within_route.push_back(llt);
     }
   }
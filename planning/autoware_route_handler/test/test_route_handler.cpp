@@ -20,6 +20,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace autoware::route_handler::test
 {
 TEST_F(TestRouteHandler, isRouteHandlerReadyTest)
@@ -267,6 +270,57 @@ TEST_F(TestRouteHandler, getClosestLaneletWithinRouteWhenPointsInRoute)
   ASSERT_EQ(get_closest_lanelet_within_route(0.5, 1.75, 0).value(), 4424ul);
 }
 
+TEST_F(TestRouteHandler, getRouteLaneletRelationsSameAsRoutingGraph)
+{
+  const auto routing_graph_ptr = route_handler_->getRoutingGraphPtr();
+  const auto route_lanelets = route_handler_->getRouteLanelets();
+  ASSERT_FALSE(route_lanelets.empty());
+
+  const auto is_in_route = [&](const lanelet::ConstLanelet & llt) {
+    return std::any_of(route_lanelets.begin(), route_lanelets.end(), [&](const auto & route_llt) {
+      return route_llt.id() == llt.id();
+    });
+  };
+  const auto to_ids = [](const lanelet::ConstLanelets & lanelets) {
+    std::vector<lanelet::Id> ids;
+    for (const auto & llt : lanelets) {
+      ids.push_back(llt.id());
+    }
+    return ids;
+  };
+
+  for (const auto & llt : route_lanelets) {
+    EXPECT_TRUE(route_handler_->isRouteLanelet(llt));
+
+    lanelet::ConstLanelets prev_lanelets;
+    if (route_handler_->getPreviousLaneletsWithinRoute(llt, &prev_lanelets)) {
+      lanelet::ConstLanelets expected;
+      for (const auto & prev_llt : routing_graph_ptr->previous(llt)) {
+        if (is_in_route(prev_llt)) expected.push_back(prev_llt);
+      }
+      EXPECT_EQ(to_ids(prev_lanelets), to_ids(expected));
+    }
+
+    const auto left_lanelet = route_handler_->getLeftLanelet(llt, false, false);
+    auto expected_left_lanelet = routing_graph_ptr->left(llt);
+    if (!expected_left_lanelet) expected_left_lanelet = routing_graph_ptr->adjacentLeft(llt);
+    ASSERT_EQ(left_lanelet.has_value(), static_cast<bool>(expected_left_lanelet));
+    if (left_lanelet) EXPECT_EQ(left_lanelet->id(), expected_left_lanelet->id());
+
+    const auto right_lanelet = route_handler_->getRightLanelet(llt, false, false);
+    auto expected_right_lanelet = routing_graph_ptr->right(llt);
+    if (!expected_right_lanelet) expected_right_lanelet = routing_graph_ptr->adjacentRight(llt);
+    ASSERT_EQ(right_lanelet.has_value(), static_cast<bool>(expected_right_lanelet));
+    if (right_lanelet) EXPECT_EQ(right_lanelet->id(), expected_right_lanelet->id());
+  }
+
+  // the lanelets out of the route are not served from the table
+  EXPECT_FALSE(route_handler_->isRouteLanelet(route_handler_->getLaneletsFromId(4780).invert()));
+
+  route_handler_->clearRoute();
+  EXPECT_FALSE(route_handler_->isRouteLanelet(route_lanelets.front()));
+}
+
 TEST_F(TestRouteHandler, testGetLaneChangeTargetLanes)
 {
   {
@@ -182,6 +182,9 @@ private:
 
   std::shared_ptr<SmootherBase> smoother_;
 
+  // scratch buffers of the post resampling
+  autoware::motion_utils::ResampleWorkspace resample_workspace_;
+
   bool publish_debug_trajs_;  // publish planned trajectories
 
   double over_stop_velocity_warn_thr_;  // threshold to publish over velocity warn
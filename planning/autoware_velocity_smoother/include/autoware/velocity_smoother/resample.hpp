@@ -15,6 +15,8 @@
 #ifndef AUTOWARE__VELOCITY_SMOOTHER__RESAMPLE_HPP_
 #define AUTOWARE__VELOCITY_SMOOTHER__RESAMPLE_HPP_
 
+#include "autoware/motion_utils/resample/resample.hpp"
+
 #include "autoware_planning_msgs/msg/trajectory_point.hpp"
 #include <geometry_msgs/msg/pose.hpp>
 
@@ -41,12 +43,14 @@ struct ResampleParam
 TrajectoryPoints resampleTrajectory(
   const TrajectoryPoints & input, const double v_current,
   const geometry_msgs::msg::Pose & current_pose, const double nearest_dist_threshold,
-  const double nearest_yaw_threshold, const ResampleParam & param, const bool use_zoh_for_v = true);
+  const double nearest_yaw_threshold, const ResampleParam & param,
+  autoware::motion_utils::ResampleWorkspace & workspace, const bool use_zoh_for_v = true);
 
 TrajectoryPoints resampleTrajectory(
   const TrajectoryPoints & input, const geometry_msgs::msg::Pose & current_pose,
   const double nearest_dist_threshold, const double nearest_yaw_threshold,
-  const ResampleParam & param, const double nominal_ds, const bool use_zoh_for_v = true);
+  const ResampleParam & param, const double nominal_ds,
+  autoware::motion_utils::ResampleWorkspace & workspace, const bool use_zoh_for_v = true);
 }  // namespace resampling
 }  // namespace autoware::velocity_smoother
 
@@ -92,6 +92,10 @@ public:
 protected:
   BaseParam base_param_;
   mutable std::shared_ptr<autoware::universe_utils::TimeKeeper> time_keeper_{nullptr};
+
+  // scratch buffers of the resampling owned by the calling thread. a smoother is shared by the
+  // planner data of the scene modules, which may call its const methods concurrently
+  static autoware::motion_utils::ResampleWorkspace & getResampleWorkspace();
 };
 }  // namespace autoware::velocity_smoother
 
@@ -499,7 +499,7 @@ void VelocitySmootherNode::onCurrentTrajectory(const Trajectory::ConstSharedPtr
   auto output_resampled = resampling::resampleTrajectory(
     output, current_odometry_ptr_->twist.twist.linear.x, current_odometry_ptr_->pose.pose,
     node_param_.ego_nearest_dist_threshold, node_param_.ego_nearest_yaw_threshold,
-    node_param_.post_resample_param, false);
+    node_param_.post_resample_param, resample_workspace_, false);
 
   // Set 0 at the end of the trajectory
   if (!output_resampled.empty()) {
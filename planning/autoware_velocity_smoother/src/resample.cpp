@@ -29,7 +29,8 @@ namespace resampling
 TrajectoryPoints resampleTrajectory(
   const TrajectoryPoints & input, const double v_current,
   const geometry_msgs::msg::Pose & current_pose, const double nearest_dist_threshold,
-  const double nearest_yaw_threshold, const ResampleParam & param, const bool use_zoh_for_v)
+  const double nearest_yaw_threshold, const ResampleParam & param,
+  autoware::motion_utils::ResampleWorkspace & workspace, const bool use_zoh_for_v)
 {
   // Arc length from the initial point to the closest point
   const size_t current_seg_idx =
@@ -128,8 +129,10 @@ TrajectoryPoints resampleTrajectory(
     return input;
   }
 
-  const auto output_traj = autoware::motion_utils::resampleTrajectory(
-    autoware::motion_utils::convertToTrajectory(input), out_arclength, false, true, use_zoh_for_v);
+  autoware_planning_msgs::msg::Trajectory output_traj;
+  autoware::motion_utils::resampleTrajectory(
+    autoware::motion_utils::convertToTrajectory(input), out_arclength, workspace, output_traj,
+    false, true, use_zoh_for_v);
   auto output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
 
   // add end point directly to consider the endpoint velocity.
@@ -148,7 +151,8 @@ TrajectoryPoints resampleTrajectory(
 TrajectoryPoints resampleTrajectory(
   const TrajectoryPoints & input, const geometry_msgs::msg::Pose & current_pose,
   const double nearest_dist_threshold, const double nearest_yaw_threshold,
-  const ResampleParam & param, const double nominal_ds, const bool use_zoh_for_v)
+  const ResampleParam & param, const double nominal_ds,
+  autoware::motion_utils::ResampleWorkspace & workspace, const bool use_zoh_for_v)
 {
   // input arclength
   const double trajectory_length = autoware::motion_utils::calcArcLength(input);
@@ -248,8 +252,10 @@ TrajectoryPoints resampleTrajectory(
     return input;
   }
 
-  const auto output_traj = autoware::motion_utils::resampleTrajectory(
-    autoware::motion_utils::convertToTrajectory(input), out_arclength, false, true, use_zoh_for_v);
+  autoware_planning_msgs::msg::Trajectory output_traj;
+  autoware::motion_utils::resampleTrajectory(
+    autoware::motion_utils::convertToTrajectory(input), out_arclength, workspace, output_traj,
+    false, true, use_zoh_for_v);
   auto output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
 
   // add end point directly to consider the endpoint velocity.
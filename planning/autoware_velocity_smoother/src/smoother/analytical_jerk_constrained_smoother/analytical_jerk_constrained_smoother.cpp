@@ -301,8 +301,10 @@ TrajectoryPoints AnalyticalJerkConstrainedSmoother::applyLateralAccelerationFilt
     for (double s = 0; s < in_arclength.back(); s += points_interval) {
       out_arclength.push_back(s);
     }
-    const auto output_traj = autoware::motion_utils::resampleTrajectory(
-      autoware::motion_utils::convertToTrajectory(input), out_arclength);
+    autoware_planning_msgs::msg::Trajectory output_traj;
+    autoware::motion_utils::resampleTrajectory(
+      autoware::motion_utils::convertToTrajectory(input), out_arclength, getResampleWorkspace(),
+      output_traj);
     output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
     output.back() = input.back();  // keep the final speed.
   } else {
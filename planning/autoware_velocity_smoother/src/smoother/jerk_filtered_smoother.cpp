@@ -110,7 +110,7 @@ bool JerkFilteredSmoother::apply(
 
     return resampling::resampleTrajectory(
       trajectory, v0, initial_traj_pose, std::numeric_limits<double>::max(),
-      std::numeric_limits<double>::max(), base_param_.resample_param);
+      std::numeric_limits<double>::max(), base_param_.resample_param, getResampleWorkspace());
   };
 
   auto opt_resampled_trajectory = resample(filtered);
@@ -489,7 +489,7 @@ TrajectoryPoints JerkFilteredSmoother::resampleTrajectory(
 
   return resampling::resampleTrajectory(
     input, current_pose, nearest_dist_threshold, nearest_yaw_threshold, base_param_.resample_param,
-    smoother_param_.jerk_filter_ds);
+    smoother_param_.jerk_filter_ds, getResampleWorkspace());
 }
 
 }  // namespace autoware::velocity_smoother
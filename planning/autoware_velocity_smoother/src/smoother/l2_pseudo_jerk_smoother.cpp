@@ -17,6 +17,7 @@
 #include "autoware/velocity_smoother/trajectory_utils.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <algorithm>
 #include <chrono>
@@ -91,13 +92,17 @@ bool L2PseudoJerkSmoother::apply(
   const uint32_t l_variables = 4 * N;
   const uint32_t l_constraints = 3 * N + 1;
 
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(
-    l_constraints, l_variables);  // the matrix size depends on constraint numbers.
+  // NOTE: Only the structural non-zeros are stored, even if their values are zero, so that the
+  // sparsity pattern depends only on N and the solver workspace can be reused between cycles.
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  A_triplets.reserve(7 * N);
 
   std::vector<double> lower_bound(l_constraints, 0.0);
   std::vector<double> upper_bound(l_constraints, 0.0);
 
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
+  // upper triangular part of P
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  P_triplets.reserve(6 * N);
   std::vector<double> q(l_variables, 0.0);
 
   const double a_max = base_param_.max_accel;
@@ -115,18 +120,17 @@ bool L2PseudoJerkSmoother::apply(
   for (unsigned int i = N; i < 2 * N - 1; ++i) {
     unsigned int j = i - N;
     const double w_x_ds_inv = 1.0 / std::max(interval_dist_arr.at(j), 0.0001);
-    P(i, i) += w_x_ds_inv * w_x_ds_inv * smooth_weight;
-    P(i, i + 1) -= w_x_ds_inv * w_x_ds_inv * smooth_weight;
-    P(i + 1, i) -= w_x_ds_inv * w_x_ds_inv * smooth_weight;
-    P(i + 1, i + 1) += w_x_ds_inv * w_x_ds_inv * smooth_weight;
+    P_triplets.emplace_back(i, i, w_x_ds_inv * w_x_ds_inv * smooth_weight);
+    P_triplets.emplace_back(i, i + 1, -w_x_ds_inv * w_x_ds_inv * smooth_weight);
+    P_triplets.emplace_back(i + 1, i + 1, w_x_ds_inv * w_x_ds_inv * smooth_weight);
   }
 
   for (unsigned int i = 2 * N; i < 3 * N; ++i) {  // over velocity cost
-    P(i, i) += over_v_weight;
+    P_triplets.emplace_back(i, i, over_v_weight);
   }
 
   for (unsigned int i = 3 * N; i < 4 * N; ++i) {  // over acceleration cost
-    P(i, i) += over_a_weight;
+    P_triplets.emplace_back(i, i, over_a_weight);
   }
 
   /* design constraint matrix
@@ -139,8 +143,8 @@ bool L2PseudoJerkSmoother::apply(
   */
   for (unsigned int i = 0; i < N; ++i) {
     const int j = 2 * N + i;
-    A(i, i) = 1.0;   // b_i
-    A(i, j) = -1.0;  // -delta_i
+    A_triplets.emplace_back(i, i, 1.0);   // b_i
+    A_triplets.emplace_back(i, j, -1.0);  // -delta_i
     upper_bound[i] = v_max[i] * v_max[i];
     lower_bound[i] = 0.0;
   }
@@ -148,8 +152,8 @@ bool L2PseudoJerkSmoother::apply(
   // a_min < a - sigma < a_max
   for (unsigned int i = N; i < 2 * N; ++i) {
     const int j = 2 * N + i;
-    A(i, i) = 1.0;   // a_i
-    A(i, j) = -1.0;  // -sigma_i
+    A_triplets.emplace_back(i, i, 1.0);   // a_i
+    A_triplets.emplace_back(i, j, -1.0);  // -sigma_i
     if (i != N && v_max[i - N] < std::numeric_limits<double>::epsilon()) {
       upper_bound[i] = 0.0;
       lower_bound[i] = 0.0;
@@ -163,9 +167,9 @@ bool L2PseudoJerkSmoother::apply(
   for (unsigned int i = 2 * N; i < 3 * N - 1; ++i) {
     const unsigned int j = i - 2 * N;
     const double ds_inv = 1.0 / std::max(interval_dist_arr.at(j), 0.0001);
-    A(i, j) = -ds_inv;     // b(i)
-    A(i, j + 1) = ds_inv;  // b(i+1)
-    A(i, j + N) = -2.0;    // a(i)
+    A_triplets.emplace_back(i, j, -ds_inv);     // b(i)
+    A_triplets.emplace_back(i, j + 1, ds_inv);  // b(i+1)
+    A_triplets.emplace_back(i, j + N, -2.0);    // a(i)
     upper_bound[i] = 0.0;
     lower_bound[i] = 0.0;
   }
@@ -174,22 +178,31 @@ bool L2PseudoJerkSmoother::apply(
   const double v0 = initial_vel;
   {
     const unsigned int i = 3 * N - 1;
-    A(i, 0) = 1.0;  // b0
+    A_triplets.emplace_back(i, 0, 1.0);  // b0
     upper_bound[i] = v0 * v0;
     lower_bound[i] = v0 * v0;
 
-    A(i + 1, N) = 1.0;  // a0
+    A_triplets.emplace_back(i + 1, N, 1.0);  // a0
     upper_bound[i + 1] = initial_acc;
     lower_bound[i + 1] = initial_acc;
   }
 
+  Eigen::SparseMatrix<double> P(l_variables, l_variables);
+  P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  Eigen::SparseMatrix<double> A(l_constraints, l_variables);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+
   const auto tf1 = std::chrono::system_clock::now();
   const double dt_ms1 =
     std::chrono::duration_cast<std::chrono::nanoseconds>(tf1 - ts).count() * 1.0e-6;
 
   // execute optimization
   const auto ts2 = std::chrono::system_clock::now();
-  const auto result = qp_solver_.optimize(P, A, q, lower_bound, upper_bound);
+  // the previous solution is used as the initial guess when the workspace is reused
+  qp_solver_.initializeOrUpdateProblem(
+    autoware::osqp_interface::calCSCMatrixTrapezoidal(P),
+    autoware::osqp_interface::calCSCMatrix(A), q, lower_bound, upper_bound);
+  const auto result = qp_solver_.optimize();
 
   // [b0, b1, ..., bN, |  a0, a1, ..., aN, |
   //  delta0, delta1, ..., deltaN, | sigma0, sigma1, ..., sigmaN]
@@ -243,7 +256,7 @@ TrajectoryPoints L2PseudoJerkSmoother::resampleTrajectory(
 {
   return resampling::resampleTrajectory(
     input, v0, current_pose, nearest_dist_threshold, nearest_yaw_threshold,
-    base_param_.resample_param);
+    base_param_.resample_param, getResampleWorkspace());
 }
 
 }  // namespace autoware::velocity_smoother
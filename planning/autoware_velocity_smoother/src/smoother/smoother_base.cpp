@@ -34,7 +34,8 @@ namespace autoware::velocity_smoother
 namespace
 {
 TrajectoryPoints applyPreProcess(
-  const TrajectoryPoints & input, const double interval, const bool use_resampling)
+  const TrajectoryPoints & input, const double interval, const bool use_resampling,
+  autoware::motion_utils::ResampleWorkspace & workspace)
 {
   using autoware::motion_utils::calcArcLength;
   using autoware::motion_utils::convertToTrajectory;
@@ -54,7 +55,8 @@ TrajectoryPoints applyPreProcess(
     arc_length.push_back(s);
   }
 
-  const auto points = resampleTrajectory(convertToTrajectory(input), arc_length);
+  autoware_planning_msgs::msg::Trajectory points;
+  resampleTrajectory(convertToTrajectory(input), arc_length, workspace, points);
   output = convertToTrajectoryPointArray(points);
   output.back() = input.back();  // keep the final speed.
 
@@ -94,6 +96,12 @@ SmootherBase::SmootherBase(
     node.declare_parameter<double>("sparse_min_interval_distance");
 }
 
+autoware::motion_utils::ResampleWorkspace & SmootherBase::getResampleWorkspace()
+{
+  thread_local autoware::motion_utils::ResampleWorkspace workspace;
+  return workspace;
+}
+
 void SmootherBase::setWheelBase(const double wheel_base)
 {
   base_param_.wheel_base = wheel_base;
@@ -161,8 +169,10 @@ TrajectoryPoints SmootherBase::applyLateralAccelerationFilter(
     for (double s = 0; s < traj_length; s += points_interval) {
       out_arclength.push_back(s);
     }
-    const auto output_traj = autoware::motion_utils::resampleTrajectory(
-      autoware::motion_utils::convertToTrajectory(input), out_arclength);
+    autoware_planning_msgs::msg::Trajectory output_traj;
+    autoware::motion_utils::resampleTrajectory(
+      autoware::motion_utils::convertToTrajectory(input), out_arclength, getResampleWorkspace(),
+      output_traj);
     output = autoware::motion_utils::convertToTrajectoryPointArray(output_traj);
     output.back() = input.back();  // keep the final speed.
   } else {
@@ -223,7 +233,7 @@ TrajectoryPoints SmootherBase::applySteeringRateLimit(
   // Interpolate with constant interval distance for lateral acceleration calculation.
   const double points_interval = use_resampling ? base_param_.sample_ds : input_points_interval;
 
-  auto output = applyPreProcess(input, points_interval, use_resampling);
+  auto output = applyPreProcess(input, points_interval, use_resampling, getResampleWorkspace());
 
   const size_t idx_dist = static_cast<size_t>(
     std::max(static_cast<int>((base_param_.curvature_calculation_distance) / points_interval), 1));
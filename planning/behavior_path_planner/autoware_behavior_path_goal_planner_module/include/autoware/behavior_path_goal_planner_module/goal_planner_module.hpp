@@ -19,6 +19,7 @@
 #include "autoware/behavior_path_goal_planner_module/fixed_goal_planner_base.hpp"
 #include "autoware/behavior_path_goal_planner_module/goal_planner_parameters.hpp"
 #include "autoware/behavior_path_goal_planner_module/goal_searcher.hpp"
+#include "autoware/behavior_path_goal_planner_module/lane_parking_worker_pool.hpp"
 #include "autoware/behavior_path_goal_planner_module/thread_data.hpp"
 #include "autoware/behavior_path_planner_common/interface/scene_module_interface.hpp"
 #include "autoware/behavior_path_planner_common/utils/parking_departure/common_module_data.hpp"
@@ -299,6 +300,12 @@ private:
 
   // planner
   std::vector<std::shared_ptr<PullOverPlannerBase>> pull_over_planners_;
+  // planners used by the other workers of onTimer. each worker owns its own instances since the
+  // planners keep intermediate results as their members
+  std::vector<std::vector<std::shared_ptr<PullOverPlannerBase>>> worker_pull_over_planners_;
+  // workers of onTimer, where the worker i uses worker_pull_over_planners_[i - 1] and the worker 0
+  // is the thread of onTimer itself using pull_over_planners_
+  std::unique_ptr<LaneParkingWorkerPool> lane_parking_workers_;
   std::unique_ptr<PullOverPlannerBase> freespace_planner_;
   std::unique_ptr<FixedGoalPlannerBase> fixed_goal_planner_;
 
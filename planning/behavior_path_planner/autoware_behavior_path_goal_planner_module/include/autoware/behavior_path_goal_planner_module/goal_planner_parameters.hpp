@@ -96,6 +96,7 @@ struct GoalPlannerParameters
   std::string path_priority;  // "efficient_path" or "close_goal"
   std::vector<std::string> efficient_path_order{};
   double lane_departure_check_expansion_margin{0.0};
+  int lane_parking_thread_num{1};
 
   // shift path
   bool enable_shift_parking{false};
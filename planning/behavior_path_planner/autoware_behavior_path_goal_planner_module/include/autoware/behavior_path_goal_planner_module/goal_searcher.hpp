@@ -17,13 +17,49 @@
 
 #include "autoware/behavior_path_goal_planner_module/goal_searcher_base.hpp"
 
+#include <autoware/universe_utils/geometry/boost_geometry.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace autoware::behavior_path_planner
 {
 using autoware::universe_utils::LinearRing2d;
 using BasicPolygons2d = std::vector<lanelet::BasicPolygon2d>;
+using autoware::universe_utils::Box2d;
+using autoware::universe_utils::Polygon2d;
+using BoxIndexPair = std::pair<Box2d, size_t>;
+using BoxRtree = boost::geometry::index::rtree<BoxIndexPair, boost::geometry::index::rstar<16>>;
+
+/**
+ * @brief polygons of the objects and an R-tree of their envelopes, built once per update so that
+ * each goal candidate only checks the objects around it
+ */
+class ObjectPolygonIndex
+{
+public:
+  explicit ObjectPolygonIndex(const PredictedObjects & objects);
+
+  const Polygon2d & polygon(const size_t index) const { return polygons_.at(index); }
+  const Box2d & envelope(const size_t index) const { return envelopes_.at(index); }
+  size_t size() const { return polygons_.size(); }
+  // maximum diagonal length of the envelopes of the objects
+  double maxObjectSize() const { return max_object_size_; }
+
+  // indices of the objects whose envelope intersects the box, in ascending order
+  std::vector<size_t> query(const Box2d & box) const;
+  // objects whose envelope intersects the box, in the original order
+  PredictedObjects extract(const PredictedObjects & objects, const Box2d & box) const;
+
+private:
+  std::vector<Polygon2d> polygons_{};
+  std::vector<Box2d> envelopes_{};
+  BoxRtree rtree_{};
+  double max_object_size_{0.0};
+};
 
 class GoalSearcher : public GoalSearcherBase
 {
@@ -51,13 +87,14 @@ public:
 private:
   void countObjectsToAvoid(
     GoalCandidates & goal_candidates, const PredictedObjects & objects,
+    const ObjectPolygonIndex & object_index,
     const std::shared_ptr<const PlannerData> & planner_data,
     const Pose & reference_goal_pose) const;
   void createAreaPolygons(
     std::vector<Pose> original_search_poses,
     const std::shared_ptr<const PlannerData> & planner_data);
   bool checkCollision(
-    const Pose & pose, const PredictedObjects & objects,
+    const Pose & pose, const ObjectPolygonIndex & object_index,
     const std::shared_ptr<OccupancyGridBasedCollisionDetector> occupancy_grid_map) const;
   bool checkCollisionWithLongitudinalDistance(
     const Pose & ego_pose, const PredictedObjects & objects,
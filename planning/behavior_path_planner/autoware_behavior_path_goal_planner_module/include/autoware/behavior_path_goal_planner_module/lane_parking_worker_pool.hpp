@@ -0,0 +1,79 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_PATH_GOAL_PLANNER_MODULE__LANE_PARKING_WORKER_POOL_HPP_
+#define AUTOWARE__BEHAVIOR_PATH_GOAL_PLANNER_MODULE__LANE_PARKING_WORKER_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace autoware::behavior_path_planner
+{
+
+/**
+ * @brief persistent workers to plan the lane parking path candidates in parallel
+ * @details The threads are created once and reused by every run(). The caller of run() works as
+ *          the worker 0, so that worker_num - 1 threads are created.
+ */
+class LaneParkingWorkerPool
+{
+public:
+  using Task = std::function<void(const size_t worker_idx, const size_t task_idx)>;
+
+  explicit LaneParkingWorkerPool(const size_t worker_num);
+  ~LaneParkingWorkerPool();
+
+  LaneParkingWorkerPool(const LaneParkingWorkerPool &) = delete;
+  LaneParkingWorkerPool & operator=(const LaneParkingWorkerPool &) = delete;
+
+  size_t size() const { return threads_.size() + 1; }
+
+  /**
+   * @brief call task(worker_idx, task_idx) for every task_idx in [0, task_num) and wait for them
+   * @details The tasks of a worker are called one by one, so a task can use the state owned by
+   *          the worker of worker_idx. If a task throws, the remaining tasks are not started and
+   *          the first exception is rethrown on the caller thread.
+   */
+  void run(const size_t task_num, const Task & task);
+
+private:
+  void workerLoop(const size_t worker_idx);
+  void runTasks(const size_t worker_idx);
+
+  std::vector<std::thread> threads_;
+
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  bool stop_{false};
+  uint64_t generation_{0};
+  size_t running_thread_num_{0};
+  std::exception_ptr exception_{nullptr};
+
+  // set by run() before the workers are woken up
+  const Task * task_{nullptr};
+  size_t task_num_{0};
+  std::atomic<size_t> next_task_idx_{0};
+};
+
+}  // namespace autoware::behavior_path_planner
+
+#endif  // AUTOWARE__BEHAVIOR_PATH_GOAL_PLANNER_MODULE__LANE_PARKING_WORKER_POOL_HPP_
@@ -74,13 +74,6 @@ GoalPlannerModule::GoalPlannerModule(
   is_lane_parking_cb_running_{false},
   is_freespace_parking_cb_running_{false}
 {
-  LaneDepartureChecker lane_departure_checker{};
-  lane_departure_checker.setVehicleInfo(vehicle_info_);
-  lane_departure_checker::Param lane_departure_checker_params;
-  lane_departure_checker_params.footprint_extra_margin =
-    parameters->lane_departure_check_expansion_margin;
-  lane_departure_checker.setParam(lane_departure_checker_params);
-
   occupancy_grid_map_ = std::make_shared<OccupancyGridBasedCollisionDetector>();
 
   left_side_parking_ = parameters_->parking_policy == ParkingPolicy::LEFT_SIDE;
@@ -88,18 +81,36 @@ GoalPlannerModule::GoalPlannerModule(
   // planner when goal modification is not allowed
   fixed_goal_planner_ = std::make_unique<DefaultFixedGoalPlanner>();
 
-  for (const std::string & planner_type : parameters_->efficient_path_order) {
-    if (planner_type == "SHIFT" && parameters_->enable_shift_parking) {
-      pull_over_planners_.push_back(
-        std::make_shared<ShiftPullOver>(node, *parameters, lane_departure_checker));
-    } else if (planner_type == "ARC_FORWARD" && parameters_->enable_arc_forward_parking) {
-      pull_over_planners_.push_back(std::make_shared<GeometricPullOver>(
-        node, *parameters, lane_departure_checker, /*is_forward*/ true));
-    } else if (planner_type == "ARC_BACKWARD" && parameters_->enable_arc_backward_parking) {
-      pull_over_planners_.push_back(std::make_shared<GeometricPullOver>(
-        node, *parameters, lane_departure_checker, /*is_forward*/ false));
+  const auto create_pull_over_planners = [&]() {
+    // NOTE: LaneDepartureChecker has its own TimeKeeper, so it is not shared among the workers
+    LaneDepartureChecker lane_departure_checker{};
+    lane_departure_checker.setVehicleInfo(vehicle_info_);
+    lane_departure_checker::Param lane_departure_checker_params;
+    lane_departure_checker_params.footprint_extra_margin =
+      parameters->lane_departure_check_expansion_margin;
+    lane_departure_checker.setParam(lane_departure_checker_params);
+
+    std::vector<std::shared_ptr<PullOverPlannerBase>> planners;
+    for (const std::string & planner_type : parameters_->efficient_path_order) {
+      if (planner_type == "SHIFT" && parameters_->enable_shift_parking) {
+        planners.push_back(
+          std::make_shared<ShiftPullOver>(node, *parameters, lane_departure_checker));
+      } else if (planner_type == "ARC_FORWARD" && parameters_->enable_arc_forward_parking) {
+        planners.push_back(std::make_shared<GeometricPullOver>(
+          node, *parameters, lane_departure_checker, /*is_forward*/ true));
+      } else if (planner_type == "ARC_BACKWARD" && parameters_->enable_arc_backward_parking) {
+        planners.push_back(std::make_shared<GeometricPullOver>(
+          node, *parameters, lane_departure_checker, /*is_forward*/ false));
+      }
     }
+    return planners;
+  };
+  pull_over_planners_ = create_pull_over_planners();
+  for (int i = 1; i < parameters_->lane_parking_thread_num; ++i) {
+    worker_pull_over_planners_.push_back(create_pull_over_planners());
   }
+  lane_parking_workers_ =
+    std::make_unique<LaneParkingWorkerPool>(worker_pull_over_planners_.size() + 1);
 
   if (pull_over_planners_.empty()) {
     RCLCPP_WARN(
@@ -373,28 +384,8 @@ void GoalPlannerModule::onTimer()
     local_planner_data, parameters.backward_goal_search_length,
     parameters.forward_goal_search_length,
     /*forward_only_in_route*/ false);
-  std::vector<PullOverPath> path_candidates{};
-  std::optional<Pose> closest_start_pose{};
-  double min_start_arc_length = std::numeric_limits<double>::max();
-  const auto planCandidatePaths = [&](
-                                    const std::shared_ptr<PullOverPlannerBase> & planner,
-                                    const GoalCandidate & goal_candidate) {
-    const auto pull_over_path = planner->plan(
-      goal_candidate, path_candidates.size(), local_planner_data, previous_module_output);
-    if (pull_over_path) {
-      // calculate absolute maximum curvature of parking path(start pose to end pose) for path
-      // priority
-      path_candidates.push_back(*pull_over_path);
-      // calculate closest pull over start pose for stop path
-      const double start_arc_length =
-        lanelet::utils::getArcCoordinates(current_lanes, pull_over_path->start_pose()).length;
-      if (start_arc_length < min_start_arc_length) {
-        min_start_arc_length = start_arc_length;
-        // closest start pose is stop point when not finding safe path
-        closest_start_pose = pull_over_path->start_pose();
-      }
-    }
-  };
+  // pairs of (index of pull_over_planners_, goal candidate) in the order of the priority
+  std::vector<std::pair<size_t, GoalCandidate>> plan_requests{};
 
   // todo: currently non centerline input path is supported only by shift pull over
   const bool is_center_line_input_path = goal_planner_utils::isReferencePath(
@@ -405,23 +396,25 @@ void GoalPlannerModule::onTimer()
 
   // plan candidate paths and set them to the member variable
   if (parameters.path_priority == "efficient_path") {
-    for (const auto & planner : pull_over_planners_) {
+    for (size_t planner_idx = 0; planner_idx < pull_over_planners_.size(); ++planner_idx) {
+      const auto & planner = pull_over_planners_.at(planner_idx);
       // todo: temporary skip NON SHIFT planner when input path is not center line
       if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
         continue;
       }
       for (const auto & goal_candidate : goal_candidates) {
-        planCandidatePaths(planner, goal_candidate);
+        plan_requests.emplace_back(planner_idx, goal_candidate);
       }
     }
   } else if (parameters.path_priority == "close_goal") {
     for (const auto & goal_candidate : goal_candidates) {
-      for (const auto & planner : pull_over_planners_) {
+      for (size_t planner_idx = 0; planner_idx < pull_over_planners_.size(); ++planner_idx) {
+        const auto & planner = pull_over_planners_.at(planner_idx);
         // todo: temporary skip NON SHIFT planner when input path is not center line
         if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
           continue;
         }
-        planCandidatePaths(planner, goal_candidate);
+        plan_requests.emplace_back(planner_idx, goal_candidate);
       }
     }
   } else {
@@ -431,6 +424,34 @@ void GoalPlannerModule::onTimer()
     throw std::domain_error("[pull_over] invalid path_priority");
   }
 
+  // plan the requests in parallel. the index of the request is used as the path id so that the
+  // results do not depend on the order in which the workers finish
+  std::vector<std::optional<PullOverPath>> plan_results(plan_requests.size());
+  lane_parking_workers_->run(
+    plan_requests.size(), [&](const size_t worker_idx, const size_t request_idx) {
+      const auto & planners =
+        worker_idx == 0 ? pull_over_planners_ : worker_pull_over_planners_.at(worker_idx - 1);
+      const auto & [planner_idx, goal_candidate] = plan_requests.at(request_idx);
+      plan_results.at(request_idx) = planners.at(planner_idx)->plan(
+        goal_candidate, request_idx, local_planner_data, previous_module_output);
+    });
+
+  std::vector<PullOverPath> path_candidates{};
+  std::optional<Pose> closest_start_pose{};
+  double min_start_arc_length = std::numeric_limits<double>::max();
+  for (const auto & pull_over_path : plan_results) {
+    if (!pull_over_path) continue;
+    path_candidates.push_back(*pull_over_path);
+    // calculate closest pull over start pose for stop path
+    const double start_arc_length =
+      lanelet::utils::getArcCoordinates(current_lanes, pull_over_path->start_pose()).length;
+    if (start_arc_length < min_start_arc_length) {
+      min_start_arc_length = start_arc_length;
+      // closest start pose is stop point when not finding safe path
+      closest_start_pose = pull_over_path->start_pose();
+    }
+  }
+
   // set member variables
   thread_safe_data_.set_pull_over_path_candidates(path_candidates);
   thread_safe_data_.set_closest_start_pose(closest_start_pose);
@@ -25,11 +25,14 @@
 
 #include <autoware_vehicle_info_utils/vehicle_info.hpp>
 
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/union.hpp>
 
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -38,8 +41,65 @@ namespace autoware::behavior_path_planner
 {
 using autoware::universe_utils::calcOffsetPose;
 using lanelet::autoware::NoParkingArea;
+using autoware::universe_utils::Point2d;
 using lanelet::autoware::NoStoppingArea;
 
+namespace
+{
+Box2d expandBox(const Box2d & box, const double margin)
+{
+  Box2d expanded = box;
+  expanded.min_corner().x() -= margin;
+  expanded.min_corner().y() -= margin;
+  expanded.max_corner().x() += margin;
+  expanded.max_corner().y() += margin;
+  return expanded;
+}
+}  // namespace
+
+ObjectPolygonIndex::ObjectPolygonIndex(const PredictedObjects & objects)
+{
+  polygons_.reserve(objects.objects.size());
+  envelopes_.reserve(objects.objects.size());
+  std::vector<BoxIndexPair> rtree_nodes;
+  rtree_nodes.reserve(objects.objects.size());
+  for (const auto & object : objects.objects) {
+    polygons_.push_back(autoware::universe_utils::toPolygon2d(object));
+    envelopes_.push_back(boost::geometry::return_envelope<Box2d>(polygons_.back()));
+    const auto & envelope = envelopes_.back();
+    max_object_size_ = std::max(
+      max_object_size_, std::hypot(
+                          envelope.max_corner().x() - envelope.min_corner().x(),
+                          envelope.max_corner().y() - envelope.min_corner().y()));
+    rtree_nodes.emplace_back(envelope, rtree_nodes.size());
+  }
+  rtree_ = BoxRtree(rtree_nodes.begin(), rtree_nodes.end());
+}
+
+std::vector<size_t> ObjectPolygonIndex::query(const Box2d & box) const
+{
+  std::vector<BoxIndexPair> results;
+  rtree_.query(boost::geometry::index::intersects(box), std::back_inserter(results));
+  std::vector<size_t> indices;
+  indices.reserve(results.size());
+  for (const auto & result : results) {
+    indices.push_back(result.second);
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+PredictedObjects ObjectPolygonIndex::extract(
+  const PredictedObjects & objects, const Box2d & box) const
+{
+  PredictedObjects extracted_objects;
+  extracted_objects.header = objects.header;
+  for (const size_t index : query(box)) {
+    extracted_objects.objects.push_back(objects.objects.at(index));
+  }
+  return extracted_objects;
+}
+
 // Sort with smaller longitudinal distances taking precedence over smaller lateral distances.
 struct SortByLongitudinalDistance
 {
@@ -244,7 +304,8 @@ GoalCandidates GoalSearcher::search(const std::shared_ptr<const PlannerData> & p
 
 void GoalSearcher::countObjectsToAvoid(
   GoalCandidates & goal_candidates, const PredictedObjects & objects,
-  const std::shared_ptr<const PlannerData> & planner_data, const Pose & reference_goal_pose) const
+  const ObjectPolygonIndex & object_index, const std::shared_ptr<const PlannerData> & planner_data,
+  const Pose & reference_goal_pose) const
 {
   const auto & route_handler = planner_data->route_handler;
   const double forward_length = parameters_.forward_goal_search_length;
@@ -285,26 +346,47 @@ void GoalSearcher::countObjectsToAvoid(
     goal_candidate.num_objects_to_avoid = 0;
   }
 
+  // the footprints along the center line and the arc lengths of the goals do not depend on the
+  // objects, so they are computed only once
+  std::vector<LinearRing2d> footprints;
+  std::vector<BoxIndexPair> footprint_rtree_nodes;
+  footprints.reserve(current_center_line_path.points.size());
+  for (const auto & p : current_center_line_path.points) {
+    footprints.push_back(
+      transformVector(vehicle_footprint_, autoware::universe_utils::pose2transform(p.point.pose)));
+    footprint_rtree_nodes.emplace_back(
+      boost::geometry::return_envelope<Box2d>(footprints.back()), footprint_rtree_nodes.size());
+  }
+  const BoxRtree footprint_rtree(footprint_rtree_nodes.begin(), footprint_rtree_nodes.end());
+  std::vector<double> goal_arc_lengths;
+  goal_arc_lengths.reserve(goal_candidates.size());
+  for (const auto & goal_candidate : goal_candidates) {
+    goal_arc_lengths.push_back(
+      lanelet::utils::getArcCoordinates(current_lanes, goal_candidate.goal_pose).length);
+  }
+
   // count number of objects to avoid
-  for (const auto & object : objects.objects) {
-    for (const auto & p : current_center_line_path.points) {
-      const auto transformed_vehicle_footprint =
-        transformVector(vehicle_footprint_, autoware::universe_utils::pose2transform(p.point.pose));
-      const auto obj_polygon = autoware::universe_utils::toPolygon2d(object);
-      const double distance = boost::geometry::distance(obj_polygon, transformed_vehicle_footprint);
-      if (distance > parameters_.object_recognition_collision_check_hard_margins.back()) {
-        continue;
-      }
-      const Pose & object_pose = object.kinematics.initial_pose_with_covariance.pose;
-      const double s_object = lanelet::utils::getArcCoordinates(current_lanes, object_pose).length;
-      for (auto & goal_candidate : goal_candidates) {
-        const Pose & goal_pose = goal_candidate.goal_pose;
-        const double s_goal = lanelet::utils::getArcCoordinates(current_lanes, goal_pose).length;
-        if (s_object < s_goal) {
-          goal_candidate.num_objects_to_avoid++;
-        }
+  const double margin = parameters_.object_recognition_collision_check_hard_margins.back();
+  for (size_t i = 0; i < objects.objects.size(); ++i) {
+    // only the footprints close to the object can be within the margin
+    std::vector<BoxIndexPair> nearby_footprints;
+    footprint_rtree.query(
+      boost::geometry::index::intersects(expandBox(object_index.envelope(i), margin)),
+      std::back_inserter(nearby_footprints));
+    const bool is_close_to_path =
+      std::any_of(nearby_footprints.begin(), nearby_footprints.end(), [&](const auto & footprint) {
+        return boost::geometry::distance(
+                 object_index.polygon(i), footprints.at(footprint.second)) <= margin;
+      });
+    if (!is_close_to_path) {
+      continue;
+    }
+    const Pose & object_pose = objects.objects.at(i).kinematics.initial_pose_with_covariance.pose;
+    const double s_object = lanelet::utils::getArcCoordinates(current_lanes, object_pose).length;
+    for (size_t j = 0; j < goal_candidates.size(); ++j) {
+      if (s_object < goal_arc_lengths.at(j)) {
+        goal_candidates.at(j).num_objects_to_avoid++;
       }
-      break;
     }
   }
 }
@@ -324,8 +406,9 @@ void GoalSearcher::update(
   }
 
   const auto & refined_goal = refined_goal_opt.value();
+  const ObjectPolygonIndex object_index(objects);
   if (parameters_.prioritize_goals_before_objects) {
-    countObjectsToAvoid(goal_candidates, objects, planner_data, refined_goal);
+    countObjectsToAvoid(goal_candidates, objects, object_index, planner_data, refined_goal);
   }
 
   if (parameters_.goal_priority == "minimum_weighted_distance") {
@@ -340,21 +423,33 @@ void GoalSearcher::update(
       SortByLongitudinalDistance(parameters_.prioritize_goals_before_objects));
   }
 
+  // An object affecting the longitudinal margin check has a vertex laterally within the margin
+  // and a vertex longitudinally within the margin. Both are within the object size from each other,
+  // so the object is within this radius from the goal.
+  const double lateral_margin = parameters_.object_recognition_collision_check_hard_margins.back();
+  const double longitudinal_check_radius = std::hypot(
+    std::max(planner_data->parameters.base_link2front, planner_data->parameters.base_link2rear) +
+      parameters_.longitudinal_margin,
+    planner_data->parameters.vehicle_width / 2.0 + lateral_margin + object_index.maxObjectSize());
+
   // update is_safe
   for (auto & goal_candidate : goal_candidates) {
     const Pose goal_pose = goal_candidate.goal_pose;
 
     // check collision with footprint
-    if (checkCollision(goal_pose, objects, occupancy_grid_map)) {
+    if (checkCollision(goal_pose, object_index, occupancy_grid_map)) {
       goal_candidate.is_safe = false;
       continue;
     }
 
     // check longitudinal margin with pull over lane objects
     constexpr bool filter_inside = true;
+    const Point2d goal_point{goal_pose.position.x, goal_pose.position.y};
+    const auto nearby_objects = object_index.extract(
+      objects, expandBox(Box2d{goal_point, goal_point}, longitudinal_check_radius));
     const auto target_objects = goal_planner_utils::filterObjectsByLateralDistance(
-      goal_pose, planner_data->parameters.vehicle_width, objects,
-      parameters_.object_recognition_collision_check_hard_margins.back(), filter_inside);
+      goal_pose, planner_data->parameters.vehicle_width, nearby_objects, lateral_margin,
+      filter_inside);
     if (checkCollisionWithLongitudinalDistance(
           goal_pose, target_objects, occupancy_grid_map, planner_data)) {
       goal_candidate.is_safe = false;
@@ -399,7 +494,7 @@ bool GoalSearcher::isSafeGoalWithMarginScaleFactor(
 }
 
 bool GoalSearcher::checkCollision(
-  const Pose & pose, const PredictedObjects & objects,
+  const Pose & pose, const ObjectPolygonIndex & object_index,
   const std::shared_ptr<OccupancyGridBasedCollisionDetector> occupancy_grid_map) const
 {
   if (parameters_.use_occupancy_grid_for_goal_search) {
@@ -413,10 +508,15 @@ bool GoalSearcher::checkCollision(
   }
 
   if (parameters_.use_object_recognition) {
-    if (utils::checkCollisionBetweenFootprintAndObjects(
-          vehicle_footprint_, pose, objects,
-          parameters_.object_recognition_collision_check_hard_margins.back())) {
-      return true;
+    const double margin = parameters_.object_recognition_collision_check_hard_margins.back();
+    const auto footprint =
+      transformVector(vehicle_footprint_, autoware::universe_utils::pose2transform(pose));
+    // only the objects around the footprint can be within the margin
+    const auto footprint_box = boost::geometry::return_envelope<Box2d>(footprint);
+    for (const size_t index : object_index.query(expandBox(footprint_box, margin))) {
+      if (boost::geometry::distance(object_index.polygon(index), footprint) < margin) {
+        return true;
+      }
     }
   }
   return false;
@@ -0,0 +1,106 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_path_goal_planner_module/lane_parking_worker_pool.hpp"
+
+#include <exception>
+#include <mutex>
+#include <utility>
+
+namespace autoware::behavior_path_planner
+{
+
+LaneParkingWorkerPool::LaneParkingWorkerPool(const size_t worker_num)
+{
+  for (size_t worker_idx = 1; worker_idx < worker_num; ++worker_idx) {
+    threads_.emplace_back(&LaneParkingWorkerPool::workerLoop, this, worker_idx);
+  }
+}
+
+LaneParkingWorkerPool::~LaneParkingWorkerPool()
+{
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_cv_.notify_all();
+  for (auto & thread : threads_) {
+    thread.join();
+  }
+}
+
+void LaneParkingWorkerPool::run(const size_t task_num, const Task & task)
+{
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    task_num_ = task_num;
+    next_task_idx_ = 0;
+    exception_ = nullptr;
+    running_thread_num_ = threads_.size();
+    ++generation_;
+  }
+  start_cv_.notify_all();
+
+  runTasks(0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this]() { return running_thread_num_ == 0; });
+  task_ = nullptr;
+  if (exception_) {
+    std::rethrow_exception(std::exchange(exception_, nullptr));
+  }
+}
+
+void LaneParkingWorkerPool::workerLoop(const size_t worker_idx)
+{
+  uint64_t generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_cv_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+      if (stop_) {
+        return;
+      }
+      generation = generation_;
+    }
+
+    runTasks(worker_idx);
+
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      --running_thread_num_;
+    }
+    done_cv_.notify_one();
+  }
+}
+
+void LaneParkingWorkerPool::runTasks(const size_t worker_idx)
+{
+  for (size_t task_idx = next_task_idx_++; task_idx < task_num_; task_idx = next_task_idx_++) {
+    try {
+      (*task_)(worker_idx, task_idx);
+    } catch (...) {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (!exception_) {
+        exception_ = std::current_exception();
+      }
+      // the other workers do not start the remaining tasks
+      next_task_idx_ = task_num_;
+      return;
+    }
+  }
+}
+
+}  // namespace autoware::behavior_path_planner
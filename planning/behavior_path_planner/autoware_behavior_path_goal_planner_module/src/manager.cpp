@@ -150,6 +150,7 @@ GoalPlannerParameters GoalPlannerModuleManager::initGoalPlannerParameters(
       node->declare_parameter<std::vector<std::string>>(ns + "efficient_path_order");
     p.lane_departure_check_expansion_margin =
       node->declare_parameter<double>(ns + "lane_departure_check_expansion_margin");
+    p.lane_parking_thread_num = node->declare_parameter<int>(ns + "lane_parking_thread_num");
   }
 
   // shift parking
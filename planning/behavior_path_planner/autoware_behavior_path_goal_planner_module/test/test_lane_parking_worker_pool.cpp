@@ -0,0 +1,151 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/behavior_path_goal_planner_module/lane_parking_worker_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using autoware::behavior_path_planner::LaneParkingWorkerPool;
+
+namespace
+{
+// planner keeping the intermediate result as its member like GeometricPullOver, which must not be
+// shared among the workers
+class FakePlanner
+{
+public:
+  explicit FakePlanner(const size_t planner_type) : planner_type_(planner_type) {}
+
+  std::optional<double> plan(const size_t goal_id, const size_t path_id)
+  {
+    intermediate_.clear();
+    for (size_t i = 0; i <= goal_id % 17; ++i) {
+      intermediate_.push_back(static_cast<double>(goal_id * (planner_type_ + 1) + i));
+    }
+    if ((goal_id + planner_type_) % 5 == 0) {
+      return std::nullopt;
+    }
+    double sum = static_cast<double>(path_id);
+    for (const double value : intermediate_) {
+      sum += value;
+    }
+    return sum;
+  }
+
+private:
+  size_t planner_type_;
+  std::vector<double> intermediate_;
+};
+
+std::vector<FakePlanner> createPlanners()
+{
+  return {FakePlanner(0), FakePlanner(1), FakePlanner(2)};
+}
+
+// the pairs of (planner index, goal id) in the order of the priority
+std::vector<std::pair<size_t, size_t>> createPlanRequests(const size_t goal_num)
+{
+  std::vector<std::pair<size_t, size_t>> plan_requests;
+  for (size_t planner_idx = 0; planner_idx < 3; ++planner_idx) {
+    for (size_t goal_id = 0; goal_id < goal_num; ++goal_id) {
+      plan_requests.emplace_back(planner_idx, goal_id);
+    }
+  }
+  return plan_requests;
+}
+}  // namespace
+
+TEST(LaneParkingWorkerPool, parallelPlanSameAsSerialPlan)
+{
+  const auto plan_requests = createPlanRequests(200);
+
+  auto serial_planners = createPlanners();
+  std::vector<std::optional<double>> expected(plan_requests.size());
+  for (size_t i = 0; i < plan_requests.size(); ++i) {
+    const auto & [planner_idx, goal_id] = plan_requests.at(i);
+    expected.at(i) = serial_planners.at(planner_idx).plan(goal_id, i);
+  }
+
+  for (const size_t worker_num : {1lu, 2lu, 4lu, 8lu}) {
+    LaneParkingWorkerPool workers(worker_num);
+    ASSERT_EQ(workers.size(), worker_num);
+    std::vector<std::vector<FakePlanner>> worker_planners(worker_num, createPlanners());
+
+    // the workers are reused over the cycles
+    for (size_t cycle = 0; cycle < 10; ++cycle) {
+      std::vector<std::optional<double>> results(plan_requests.size());
+      std::vector<std::atomic<int>> call_counts(plan_requests.size());
+      workers.run(plan_requests.size(), [&](const size_t worker_idx, const size_t request_idx) {
+        const auto & [planner_idx, goal_id] = plan_requests.at(request_idx);
+        results.at(request_idx) =
+          worker_planners.at(worker_idx).at(planner_idx).plan(goal_id, request_idx);
+        ++call_counts.at(request_idx);
+      });
+
+      EXPECT_EQ(results, expected);
+      for (const auto & call_count : call_counts) {
+        EXPECT_EQ(call_count, 1);
+      }
+    }
+  }
+}
+
+TEST(LaneParkingWorkerPool, noTask)
+{
+  LaneParkingWorkerPool workers(4);
+  size_t call_count = 0;
+  workers.run(0, [&](const size_t, const size_t) { ++call_count; });
+  EXPECT_EQ(call_count, 0u);
+}
+
+TEST(LaneParkingWorkerPool, singleWorkerRunsOnCallerThread)
+{
+  LaneParkingWorkerPool workers(1);
+  const auto caller_id = std::this_thread::get_id();
+  std::vector<size_t> task_indices;
+  workers.run(5, [&](const size_t worker_idx, const size_t task_idx) {
+    EXPECT_EQ(worker_idx, 0u);
+    EXPECT_EQ(std::this_thread::get_id(), caller_id);
+    task_indices.push_back(task_idx);
+  });
+  EXPECT_EQ(task_indices, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(LaneParkingWorkerPool, exceptionIsRethrownOnCaller)
+{
+  LaneParkingWorkerPool workers(4);
+  for (const size_t throwing_task_idx : {0lu, 37lu, 99lu}) {
+    EXPECT_THROW(
+      workers.run(
+        100,
+        [&](const size_t, const size_t task_idx) {
+          if (task_idx == throwing_task_idx) {
+            throw std::runtime_error("plan failed");
+          }
+        }),
+      std::runtime_error);
+  }
+
+  // the workers are still available after the exception
+  std::atomic<size_t> call_count{0};
+  workers.run(100, [&](const size_t, const size_t) { ++call_count; });
+  EXPECT_EQ(call_count, 100u);
+}
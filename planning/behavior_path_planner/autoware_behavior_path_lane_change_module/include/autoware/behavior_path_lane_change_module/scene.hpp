@@ -149,7 +149,8 @@ protected:
     const Pose & lc_start_pose, const double shift_length) const;
 
   bool check_candidate_path_safety(
-    const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects) const;
+    const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects,
+    CollisionCheckDebugMap & debug_data) const;
 
   std::optional<LaneChangePath> calcTerminalLaneChangePath(
     const lanelet::ConstLanelets & current_lanes,
@@ -163,6 +164,16 @@ protected:
     const utils::path_safety_checker::RSSparams & rss_params,
     const size_t deceleration_sampling_num, CollisionCheckDebugMap & debug_data) const;
 
+  /**
+   * @brief Same as isLaneChangePathSafe but without the time tracking, so that it can be called
+   * from the threads checking the candidate paths in parallel.
+   */
+  PathSafetyStatus evaluate_lane_change_path_safety(
+    const LaneChangePath & lane_change_path,
+    const lane_change::TargetObjects & collision_check_objects,
+    const utils::path_safety_checker::RSSparams & rss_params,
+    const size_t deceleration_sampling_num, CollisionCheckDebugMap & debug_data) const;
+
   bool has_collision_with_decel_patterns(
     const LaneChangePath & lane_change_path, const ExtendedPredictedObjects & objects,
     const size_t deceleration_sampling_num, const RSSparams & rss_param,
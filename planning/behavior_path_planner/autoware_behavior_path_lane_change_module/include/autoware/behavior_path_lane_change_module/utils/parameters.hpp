@@ -126,6 +126,7 @@ struct TrajectoryParameters
   double lane_changing_decel_factor{0.5};
   int lon_acc_sampling_num{10};
   int lat_acc_sampling_num{10};
+  int candidate_path_thread_num{1};
   LateralAccelerationMap lat_acc_map{};
 };
 
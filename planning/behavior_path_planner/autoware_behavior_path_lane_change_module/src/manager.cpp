@@ -67,6 +67,8 @@ LCParamPtr LaneChangeModuleManager::set_params(rclcpp::Node * node, const std::s
       getOrDeclareParameter<int>(*node, parameter("trajectory.lon_acc_sampling_num"));
     p.trajectory.lat_acc_sampling_num =
       getOrDeclareParameter<int>(*node, parameter("trajectory.lat_acc_sampling_num"));
+    p.trajectory.candidate_path_thread_num =
+      getOrDeclareParameter<int>(*node, parameter("trajectory.candidate_path_thread_num"));
 
     const auto max_acc = getOrDeclareParameter<double>(*node, "normal.max_acc");
     p.trajectory.min_lane_changing_velocity = std::min(
@@ -42,6 +42,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -1226,6 +1227,68 @@ bool NormalLaneChange::get_lane_change_paths(LaneChangePaths & candidate_paths)
       return lc_diff > lane_change_parameters_->trajectory.th_lane_changing_length_diff;
     };
 
+  // NOTE: the candidate paths are generated in the order of the priority, and the safety of the
+  // stored ones is checked in parallel every time thread_num paths are stored. The first safe path
+  // in the order is selected, same as checking them one by one.
+  const auto thread_num =
+    static_cast<size_t>(std::max(lane_change_parameters_->trajectory.candidate_path_thread_num, 1));
+  size_t num_checked_paths = 0;
+  const auto check_pending_paths_safety = [&]() -> std::optional<bool> {
+    const auto begin_idx = num_checked_paths;
+    const auto num_pending_paths = candidate_paths.size() - begin_idx;
+    num_checked_paths = candidate_paths.size();
+    if (num_pending_paths == 0) {
+      return std::nullopt;
+    }
+
+    struct SafetyCheckResult
+    {
+      bool is_safe{false};
+      std::optional<std::string> error{std::nullopt};
+      CollisionCheckDebugMap debug_data{};
+    };
+    std::vector<SafetyCheckResult> results(num_pending_paths);
+
+#pragma omp parallel for num_threads(thread_num)
+    for (size_t i = 0; i < num_pending_paths; ++i) {
+      try {
+        results.at(i).is_safe = check_candidate_path_safety(
+          candidate_paths.at(begin_idx + i), target_objects, results.at(i).debug_data);
+      } catch (const std::exception & e) {
+        results.at(i).error = e.what();
+      }
+    }
+
+    for (size_t i = 0; i < num_pending_paths; ++i) {
+      for (const auto & [uuid, debug] : results.at(i).debug_data) {
+        lane_change_debug_.collision_check_objects.insert_or_assign(uuid, debug);
+      }
+
+      const auto & info = candidate_paths.at(begin_idx + i).info;
+      const auto debug_print_lat = [&](const std::string & s) {
+        RCLCPP_DEBUG(
+          logger_, "%s | lc_time: %.5f | lon_acc: %.5f | lat_acc: %.5f | lc_len: %.5f", s.c_str(),
+          info.duration.lane_changing, info.longitudinal_acceleration.lane_changing,
+          info.lateral_acceleration, info.length.lane_changing);
+      };
+
+      if (results.at(i).error) {
+        debug_print_lat("Reject: " + *results.at(i).error);
+        candidate_paths.resize(begin_idx + i + 1);
+        return false;
+      }
+
+      if (results.at(i).is_safe) {
+        debug_print_lat("ACCEPT!!!: it is valid and safe!");
+        candidate_paths.resize(begin_idx + i + 1);
+        return true;
+      }
+
+      debug_print_lat("Reject: sampled path is not safe.");
+    }
+    return std::nullopt;
+  };
+
   for (const auto & prep_metric : prepare_phase_metrics) {
     const auto debug_print = [&](const std::string & s) {
       RCLCPP_DEBUG(
@@ -1285,8 +1348,19 @@ bool NormalLaneChange::get_lane_change_paths(LaneChangePaths & candidate_paths)
 
       candidate_paths.push_back(candidate_path);
 
+      if (thread_num > 1) {
+        if (candidate_paths.size() - num_checked_paths < thread_num) {
+          continue;
+        }
+        if (const auto found_safe_path = check_pending_paths_safety()) {
+          return *found_safe_path;
+        }
+        continue;
+      }
+
       try {
-        if (check_candidate_path_safety(candidate_path, target_objects)) {
+        if (check_candidate_path_safety(
+              candidate_path, target_objects, lane_change_debug_.collision_check_objects)) {
           debug_print_lat("ACCEPT!!!: it is valid and safe!");
           return true;
         }
@@ -1299,6 +1373,10 @@ bool NormalLaneChange::get_lane_change_paths(LaneChangePaths & candidate_paths)
     }
   }
 
+  if (const auto found_safe_path = check_pending_paths_safety()) {
+    return *found_safe_path;
+  }
+
   RCLCPP_DEBUG(logger_, "No safety path found.");
   return false;
 }
@@ -1350,7 +1428,8 @@ LaneChangePath NormalLaneChange::get_candidate_path(
 }
 
 bool NormalLaneChange::check_candidate_path_safety(
-  const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects) const
+  const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects,
+  CollisionCheckDebugMap & debug_data) const
 {
   const auto is_stuck = common_data_ptr_->transient_data.is_ego_stuck;
   if (utils::lane_change::has_overtaking_turn_lane_object(
@@ -1361,7 +1440,7 @@ bool NormalLaneChange::check_candidate_path_safety(
   if (
     !is_stuck && utils::lane_change::is_delay_lane_change(
                    common_data_ptr_, candidate_path, filtered_objects_.target_lane_leading.stopped,
-                   lane_change_debug_.collision_check_objects)) {
+                   debug_data)) {
     throw std::logic_error(
       "Ego is not stuck and parked vehicle exists in the target lane. Skip lane change.");
   }
@@ -1379,14 +1458,14 @@ bool NormalLaneChange::check_candidate_path_safety(
   }
 
   constexpr size_t decel_sampling_num = 1;
-  const auto safety_check_with_normal_rss = isLaneChangePathSafe(
+  const auto safety_check_with_normal_rss = evaluate_lane_change_path_safety(
     candidate_path, target_objects, common_data_ptr_->lc_param_ptr->safety.rss_params,
-    decel_sampling_num, lane_change_debug_.collision_check_objects);
+    decel_sampling_num, debug_data);
 
   if (!safety_check_with_normal_rss.is_safe && is_stuck) {
-    const auto safety_check_with_stuck_rss = isLaneChangePathSafe(
+    const auto safety_check_with_stuck_rss = evaluate_lane_change_path_safety(
       candidate_path, target_objects, common_data_ptr_->lc_param_ptr->safety.rss_params_for_stuck,
-      decel_sampling_num, lane_change_debug_.collision_check_objects);
+      decel_sampling_num, debug_data);
     return safety_check_with_stuck_rss.is_safe;
   }
 
@@ -1785,6 +1864,16 @@ PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
   CollisionCheckDebugMap & debug_data) const
 {
   universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  return evaluate_lane_change_path_safety(
+    lane_change_path, collision_check_objects, rss_params, deceleration_sampling_num, debug_data);
+}
+
+PathSafetyStatus NormalLaneChange::evaluate_lane_change_path_safety(
+  const LaneChangePath & lane_change_path,
+  const lane_change::TargetObjects & collision_check_objects,
+  const utils::path_safety_checker::RSSparams & rss_params, const size_t deceleration_sampling_num,
+  CollisionCheckDebugMap & debug_data) const
+{
   constexpr auto is_safe = true;
   constexpr auto is_object_behind_ego = true;
 
@@ -1943,7 +2032,6 @@ bool NormalLaneChange::is_collided(
 
 double NormalLaneChange::get_max_velocity_for_safety_check() const
 {
-  universe_utils::ScopedTimeTrack st(__func__, *time_keeper_);
   const auto external_velocity_limit_ptr = planner_data_->external_limit_max_velocity;
   if (external_velocity_limit_ptr) {
     return std::min(
@@ -28,6 +28,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 
 using autoware::behavior_path_planner::FilteredLanesObjects;
 using autoware::behavior_path_planner::LaneChangeModuleManager;
@@ -271,3 +272,63 @@ TEST_F(TestNormalLaneChange, testGetPathWhenValid)
 
   ASSERT_TRUE(lc_status.is_valid_path);
 }
+
+TEST_F(TestNormalLaneChange, testGetPathWithParallelSafetyCheck)
+{
+  using autoware::behavior_path_planner::LaneChangePath;
+
+  constexpr auto is_approved = true;
+  ego_pose_ = autoware::test_utils::createPose(1.0, 1.75, 0.0, 0.0, 0.0, 0.0);
+  planner_data_->self_odometry = set_odometry(ego_pose_);
+
+  const auto get_path = [&](const int thread_num) {
+    lc_param_ptr_->trajectory.candidate_path_thread_num = thread_num;
+    init_module();
+    normal_lane_change_->update_lanes(!is_approved);
+    normal_lane_change_->update_filtered_objects();
+    normal_lane_change_->update_transient_data(!is_approved);
+    normal_lane_change_->updateLaneChangeStatus();
+    return std::make_pair(
+      normal_lane_change_->getLaneChangeStatus(), normal_lane_change_->getDebugData());
+  };
+  const auto expect_same_path = [](const LaneChangePath & path, const LaneChangePath & expected) {
+    EXPECT_DOUBLE_EQ(path.info.length.prepare, expected.info.length.prepare);
+    EXPECT_DOUBLE_EQ(path.info.length.lane_changing, expected.info.length.lane_changing);
+    EXPECT_DOUBLE_EQ(
+      path.info.longitudinal_acceleration.lane_changing,
+      expected.info.longitudinal_acceleration.lane_changing);
+    ASSERT_EQ(path.path.points.size(), expected.path.points.size());
+    for (size_t i = 0; i < expected.path.points.size(); ++i) {
+      const auto & p = path.path.points.at(i).point;
+      const auto & expected_p = expected.path.points.at(i).point;
+      EXPECT_DOUBLE_EQ(p.pose.position.x, expected_p.pose.position.x);
+      EXPECT_DOUBLE_EQ(p.pose.position.y, expected_p.pose.position.y);
+      EXPECT_FLOAT_EQ(p.longitudinal_velocity_mps, expected_p.longitudinal_velocity_mps);
+    }
+  };
+
+  // the candidates checked one by one
+  const auto [serial_status, serial_debug] = get_path(1);
+  ASSERT_TRUE(serial_status.is_valid_path);
+  ASSERT_FALSE(serial_debug.valid_paths.empty());
+
+  // the candidates checked in batches, including batches larger than the number of candidates
+  for (const int thread_num : {2, 3, 4, 64}) {
+    const auto [status, debug] = get_path(thread_num);
+    EXPECT_EQ(status.is_valid_path, serial_status.is_valid_path);
+    EXPECT_EQ(status.is_safe, serial_status.is_safe);
+    expect_same_path(status.lane_change_path, serial_status.lane_change_path);
+
+    ASSERT_EQ(debug.valid_paths.size(), serial_debug.valid_paths.size());
+    for (size_t i = 0; i < serial_debug.valid_paths.size(); ++i) {
+      expect_same_path(debug.valid_paths.at(i), serial_debug.valid_paths.at(i));
+    }
+
+    ASSERT_EQ(debug.collision_check_objects.size(), serial_debug.collision_check_objects.size());
+    for (const auto & [uuid, expected_debug] : serial_debug.collision_check_objects) {
+      const auto itr = debug.collision_check_objects.find(uuid);
+      ASSERT_NE(itr, debug.collision_check_objects.end());
+      EXPECT_EQ(itr->second.is_safe, expected_debug.is_safe);
+    }
+  }
+}
@@ -16,8 +16,11 @@
 #define AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__DRIVABLE_AREA_EXPANSION__STATIC_DRIVABLE_AREA_HPP_  // NOLINT
 
 #include <autoware/behavior_path_planner_common/utils/utils.hpp>
+#include <autoware/universe_utils/system/lru_cache.hpp>
 
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -127,6 +130,76 @@ std::vector<lanelet::ConstPoint3d> getBoundWithIntersectionAreas(
   const std::shared_ptr<RouteHandler> & route_handler,
   const std::vector<DrivableLanes> & drivable_lanes, const bool is_left);
 
+/**
+ * @brief Key of the drivable bound expanded by the map polygons. The bound only depends on the map,
+ * the edge lanelets and their bound points, so it can be reused while the ego vehicle drives on the
+ * same lanes.
+ */
+struct ExpandedBoundKey
+{
+  std::weak_ptr<const lanelet::LaneletMap> lanelet_map;
+  bool is_left{false};
+  bool enable_expanding_hatched_road_markings{false};
+  bool enable_expanding_intersection_areas{false};
+  std::vector<lanelet::Id> lane_ids{};
+  std::vector<lanelet::Id> point_ids{};
+  std::vector<double> point_coordinates{};
+
+  size_t hash() const;
+
+  /**
+   * @brief check if the other key describes the same expanded bound
+   * @details an expired map never matches since a new map may be allocated at the same address
+   */
+  bool matches(const ExpandedBoundKey & other) const;
+};
+
+/**
+ * @brief create the key of the bound of the given drivable lanes expanded by the map polygons
+ * @param [in] lanelet_map map containing the drivable lanes
+ * @param [in] drivable_lanes lanelets whose left/right edge lanes make the bound
+ * @param [in] bound_points points of the bound before the expansion
+ * @param [in] enable_expanding_hatched_road_markings if true, the bound is expanded into hatched
+ * road markings
+ * @param [in] enable_expanding_intersection_areas if true, the bound is expanded into intersection
+ * areas
+ * @param [in] is_left whether the bound is on the left or not
+ * @return the key of the expanded bound
+ */
+ExpandedBoundKey createExpandedBoundKey(
+  const lanelet::LaneletMapConstPtr & lanelet_map,
+  const std::vector<DrivableLanes> & drivable_lanes,
+  const std::vector<lanelet::ConstPoint3d> & bound_points,
+  const bool enable_expanding_hatched_road_markings, const bool enable_expanding_intersection_areas,
+  const bool is_left);
+
+/**
+ * @brief Cache of the expanded drivable bounds shared by all the scene modules. Only the ego
+ * dependent cropping is done every planning cycle while the drivable lanes stay the same.
+ */
+class ExpandedBoundCache
+{
+public:
+  using Bound = std::vector<geometry_msgs::msg::Point>;
+
+  std::optional<Bound> get(const ExpandedBoundKey & key);
+
+  void put(const ExpandedBoundKey & key, const Bound & bound);
+
+private:
+  // NOTE: the bounds of the left/right side of several modules are generated every cycle
+  static constexpr size_t cache_size = 32;
+
+  std::mutex mutex_;
+  autoware::universe_utils::LRUCache<size_t, std::pair<ExpandedBoundKey, Bound>> cache_{
+    cache_size};
+};
+
+/**
+ * @brief get the cache of the expanded drivable bounds used by calcBound()
+ */
+ExpandedBoundCache & getExpandedBoundCache();
+
 std::vector<geometry_msgs::msg::Point> calcBound(
   const PathWithLaneId & path, const std::shared_ptr<const PlannerData> planner_data,
   const std::vector<DrivableLanes> & drivable_lanes,
@@ -27,6 +27,7 @@
 #include <geometry_msgs/msg/twist.hpp>
 
 #include <cmath>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -119,6 +120,16 @@ double calc_minimum_longitudinal_length(
 std::optional<PoseWithVelocityStamped> calc_interpolated_pose_with_velocity(
   const std::vector<PoseWithVelocityStamped> & path, const double relative_time);
 
+/**
+ * @brief Calculates interpolated poses with velocity for the given relative times along a path.
+ *        The path is scanned only once if the relative times are sorted in ascending order.
+ * @param path A vector of PoseWithVelocityStamped objects representing the path.
+ * @param relative_times The relative times at which to calculate the interpolated poses.
+ * @return The result of calc_interpolated_pose_with_velocity for each of the relative times.
+ */
+std::vector<std::optional<PoseWithVelocityStamped>> calc_interpolated_poses_with_velocity(
+  const std::vector<PoseWithVelocityStamped> & path, const std::vector<double> & relative_times);
+
 std::optional<PoseWithVelocityAndPolygonStamped>
 get_interpolated_pose_with_velocity_and_polygon_stamped(
   const std::vector<PoseWithVelocityStamped> & pred_path, const double current_time,
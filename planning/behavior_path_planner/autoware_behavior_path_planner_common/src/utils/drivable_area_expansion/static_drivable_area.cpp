@@ -23,6 +23,7 @@
 #include <autoware_lanelet2_extension/utility/query.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
 
+#include <boost/functional/hash.hpp>
 #include <boost/geometry/algorithms/is_valid.hpp>
 
 #include <lanelet2_core/geometry/Point.h>
@@ -32,6 +33,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
@@ -239,6 +241,7 @@ std::vector<lanelet::ConstPoint3d> extractBoundFromPolygon(
 
   return ret;
 }
+
 }  // namespace
 
 namespace autoware::behavior_path_planner::utils::drivable_area_processing
@@ -1619,6 +1622,76 @@ std::vector<geometry_msgs::msg::Point> postProcess(
   return removeSharpPoints(processed_bound);
 }
 
+size_t ExpandedBoundKey::hash() const
+{
+  size_t seed = 0;
+  boost::hash_combine(seed, is_left);
+  boost::hash_combine(seed, enable_expanding_hatched_road_markings);
+  boost::hash_combine(seed, enable_expanding_intersection_areas);
+  boost::hash_range(seed, lane_ids.begin(), lane_ids.end());
+  boost::hash_range(seed, point_ids.begin(), point_ids.end());
+  boost::hash_range(seed, point_coordinates.begin(), point_coordinates.end());
+  return seed;
+}
+
+bool ExpandedBoundKey::matches(const ExpandedBoundKey & other) const
+{
+  const auto map = lanelet_map.lock();
+  return map && map == other.lanelet_map.lock() && is_left == other.is_left &&
+         enable_expanding_hatched_road_markings == other.enable_expanding_hatched_road_markings &&
+         enable_expanding_intersection_areas == other.enable_expanding_intersection_areas &&
+         lane_ids == other.lane_ids && point_ids == other.point_ids &&
+         point_coordinates == other.point_coordinates;
+}
+
+ExpandedBoundKey createExpandedBoundKey(
+  const lanelet::LaneletMapConstPtr & lanelet_map,
+  const std::vector<DrivableLanes> & drivable_lanes,
+  const std::vector<lanelet::ConstPoint3d> & bound_points,
+  const bool enable_expanding_hatched_road_markings, const bool enable_expanding_intersection_areas,
+  const bool is_left)
+{
+  ExpandedBoundKey key;
+  key.lanelet_map = lanelet_map;
+  key.is_left = is_left;
+  key.enable_expanding_hatched_road_markings = enable_expanding_hatched_road_markings;
+  key.enable_expanding_intersection_areas = enable_expanding_intersection_areas;
+  key.lane_ids.reserve(drivable_lanes.size());
+  for (const auto & drivable_lane : drivable_lanes) {
+    key.lane_ids.push_back(is_left ? drivable_lane.left_lane.id() : drivable_lane.right_lane.id());
+  }
+  key.point_ids.reserve(bound_points.size());
+  key.point_coordinates.reserve(bound_points.size() * 2);
+  for (const auto & point : bound_points) {
+    key.point_ids.push_back(point.id());
+    key.point_coordinates.push_back(point.x());
+    key.point_coordinates.push_back(point.y());
+  }
+  return key;
+}
+
+std::optional<ExpandedBoundCache::Bound> ExpandedBoundCache::get(const ExpandedBoundKey & key)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto entry = cache_.get(key.hash());
+  if (!entry || !entry->first.matches(key)) {
+    return std::nullopt;
+  }
+  return entry->second;
+}
+
+void ExpandedBoundCache::put(const ExpandedBoundKey & key, const Bound & bound)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  cache_.put(key.hash(), std::make_pair(key, bound));
+}
+
+ExpandedBoundCache & getExpandedBoundCache()
+{
+  static ExpandedBoundCache cache;
+  return cache;
+}
+
 // calculate bounds from drivable lanes and hatched road markings
 std::vector<geometry_msgs::msg::Point> calcBound(
   const PathWithLaneId & path, const std::shared_ptr<const PlannerData> planner_data,
@@ -1657,15 +1730,29 @@ std::vector<geometry_msgs::msg::Point> calcBound(
     return ret;
   };
 
-  // Step1. create drivable bound from drivable lanes.
-  auto [bound_points, skip_post_process] = [&]() {
-    if (!enable_expanding_freespace_areas) {
-      return std::make_pair(convert_to_points(drivable_lanes, is_left), false);
+  const auto expand_bound = [&](auto bound_points) {
+    // Step2. if there is no drivable area defined by polygon, return original drivable bound.
+    if (!enable_expanding_hatched_road_markings && !enable_expanding_intersection_areas) {
+      return removeOverlapPoints(to_ros_point(bound_points));
     }
-    return getBoundWithFreeSpaceAreas(
-      convert_to_points(drivable_lanes, is_left), convert_to_points(drivable_lanes, !is_left),
-      planner_data, is_left);
-  }();
+
+    // Step3.if there are hatched road markings, expand drivable bound with the polygon.
+    if (enable_expanding_hatched_road_markings) {
+      bound_points = getBoundWithHatchedRoadMarkings(bound_points, route_handler);
+    }
+
+    if (!enable_expanding_intersection_areas) {
+      return removeOverlapPoints(to_ros_point(bound_points));
+    }
+
+    // Step4. if there are intersection areas, expand drivable bound with the polygon.
+    {
+      bound_points =
+        getBoundWithIntersectionAreas(bound_points, route_handler, drivable_lanes, is_left);
+    }
+
+    return removeOverlapPoints(to_ros_point(bound_points));
+  };
 
   const auto post_process = [&](const auto & bound, const auto skip) {
     return skip
@@ -1673,27 +1760,37 @@ std::vector<geometry_msgs::msg::Point> calcBound(
              : postProcess(bound, path, planner_data, drivable_lanes, is_left, is_driving_forward);
   };
 
-  // Step2. if there is no drivable area defined by polygon, return original drivable bound.
-  if (!enable_expanding_hatched_road_markings && !enable_expanding_intersection_areas) {
-    return post_process(removeOverlapPoints(to_ros_point(bound_points)), skip_post_process);
+  // Step1. create drivable bound from drivable lanes.
+  // NOTE: the expansion by the freespace areas depends on the ego pose, so it is not cached.
+  if (enable_expanding_freespace_areas) {
+    const auto [bound_points, skip_post_process] = getBoundWithFreeSpaceAreas(
+      convert_to_points(drivable_lanes, is_left), convert_to_points(drivable_lanes, !is_left),
+      planner_data, is_left);
+    return post_process(expand_bound(bound_points), skip_post_process);
   }
 
-  // Step3.if there are hatched road markings, expand drivable bound with the polygon.
-  if (enable_expanding_hatched_road_markings) {
-    bound_points = getBoundWithHatchedRoadMarkings(bound_points, route_handler);
-  }
+  const auto bound_points = convert_to_points(drivable_lanes, is_left);
 
-  if (!enable_expanding_intersection_areas) {
-    return post_process(removeOverlapPoints(to_ros_point(bound_points)), skip_post_process);
+  // NOTE: without the expansion by the map polygons, the bound is only made of the lane bounds, so
+  // there is nothing worth caching.
+  if (!enable_expanding_hatched_road_markings && !enable_expanding_intersection_areas) {
+    return post_process(expand_bound(bound_points), false);
   }
 
-  // Step4. if there are intersection areas, expand drivable bound with the polygon.
-  {
-    bound_points =
-      getBoundWithIntersectionAreas(bound_points, route_handler, drivable_lanes, is_left);
+  const auto key = createExpandedBoundKey(
+    route_handler->getLaneletMapPtr(), drivable_lanes, bound_points,
+    enable_expanding_hatched_road_markings, enable_expanding_intersection_areas, is_left);
+
+  // reuse the expanded bound while the drivable lanes are unchanged, and only crop it around the
+  // ego vehicle and the goal.
+  auto & cache = getExpandedBoundCache();
+  if (const auto cached_bound = cache.get(key)) {
+    return post_process(*cached_bound, false);
   }
 
-  return post_process(removeOverlapPoints(to_ros_point(bound_points)), skip_post_process);
+  const auto expanded_bound = expand_bound(bound_points);
+  cache.put(key, expanded_bound);
+  return post_process(expanded_bound, false);
 }
 
 std::vector<DrivableLanes> combineDrivableLanes(
@@ -21,6 +21,8 @@
 #include "autoware/universe_utils/ros/uuid_helper.hpp"
 
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/intersects.hpp>
 #include <boost/geometry/algorithms/overlaps.hpp>
 #include <boost/geometry/algorithms/union.hpp>
@@ -31,6 +33,7 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -44,6 +47,7 @@ using autoware::motion_utils::calcLongitudinalOffsetPoint;
 using autoware::motion_utils::calcLongitudinalOffsetToSegment;
 using autoware::motion_utils::findNearestIndex;
 using autoware::motion_utils::findNearestSegmentIndex;
+using autoware::universe_utils::Box2d;
 using autoware::universe_utils::calcDistance2d;
 
 void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point)
@@ -328,16 +332,19 @@ double calc_minimum_longitudinal_length(
   return rss_params.longitudinal_velocity_delta_time * std::abs(max_vel) + lon_threshold;
 }
 
-std::optional<PoseWithVelocityStamped> calc_interpolated_pose_with_velocity(
-  const std::vector<PoseWithVelocityStamped> & path, const double relative_time)
+namespace
+{
+/**
+ * @brief Interpolate the path at the relative time searching the segment from start_idx.
+ * @return the interpolated pose and the index of the end point of the found segment, which is the
+ * size of the path if not found.
+ */
+std::pair<std::optional<PoseWithVelocityStamped>, size_t> interpolate_pose_with_velocity(
+  const std::vector<PoseWithVelocityStamped> & path, const double relative_time,
+  const size_t start_idx)
 {
-  // Check if relative time is in the valid range
-  if (path.empty() || relative_time < 0.0) {
-    return std::nullopt;
-  }
-
   constexpr double epsilon = 1e-6;
-  for (size_t path_idx = 1; path_idx < path.size(); ++path_idx) {
+  for (size_t path_idx = std::max<size_t>(start_idx, 1); path_idx < path.size(); ++path_idx) {
     const auto & pt = path.at(path_idx);
     const auto & prev_pt = path.at(path_idx - 1);
     if (relative_time < pt.time + epsilon) {
@@ -348,11 +355,71 @@ std::optional<PoseWithVelocityStamped> calc_interpolated_pose_with_velocity(
         autoware::universe_utils::calcInterpolatedPose(prev_pt.pose, pt.pose, ratio, false);
       const double interpolated_velocity =
         autoware::interpolation::lerp(prev_pt.velocity, pt.velocity, ratio);
-      return PoseWithVelocityStamped{relative_time, interpolated_pose, interpolated_velocity};
+      return std::make_pair(
+        PoseWithVelocityStamped{relative_time, interpolated_pose, interpolated_velocity}, path_idx);
     }
   }
 
-  return std::nullopt;
+  return std::make_pair(std::nullopt, path.size());
+}
+
+// NOTE: the polygons never intersect if their envelopes do not, and the envelope check is much
+// cheaper than boost::geometry::intersects.
+bool intersects_with_envelope_check(
+  const Polygon2d & polygon, const Box2d & envelope, const Polygon2d & other_polygon,
+  const Box2d & other_envelope)
+{
+  if (bg::disjoint(envelope, other_envelope)) {
+    return false;
+  }
+  return bg::intersects(polygon, other_polygon);
+}
+
+bool intersects_with_envelope_check(const Polygon2d & polygon, const Polygon2d & other_polygon)
+{
+  return intersects_with_envelope_check(
+    polygon, bg::return_envelope<Box2d>(polygon), other_polygon,
+    bg::return_envelope<Box2d>(other_polygon));
+}
+}  // namespace
+
+std::optional<PoseWithVelocityStamped> calc_interpolated_pose_with_velocity(
+  const std::vector<PoseWithVelocityStamped> & path, const double relative_time)
+{
+  // Check if relative time is in the valid range
+  if (path.empty() || relative_time < 0.0) {
+    return std::nullopt;
+  }
+
+  return interpolate_pose_with_velocity(path, relative_time, 1).first;
+}
+
+std::vector<std::optional<PoseWithVelocityStamped>> calc_interpolated_poses_with_velocity(
+  const std::vector<PoseWithVelocityStamped> & path, const std::vector<double> & relative_times)
+{
+  std::vector<std::optional<PoseWithVelocityStamped>> interpolated_poses;
+  interpolated_poses.reserve(relative_times.size());
+
+  // the segments before the one found for the previous time are skipped while the time increases
+  size_t start_idx = 1;
+  double prev_relative_time = 0.0;
+  for (const auto relative_time : relative_times) {
+    if (path.empty() || relative_time < 0.0) {
+      interpolated_poses.push_back(std::nullopt);
+      continue;
+    }
+    if (relative_time < prev_relative_time) {
+      start_idx = 1;
+    }
+    prev_relative_time = relative_time;
+
+    auto [interpolated_pose, segment_end_idx] =
+      interpolate_pose_with_velocity(path, relative_time, start_idx);
+    interpolated_poses.push_back(std::move(interpolated_pose));
+    start_idx = segment_end_idx;
+  }
+
+  return interpolated_poses;
 }
 
 std::optional<PoseWithVelocityAndPolygonStamped>
@@ -547,11 +614,14 @@ bool checkSafetyWithIntegralPredictedPolygon(
   }
 
   // check collision
+  const auto ego_integral_envelope = bg::return_envelope<Box2d>(ego_integral_polygon);
   for (const auto & object : filtered_path_objects) {
     CollisionCheckDebugPair debug_pair = createObjectDebug(object);
     for (const auto & path : object.predicted_paths) {
       for (const auto & pose_with_poly : path.path) {
-        if (boost::geometry::intersects(ego_integral_polygon, pose_with_poly.poly)) {
+        if (intersects_with_envelope_check(
+              ego_integral_polygon, ego_integral_envelope, pose_with_poly.poly,
+              bg::return_envelope<Box2d>(pose_with_poly.poly))) {
           debug_pair.second.ego_predicted_path = ego_predicted_path;  // raw path
           debug_pair.second.obj_predicted_path = path.path;           // raw path
           debug_pair.second.extended_obj_polygon = pose_with_poly.poly;
@@ -596,10 +666,19 @@ std::vector<Polygon2d> get_collided_polygons(
     debug.current_obj_pose = target_object.initial_pose;
   }
 
+  // interpolate the ego path at all the time steps of the object path at once
+  std::vector<double> object_path_times{};
+  object_path_times.reserve(target_object_path.path.size());
+  for (const auto & obj_pose_with_poly : target_object_path.path) {
+    object_path_times.push_back(obj_pose_with_poly.time);
+  }
+  const auto interpolated_ego_path =
+    calc_interpolated_poses_with_velocity(predicted_ego_path, object_path_times);
+
   std::vector<Polygon2d> collided_polygons{};
   collided_polygons.reserve(target_object_path.path.size());
-  for (const auto & obj_pose_with_poly : target_object_path.path) {
-    const auto & current_time = obj_pose_with_poly.time;
+  for (size_t i = 0; i < target_object_path.path.size(); ++i) {
+    const auto & obj_pose_with_poly = target_object_path.path.at(i);
 
     // get object information at current time
     const auto & obj_pose = obj_pose_with_poly.pose;
@@ -607,16 +686,12 @@ std::vector<Polygon2d> get_collided_polygons(
     const auto object_velocity = obj_pose_with_poly.velocity;
 
     // get ego information at current time
-    // Note: we can create these polygons in advance. However, it can decrease the readability and
-    // variability
     const auto & ego_vehicle_info = vehicle_info;
-    const auto interpolated_data = get_interpolated_pose_with_velocity_and_polygon_stamped(
-      predicted_ego_path, current_time, ego_vehicle_info);
+    const auto & interpolated_data = interpolated_ego_path.at(i);
     if (!interpolated_data) {
       continue;
     }
     const auto & ego_pose = interpolated_data->pose;
-    const auto & ego_polygon = interpolated_data->poly;
     const auto ego_velocity = std::min(interpolated_data->velocity, max_velocity_limit);
 
     const double ego_yaw = tf2::getYaw(ego_pose.orientation);
@@ -624,8 +699,14 @@ std::vector<Polygon2d> get_collided_polygons(
     const double yaw_difference = autoware::universe_utils::normalizeRadian(ego_yaw - object_yaw);
     if (std::abs(yaw_difference) > yaw_difference_th) continue;
 
+    const auto ego_polygon = autoware::universe_utils::toFootprint(
+      ego_pose, ego_vehicle_info.max_longitudinal_offset_m, ego_vehicle_info.rear_overhang_m,
+      ego_vehicle_info.vehicle_width_m);
+    const auto obj_envelope = bg::return_envelope<Box2d>(obj_polygon);
+
     // check intersects
-    if (boost::geometry::intersects(ego_polygon, obj_polygon)) {
+    if (intersects_with_envelope_check(
+          ego_polygon, bg::return_envelope<Box2d>(ego_polygon), obj_polygon, obj_envelope)) {
       if (collided_polygons.empty()) {
         debug.unsafe_reason = "overlap_polygon";
         debug.expected_ego_pose = ego_pose;
@@ -681,7 +762,7 @@ std::vector<Polygon2d> get_collided_polygons(
                           obj_pose_with_poly, lon_offset, lat_margin, is_stopped_object, debug);
 
     // check intersects with extended polygon
-    if (boost::geometry::intersects(extended_ego_polygon, extended_obj_polygon)) {
+    if (intersects_with_envelope_check(extended_ego_polygon, extended_obj_polygon)) {
       if (collided_polygons.empty()) {
         debug.unsafe_reason = "overlap_extended_polygon";
         debug.rss_longitudinal = rss_dist;
@@ -702,9 +783,16 @@ std::vector<Polygon2d> get_collided_polygons(
 bool checkPolygonsIntersects(
   const std::vector<Polygon2d> & polys_1, const std::vector<Polygon2d> & polys_2)
 {
+  std::vector<Box2d> envelopes_2{};
+  envelopes_2.reserve(polys_2.size());
+  for (const auto & poly_2 : polys_2) {
+    envelopes_2.push_back(bg::return_envelope<Box2d>(poly_2));
+  }
+
   for (const auto & poly_1 : polys_1) {
-    for (const auto & poly_2 : polys_2) {
-      if (boost::geometry::intersects(poly_1, poly_2)) {
+    const auto envelope_1 = bg::return_envelope<Box2d>(poly_1);
+    for (size_t i = 0; i < polys_2.size(); ++i) {
+      if (intersects_with_envelope_check(poly_1, envelope_1, polys_2.at(i), envelopes_2.at(i))) {
         return true;
       }
     }
@@ -411,6 +411,33 @@ TEST(CalcInterpolatedPoseWithVelocityTest, InvalidInput)
   EXPECT_FALSE(calc_interpolated_pose_with_velocity(path, 3.0).has_value());
 }
 
+// Interpolation at multiple times test
+TEST(CalcInterpolatedPoseWithVelocityTest, MultipleTimes)
+{
+  using autoware::behavior_path_planner::utils::path_safety_checker::
+    calc_interpolated_poses_with_velocity;
+
+  auto path = create_test_path();
+
+  // includes unsorted, negative and out of range times
+  const std::vector<double> times{0.0, 0.25, 1.0, 1.5, 2.0, 3.0, 0.5, -1.0, 1.75};
+  const auto results = calc_interpolated_poses_with_velocity(path, times);
+
+  ASSERT_EQ(results.size(), times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    const auto expected = calc_interpolated_pose_with_velocity(path, times.at(i));
+    ASSERT_EQ(results.at(i).has_value(), expected.has_value());
+    if (!expected) {
+      continue;
+    }
+    EXPECT_NEAR(results.at(i)->time, expected->time, epsilon);
+    EXPECT_NEAR(results.at(i)->pose.position.x, expected->pose.position.x, epsilon);
+    EXPECT_NEAR(results.at(i)->velocity, expected->velocity, epsilon);
+  }
+
+  EXPECT_TRUE(calc_interpolated_poses_with_velocity({}, times).at(0) == std::nullopt);
+}
+
 // Special cases test
 TEST(CalcInterpolatedPoseWithVelocityTest, DISABLED_SpecialCases)
 {
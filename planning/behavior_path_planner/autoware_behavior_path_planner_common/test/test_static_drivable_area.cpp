@@ -15,7 +15,9 @@
 #include "autoware/behavior_path_planner_common/data_manager.hpp"
 #include "autoware/behavior_path_planner_common/utils/drivable_area_expansion/static_drivable_area.hpp"
 
+#include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/route_handler/route_handler.hpp>
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_test_utils/autoware_test_utils.hpp>
 
 #include <nav_msgs/msg/detail/odometry__struct.hpp>
@@ -31,6 +33,7 @@
 #include <lanelet2_core/primitives/LineString.h>
 #include <lanelet2_core/primitives/Point.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -527,3 +530,157 @@ TEST(DISABLED_StaticDrivableArea, generateDrivableArea)
     EXPECT_FALSE(boost::geometry::intersects(path_ls, right_ls));
   }
 }
+
+TEST(StaticDrivableArea, calcBoundWithExpandedBoundCache)
+{
+  using autoware::behavior_path_planner::PlannerData;
+  using autoware::behavior_path_planner::utils::calcBound;
+  using autoware::behavior_path_planner::utils::createExpandedBoundKey;
+  using autoware::behavior_path_planner::utils::getBoundWithHatchedRoadMarkings;
+  using autoware::behavior_path_planner::utils::getBoundWithIntersectionAreas;
+  using autoware::behavior_path_planner::utils::getExpandedBoundCache;
+  using autoware::behavior_path_planner::utils::postProcess;
+  const auto are_equal = [](const auto & bound1, const auto & bound2) {
+    return bound1.size() == bound2.size() &&
+           std::equal(
+             bound1.begin(), bound1.end(), bound2.begin(),
+             [](const auto & p1, const auto & p2) { return equal(p1, p2); });
+  };
+
+  PlannerData planner_data;
+  planner_data.drivable_area_expansion_parameters.enabled = false;
+  planner_data.parameters.ego_nearest_dist_threshold = 1.0;
+  planner_data.parameters.ego_nearest_yaw_threshold = M_PI;
+  planner_data.route_handler = std::make_shared<autoware::route_handler::RouteHandler>();
+  planner_data.route_handler->setMap(intersection_map);
+  constexpr auto lanelet_id = 3101;
+  const auto ll = planner_data.route_handler->getLaneletsFromId(lanelet_id);
+  const auto lanes = autoware::behavior_path_planner::utils::generateDrivableLanes({ll});
+  tier4_planning_msgs::msg::PathWithLaneId path;
+  for (const auto & p : ll.centerline()) {
+    tier4_planning_msgs::msg::PathPointWithLaneId pp;
+    pp.point.pose.position = lanelet::utils::conversion::toGeomMsgPt(p);
+    pp.lane_ids = {lanelet_id};
+    path.points.push_back(pp);
+  }
+  nav_msgs::msg::Odometry odometry;
+  odometry.pose.pose = path.points.front().point.pose;
+  planner_data.self_odometry = std::make_shared<nav_msgs::msg::Odometry>(odometry);
+  const auto planner_data_ptr = std::make_shared<PlannerData>(planner_data);
+
+  // expand the bound without the cache
+  constexpr auto is_left = false;
+  std::vector<lanelet::ConstPoint3d> bound_points;
+  for (const auto & p : ll.rightBound3d()) {
+    bound_points.push_back(p);
+  }
+  auto expanded_bound_points =
+    getBoundWithHatchedRoadMarkings(bound_points, planner_data.route_handler);
+  expanded_bound_points = getBoundWithIntersectionAreas(
+    expanded_bound_points, planner_data.route_handler, lanes, is_left);
+  std::vector<geometry_msgs::msg::Point> expanded_bound;
+  for (const auto & p : expanded_bound_points) {
+    expanded_bound.push_back(lanelet::utils::conversion::toGeomMsgPt(p));
+  }
+  expanded_bound = autoware::motion_utils::removeOverlapPoints(expanded_bound);
+  const auto bound = postProcess(expanded_bound, path, planner_data_ptr, lanes, is_left);
+
+  // the first call fills the cache and the second one reuses it
+  const auto key = createExpandedBoundKey(
+    planner_data.route_handler->getLaneletMapPtr(), lanes, bound_points, true, true, is_left);
+  const auto first_bound = calcBound(path, planner_data_ptr, lanes, true, true, false, is_left);
+  const auto cached_bound = getExpandedBoundCache().get(key);
+  ASSERT_TRUE(cached_bound.has_value());
+  EXPECT_TRUE(are_equal(*cached_bound, expanded_bound));
+  const auto second_bound = calcBound(path, planner_data_ptr, lanes, true, true, false, is_left);
+  EXPECT_TRUE(are_equal(first_bound, bound));
+  EXPECT_TRUE(are_equal(second_bound, bound));
+
+  // the bound is not cached when it is not expanded by the map polygons
+  calcBound(path, planner_data_ptr, lanes, false, false, false, is_left);
+  EXPECT_FALSE(getExpandedBoundCache()
+                 .get(createExpandedBoundKey(
+                   planner_data.route_handler->getLaneletMapPtr(), lanes, bound_points, false,
+                   false, is_left))
+                 .has_value());
+}
+
+TEST(StaticDrivableArea, expandedBoundCacheMiss)
+{
+  using autoware::behavior_path_planner::utils::createExpandedBoundKey;
+  using autoware::behavior_path_planner::utils::ExpandedBoundCache;
+  auto route_handler = std::make_shared<autoware::route_handler::RouteHandler>();
+  route_handler->setMap(intersection_map);
+  const auto map = route_handler->getLaneletMapPtr();
+  const auto ll = route_handler->getLaneletsFromId(3101);
+  const auto lanes = autoware::behavior_path_planner::utils::generateDrivableLanes({ll});
+  std::vector<lanelet::ConstPoint3d> bound_points;
+  for (const auto & p : ll.rightBound3d()) {
+    bound_points.push_back(p);
+  }
+  ASSERT_GE(bound_points.size(), 2UL);
+  geometry_msgs::msg::Point p;
+  p.set__x(1.0).set__y(2.0);
+
+  ExpandedBoundCache cache;
+  cache.put(createExpandedBoundKey(map, lanes, bound_points, true, true, false), {p});
+  const auto cached_bound =
+    cache.get(createExpandedBoundKey(map, lanes, bound_points, true, true, false));
+  ASSERT_TRUE(cached_bound.has_value());
+  ASSERT_EQ(cached_bound->size(), 1UL);
+  EXPECT_TRUE(equal(cached_bound->front(), p));
+  const auto is_cached = [&](
+                           const auto & drivable_lanes, const auto & points, const bool hatched,
+                           const bool intersection, const bool is_left) {
+    const auto key =
+      createExpandedBoundKey(map, drivable_lanes, points, hatched, intersection, is_left);
+    return cache.get(key).has_value();
+  };
+
+  // changed lane ID
+  const auto other_lanes = autoware::behavior_path_planner::utils::generateDrivableLanes(
+    {route_handler->getLaneletsFromId(3008377)});
+  EXPECT_FALSE(is_cached(other_lanes, bound_points, true, true, false));
+  // changed bound point position or ID
+  auto moved_bound_points = bound_points;
+  moved_bound_points.back() = lanelet::Point3d(
+    bound_points.back().id(), bound_points.back().x() + 0.1, bound_points.back().y(),
+    bound_points.back().z());
+  EXPECT_FALSE(is_cached(lanes, moved_bound_points, true, true, false));
+  auto renamed_bound_points = bound_points;
+  renamed_bound_points.back() = lanelet::Point3d(
+    lanelet::InvalId, bound_points.back().x(), bound_points.back().y(), bound_points.back().z());
+  EXPECT_FALSE(is_cached(lanes, renamed_bound_points, true, true, false));
+  auto shortened_bound_points = bound_points;
+  shortened_bound_points.pop_back();
+  EXPECT_FALSE(is_cached(lanes, shortened_bound_points, true, true, false));
+  // changed expansion flags or side
+  EXPECT_FALSE(is_cached(lanes, bound_points, false, true, false));
+  EXPECT_FALSE(is_cached(lanes, bound_points, true, false, false));
+  EXPECT_FALSE(is_cached(lanes, bound_points, true, true, true));
+  // the original key still hits
+  EXPECT_TRUE(is_cached(lanes, bound_points, true, true, false));
+}
+
+TEST(StaticDrivableArea, expandedBoundCacheExpiredMap)
+{
+  using autoware::behavior_path_planner::utils::createExpandedBoundKey;
+  using autoware::behavior_path_planner::utils::ExpandedBoundCache;
+  const std::vector<DrivableLanes> lanes = {
+    make_drivable_lanes(make_lanelet({0.0, 1.0}, {2.0, 1.0}, {0.0, -1.0}, {2.0, -1.0}))};
+  const std::vector<lanelet::ConstPoint3d> bound_points = {
+    lanelet::Point3d(lanelet::InvalId, 0.0, 0.0), lanelet::Point3d(lanelet::InvalId, 2.0, 0.0)};
+
+  auto map = std::make_shared<lanelet::LaneletMap>();
+  const auto key = createExpandedBoundKey(map, lanes, bound_points, true, true, false);
+  ExpandedBoundCache cache;
+  cache.put(key, {geometry_msgs::msg::Point{}});
+  EXPECT_TRUE(cache.get(key).has_value());
+
+  // the map is released when a new one is received, which may be allocated at the same address
+  map.reset();
+  EXPECT_FALSE(cache.get(key).has_value());
+  map = std::make_shared<lanelet::LaneletMap>();
+  EXPECT_FALSE(
+    cache.get(createExpandedBoundKey(map, lanes, bound_points, true, true, false)).has_value());
+}
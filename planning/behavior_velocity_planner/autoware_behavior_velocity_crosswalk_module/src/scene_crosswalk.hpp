@@ -339,6 +339,8 @@ public:
 
   bool modifyPathVelocity(PathWithLaneId * path) override;
 
+  bool isVelocityInsertOnly() const override { return true; }
+
   visualization_msgs::msg::MarkerArray createDebugMarkerArray() override;
   autoware::motion_utils::VirtualWalls createVirtualWalls() override;
 
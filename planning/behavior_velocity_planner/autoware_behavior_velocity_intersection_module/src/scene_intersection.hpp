@@ -21,12 +21,14 @@
 #include "intersection_stoplines.hpp"
 #include "object_manager.hpp"
 #include "result.hpp"
+#include "util.hpp"
 
 #include <autoware/behavior_velocity_planner_common/scene_module_interface.hpp>
 #include <autoware/behavior_velocity_planner_common/utilization/state_machine.hpp>
 #include <autoware/motion_utils/marker/virtual_wall_marker_creator.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <nav_msgs/msg/map_meta_data.hpp>
 #include <tier4_debug_msgs/msg/float64_multi_array_stamped.hpp>
 #include <tier4_planning_msgs/msg/path_with_lane_id.hpp>
 
@@ -381,6 +383,12 @@ private:
   std::optional<std::vector<lanelet::ConstLineString3d>> occlusion_attention_divisions_{
     std::nullopt};
 
+  /**
+   * @brief cache rasterized occlusion attention area and lane divisions. they are static for the
+   * module, so the raster is built once and only shifted while the grid origin moves by whole cells
+   */
+  mutable std::optional<util::OcclusionAttentionRaster> occlusion_attention_raster_{std::nullopt};
+
   //! save the time when ego observed green traffic light before entering the intersection
   std::optional<rclcpp::Time> initial_green_light_observed_time_{std::nullopt};
   /** @}*/
@@ -701,6 +709,15 @@ private:
    * intersection_lanelets.first_attention_area(), occlusion_attention_divisions_
    */
   OcclusionType detectOcclusion(const InterpolatedPathInfo & interpolated_path_info) const;
+
+  /**
+   * @brief get occlusion_attention_raster_ on the lattice of the given occupancy grid, which is
+   * rebuilt only if the lattice has changed
+   * @attention this function has access to value() of intersection_lanelets_,
+   * occlusion_attention_divisions_
+   */
+  const util::OcclusionAttentionRaster & getOcclusionAttentionRaster(
+    const nav_msgs::msg::MapMetaData & grid_info) const;
   /** @} */
 
 private:
@@ -24,6 +24,7 @@
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <tuple>
 #include <utility>
@@ -106,8 +107,6 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   const InterpolatedPathInfo & interpolated_path_info) const
 {
   const auto & intersection_lanelets = intersection_lanelets_.value();
-  const auto & adjacent_lanelets = intersection_lanelets.adjacent();
-  const auto & attention_areas = intersection_lanelets.occlusion_attention_area();
   const auto first_attention_area = intersection_lanelets.first_attention_area().value();
   const auto & lane_divisions = occlusion_attention_divisions_.value();
 
@@ -136,9 +135,16 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   const int height = occ_grid.info.height;
   const double resolution = occ_grid.info.resolution;
   const auto & origin = occ_grid.info.origin.position;
-  auto coord2index = [&](const double x, const double y) {
-    const int idx_x = (x - origin.x) / resolution;
-    const int idx_y = (y - origin.y) / resolution;
+  if (occ_grid.data.size() < static_cast<size_t>(width) * static_cast<size_t>(height)) {
+    return NotOccluded{};
+  }
+
+  // the cells of the cached raster are shifted by the movement of the grid origin
+  const auto & attention_raster = getOcclusionAttentionRaster(occ_grid.info);
+  const auto shift = util::getCellShift(attention_raster, occ_grid.info);
+  auto cell2index = [&](const cv::Point & cell) {
+    const int idx_x = cell.x - shift.x;
+    const int idx_y = cell.y - shift.y;
     if (idx_x < 0 || idx_x >= width) return std::make_tuple(false, -1, -1);
     if (idx_y < 0 || idx_y >= height) return std::make_tuple(false, -1, -1);
     return std::make_tuple(true, idx_x, idx_y);
@@ -185,56 +191,48 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   // attention: 255
   // non-attention: 0
   // NOTE: interesting area is set to 255 for later masking
-  cv::Mat attention_mask(width, height, CV_8UC1, cv::Scalar(0));
-  std::vector<std::vector<cv::Point>> attention_area_cv_polygons;
-  for (const auto & attention_area : attention_areas) {
-    const auto area2d = lanelet::utils::to2D(attention_area);
-    findCommonCvPolygons(area2d, attention_area_cv_polygons);
-  }
-  for (const auto & poly : attention_area_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(255), cv::LINE_AA);
-  }
-  // (1.1)
-  // reset adjacent_lanelets area to 0 on attention_mask
-  std::vector<std::vector<cv::Point>> adjacent_lane_cv_polygons;
-  for (const auto & adjacent_lanelet : adjacent_lanelets) {
-    const auto area2d = adjacent_lanelet.polygon2d().basicPolygon();
-    findCommonCvPolygons(area2d, adjacent_lane_cv_polygons);
-  }
-  for (const auto & poly : adjacent_lane_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(0), cv::LINE_AA);
+  // NOTE: only the part of the grid overlapping with the attention area is processed below
+  auto attention_mask_opt = util::extractOcclusionAttentionMask(attention_raster, occ_grid.info);
+  if (!attention_mask_opt) {
+    return NotOccluded{std::numeric_limits<double>::infinity()};
   }
+  auto & [attention_mask, attention_roi] = attention_mask_opt.value();
 
   // (2) prepare unknown mask
   // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x]
   // unknown: 255
   // not-unknown: 0
-  cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
-  cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
-  for (int x = 0; x < width; x++) {
-    for (int y = 0; y < height; y++) {
-      const int idx = y * width + x;
-      const unsigned char intensity = occ_grid.data.at(idx);
-      if (
-        planner_param_.occlusion.free_space_max <= intensity &&
-        intensity < planner_param_.occlusion.occupied_min) {
-        unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
-      }
-    }
-  }
+  const cv::Mat occ_grid_image(
+    height, width, CV_8UC1, const_cast<int8_t *>(occ_grid.data.data()));  // NOLINT
+  cv::Mat unknown_grid_image;
+  cv::inRange(
+    occ_grid_image, cv::Scalar(planner_param_.occlusion.free_space_max),
+    cv::Scalar(planner_param_.occlusion.occupied_min - 1), unknown_grid_image);
+  cv::Mat unknown_mask_raw;
+  cv::flip(unknown_grid_image, unknown_mask_raw, 0);
   // (2.1) apply morphologyEx
+  // NOTE: it is applied with the margin of the kernel size around attention_roi so that the result
+  // in attention_roi is the same as applying it to the whole grid
   const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
+  const cv::Rect morph_roi =
+    cv::Rect(
+      attention_roi.x - morph_size, attention_roi.y - morph_size,
+      attention_roi.width + 2 * morph_size, attention_roi.height + 2 * morph_size) &
+    cv::Rect(0, 0, width, height);
+  cv::Mat unknown_mask(height, width, CV_8UC1, cv::Scalar(0));
+  cv::Mat unknown_mask_morph_roi = unknown_mask(morph_roi);
   cv::morphologyEx(
-    unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
+    unknown_mask_raw(morph_roi), unknown_mask_morph_roi, cv::MORPH_OPEN,
     cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
 
   // (3) occlusion mask
   static constexpr unsigned char OCCLUDED = 255;
   static constexpr unsigned char BLOCKED = 127;
-  cv::Mat occlusion_mask(width, height, CV_8UC1, cv::Scalar(0));
-  cv::bitwise_and(attention_mask, unknown_mask, occlusion_mask);
+  cv::Mat occlusion_mask(height, width, CV_8UC1, cv::Scalar(0));
+  cv::Mat occlusion_mask_roi = occlusion_mask(attention_roi);
+  cv::bitwise_and(attention_mask(attention_roi), unknown_mask(attention_roi), occlusion_mask_roi);
   // re-use attention_mask
-  attention_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  attention_mask = cv::Mat(height, width, CV_8UC1, cv::Scalar(0));
   // (3.1) draw all cells on attention_mask behind blocking vehicles as not occluded
   const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
   for (const auto & blocking_attention_object_info : blocking_attention_objects) {
@@ -250,10 +248,10 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   for (const auto & blocking_polygon : blocking_polygons) {
     cv::fillPoly(attention_mask, blocking_polygon, cv::Scalar(BLOCKED), cv::LINE_AA);
   }
-  for (const auto & division : lane_divisions) {
+  for (const auto & division_cells : attention_raster.division_cells) {
     bool blocking_vehicle_found = false;
-    for (const auto & point_it : division) {
-      const auto [valid, idx_x, idx_y] = coord2index(point_it.x(), point_it.y());
+    for (const auto & cell : division_cells) {
+      const auto [valid, idx_x, idx_y] = cell2index(cell);
       if (!valid) continue;
       if (blocking_vehicle_found) {
         occlusion_mask.at<unsigned char>(height - 1 - idx_y, idx_x) = 0;
@@ -272,7 +270,9 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   const double possible_object_bbox_y = possible_object_bbox.at(1) / resolution;
   const double possible_object_area = possible_object_bbox_x * possible_object_bbox_y;
   std::vector<std::vector<cv::Point>> contours;
-  cv::findContours(occlusion_mask, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+  cv::findContours(
+    occlusion_mask_roi, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE,
+    cv::Point(attention_roi.x, attention_roi.y));
   std::vector<std::vector<cv::Point>> valid_contours;
   for (const auto & contour : contours) {
     if (contour.size() <= 2) {
@@ -308,7 +308,7 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     debug_data_.occlusion_polygons.push_back(polygon_msg);
   }
   // (4.1) re-draw occluded cells using valid_contours
-  occlusion_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  occlusion_mask = cv::Mat(height, width, CV_8UC1, cv::Scalar(0));
   for (const auto & valid_contour : valid_contours) {
     // NOTE: drawContour does not work well
     cv::fillPoly(occlusion_mask, valid_contour, cv::Scalar(OCCLUDED), cv::LINE_AA);
@@ -363,6 +363,7 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   double min_dist = std::numeric_limits<double>::infinity();
   for (unsigned division_index = 0; division_index < lane_divisions.size(); ++division_index) {
     const auto & division = lane_divisions.at(division_index);
+    const auto & division_cells = attention_raster.division_cells.at(division_index);
     LineString2d division_linestring;
     auto division_point_it = division.begin();
     division_linestring.emplace_back(division_point_it->x(), division_point_it->y());
@@ -391,12 +392,13 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     bool found_min_dist_for_this_division = false;
     bool is_prev_occluded = false;
     auto acc_dist_it = projection_it;
-    for (auto point_it = projection_it; point_it != division.end(); point_it++) {
+    auto point_index = std::distance(division.begin(), projection_it);
+    for (auto point_it = projection_it; point_it != division.end(); point_it++, point_index++) {
       const double dist =
         std::hypot(point_it->x() - acc_dist_it->x(), point_it->y() - acc_dist_it->y());
       acc_dist += dist;
       acc_dist_it = point_it;
-      const auto [valid, idx_x, idx_y] = coord2index(point_it->x(), point_it->y());
+      const auto [valid, idx_x, idx_y] = cell2index(division_cells.at(point_index));
       if (!valid) continue;
       const auto pixel = occlusion_mask.at<unsigned char>(height - 1 - idx_y, idx_x);
       if (pixel == BLOCKED) {
@@ -406,7 +408,7 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
         if (acc_dist < min_dist) {
           min_dist = acc_dist;
           nearest_occlusion_point = {
-            division_index, std::distance(division.begin(), point_it),
+            division_index, point_index,
             autoware::universe_utils::createPoint(point_it->x(), point_it->y(), origin.z),
             autoware::universe_utils::createPoint(projection_it->x(), projection_it->y(), origin.z),
             autoware::universe_utils::createPoint(
@@ -451,4 +453,20 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   debug_data_.static_occlusion = true;
   return StaticallyOccluded{min_dist};
 }
+
+const util::OcclusionAttentionRaster & IntersectionModule::getOcclusionAttentionRaster(
+  const nav_msgs::msg::MapMetaData & grid_info) const
+{
+  if (
+    occlusion_attention_raster_ &&
+    util::isOnSameLattice(occlusion_attention_raster_.value(), grid_info)) {
+    return occlusion_attention_raster_.value();
+  }
+
+  const auto & intersection_lanelets = intersection_lanelets_.value();
+  occlusion_attention_raster_ = util::rasterizeOcclusionAttentionArea(
+    grid_info, intersection_lanelets.occlusion_attention_area(), intersection_lanelets.adjacent(),
+    occlusion_attention_divisions_.value());
+  return occlusion_attention_raster_.value();
+}
 }  // namespace autoware::behavior_velocity_planner
@@ -21,6 +21,7 @@
 #include <autoware/behavior_velocity_planner_common/utilization/util.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
+#include <opencv2/imgproc.hpp>
 
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/intersects.hpp>
@@ -399,4 +400,125 @@ std::vector<lanelet::CompoundPolygon3d> getPolygon3dFromLanelets(
   return polys;
 }
 
+OcclusionAttentionRaster rasterizeOcclusionAttentionArea(
+  const nav_msgs::msg::MapMetaData & grid_info,
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets,
+  const std::vector<lanelet::ConstLineString3d> & lane_divisions)
+{
+  const double resolution = grid_info.resolution;
+  const auto & grid_origin = grid_info.origin.position;
+
+  // the raster covers the bounding box of the attention area on the lattice of the grid
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & attention_area : attention_areas) {
+    for (const auto & p : attention_area) {
+      min_x = std::min(min_x, p.x());
+      min_y = std::min(min_y, p.y());
+      max_x = std::max(max_x, p.x());
+      max_y = std::max(max_y, p.y());
+    }
+  }
+
+  OcclusionAttentionRaster raster;
+  raster.resolution = resolution;
+  raster.origin_x = grid_origin.x;
+  raster.origin_y = grid_origin.y;
+  if (min_x <= max_x && min_y <= max_y) {
+    raster.origin_x += std::floor((min_x - grid_origin.x) / resolution) * resolution;
+    raster.origin_y += std::floor((min_y - grid_origin.y) / resolution) * resolution;
+    const int cols = static_cast<int>(std::floor((max_x - raster.origin_x) / resolution)) + 1;
+    const int rows = static_cast<int>(std::floor((max_y - raster.origin_y) / resolution)) + 1;
+    raster.mask = cv::Mat(rows, cols, CV_8UC1, cv::Scalar(0));
+  }
+
+  const auto to_cell = [&](const double x, const double y) {
+    return cv::Point(
+      static_cast<int>(std::floor((x - raster.origin_x) / resolution)),
+      static_cast<int>(std::floor((y - raster.origin_y) / resolution)));
+  };
+  const auto to_cv_polygon = [&](const auto & area2d) {
+    std::vector<cv::Point> cv_polygon;
+    for (const auto & p : area2d) {
+      const auto cell = to_cell(p.x(), p.y());
+      cv_polygon.emplace_back(cell.x, raster.mask.rows - 1 - cell.y);
+    }
+    return cv_polygon;
+  };
+  if (!raster.mask.empty()) {
+    for (const auto & attention_area : attention_areas) {
+      cv::fillPoly(
+        raster.mask, to_cv_polygon(lanelet::utils::to2D(attention_area)), cv::Scalar(255),
+        cv::LINE_AA);
+    }
+    // reset adjacent_lanelets area to 0
+    for (const auto & adjacent_lanelet : adjacent_lanelets) {
+      cv::fillPoly(
+        raster.mask, to_cv_polygon(adjacent_lanelet.polygon2d().basicPolygon()), cv::Scalar(0),
+        cv::LINE_AA);
+    }
+  }
+
+  raster.division_cells.reserve(lane_divisions.size());
+  for (const auto & division : lane_divisions) {
+    std::vector<cv::Point> cells;
+    cells.reserve(division.size());
+    for (const auto & point : division) {
+      cells.push_back(to_cell(point.x(), point.y()));
+    }
+    raster.division_cells.push_back(std::move(cells));
+  }
+  return raster;
+}
+
+bool isOnSameLattice(
+  const OcclusionAttentionRaster & raster, const nav_msgs::msg::MapMetaData & grid_info)
+{
+  const double resolution = grid_info.resolution;
+  if (std::abs(raster.resolution - resolution) > 1e-6) {
+    return false;
+  }
+  const double shift_x = (grid_info.origin.position.x - raster.origin_x) / resolution;
+  const double shift_y = (grid_info.origin.position.y - raster.origin_y) / resolution;
+  return std::abs(shift_x - std::round(shift_x)) < 1e-3 &&
+         std::abs(shift_y - std::round(shift_y)) < 1e-3;
+}
+
+cv::Point getCellShift(
+  const OcclusionAttentionRaster & raster, const nav_msgs::msg::MapMetaData & grid_info)
+{
+  const double resolution = grid_info.resolution;
+  return cv::Point(
+    static_cast<int>(std::lround((grid_info.origin.position.x - raster.origin_x) / resolution)),
+    static_cast<int>(std::lround((grid_info.origin.position.y - raster.origin_y) / resolution)));
+}
+
+std::optional<std::pair<cv::Mat, cv::Rect>> extractOcclusionAttentionMask(
+  const OcclusionAttentionRaster & raster, const nav_msgs::msg::MapMetaData & grid_info)
+{
+  const int width = grid_info.width;
+  const int height = grid_info.height;
+  const auto shift = getCellShift(raster, grid_info);
+
+  const int overlap_min_x = std::max(0, -shift.x);
+  const int overlap_max_x = std::min(width, raster.mask.cols - shift.x);
+  const int overlap_min_y = std::max(0, -shift.y);
+  const int overlap_max_y = std::min(height, raster.mask.rows - shift.y);
+  if (overlap_min_x >= overlap_max_x || overlap_min_y >= overlap_max_y) {
+    return std::nullopt;
+  }
+  const cv::Rect roi(
+    overlap_min_x, height - overlap_max_y, overlap_max_x - overlap_min_x,
+    overlap_max_y - overlap_min_y);
+  cv::Mat mask(height, width, CV_8UC1, cv::Scalar(0));
+  raster
+    .mask(cv::Rect(
+      overlap_min_x + shift.x, raster.mask.rows - shift.y - overlap_max_y, roi.width, roi.height))
+    .copyTo(mask(roi));
+  return std::make_pair(mask, roi);
+}
+
 }  // namespace autoware::behavior_velocity_planner::util
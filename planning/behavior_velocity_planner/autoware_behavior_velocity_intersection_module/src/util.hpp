@@ -18,9 +18,11 @@
 #include "interpolated_path_info.hpp"
 
 #include <autoware/universe_utils/geometry/boost_geometry.hpp>
+#include <opencv2/core/mat.hpp>
 #include <rclcpp/logger.hpp>
 
 #include <autoware_perception_msgs/msg/predicted_object_kinematics.hpp>
+#include <nav_msgs/msg/map_meta_data.hpp>
 
 #include <lanelet2_core/Forward.h>
 #include <lanelet2_routing/Forward.h>
@@ -133,6 +135,54 @@ getFirstPointInsidePolygonsByFootprint(
 std::vector<lanelet::CompoundPolygon3d> getPolygon3dFromLanelets(
   const lanelet::ConstLanelets & ll_vec);
 
+/**
+ * @brief occlusion attention area and lane divisions rasterized on the lattice of an occupancy grid
+ */
+struct OcclusionAttentionRaster
+{
+  double origin_x{0.0};  //! position of the cell (0, 0)
+  double origin_y{0.0};
+  double resolution{0.0};
+  //! attention: 255, non-attention: 0. the cell (x, y) is at the pixel (x, rows - 1 - y)
+  cv::Mat mask;
+  //! cell of each point of the lane divisions
+  std::vector<std::vector<cv::Point>> division_cells;
+};
+
+/**
+ * @brief rasterize the attention areas except for the adjacent lanelets, and the points of the lane
+ * divisions, on the lattice of the given occupancy grid. the raster covers the bounding box of the
+ * attention areas, which may be outside of the grid
+ */
+OcclusionAttentionRaster rasterizeOcclusionAttentionArea(
+  const nav_msgs::msg::MapMetaData & grid_info,
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets,
+  const std::vector<lanelet::ConstLineString3d> & lane_divisions);
+
+/**
+ * @brief check if the cells of the raster are aligned with those of the given occupancy grid
+ */
+bool isOnSameLattice(
+  const OcclusionAttentionRaster & raster, const nav_msgs::msg::MapMetaData & grid_info);
+
+/**
+ * @brief get the number of cells by which the origin of the given occupancy grid is shifted from
+ * that of the raster. the cell (x, y) of the raster is the cell (x - shift.x, y - shift.y) of the
+ * grid
+ */
+cv::Point getCellShift(
+  const OcclusionAttentionRaster & raster, const nav_msgs::msg::MapMetaData & grid_info);
+
+/**
+ * @brief copy the raster to a mask of the size of the given occupancy grid, in the same image
+ * coordinate as the raster
+ * @return the mask and the region of the mask overlapping with the raster, or null if the raster is
+ * outside of the grid
+ */
+std::optional<std::pair<cv::Mat, cv::Rect>> extractOcclusionAttentionMask(
+  const OcclusionAttentionRaster & raster, const nav_msgs::msg::MapMetaData & grid_info);
+
 }  // namespace autoware::behavior_velocity_planner::util
 
 #endif  // UTIL_HPP_
@@ -17,11 +17,75 @@
 
 #include <autoware/route_handler/route_handler.hpp>
 #include <autoware_test_utils/autoware_test_utils.hpp>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
 
 #include <gtest/gtest.h>
+#include <lanelet2_core/primitives/Lanelet.h>
 
+#include <utility>
 #include <vector>
 
+namespace
+{
+lanelet::ConstLanelet createLanelet(
+  const std::vector<std::pair<double, double>> & left,
+  const std::vector<std::pair<double, double>> & right)
+{
+  const auto create_linestring = [](const std::vector<std::pair<double, double>> & points) {
+    lanelet::LineString3d linestring(lanelet::InvalId);
+    for (const auto & [x, y] : points) {
+      linestring.push_back(lanelet::Point3d(lanelet::InvalId, x, y, 0.0));
+    }
+    return linestring;
+  };
+  return lanelet::Lanelet(lanelet::InvalId, create_linestring(left), create_linestring(right));
+}
+
+nav_msgs::msg::MapMetaData createGridInfo(
+  const double origin_x, const double origin_y, const unsigned width, const unsigned height)
+{
+  nav_msgs::msg::MapMetaData grid_info;
+  grid_info.resolution = 0.5;
+  grid_info.width = width;
+  grid_info.height = height;
+  grid_info.origin.position.x = origin_x;
+  grid_info.origin.position.y = origin_y;
+  return grid_info;
+}
+
+// rasterize the attention areas directly on the grid, as done before the raster was cached. the
+// areas need to be inside the grid since they are not clipped
+cv::Mat rasterizeOnGrid(
+  const nav_msgs::msg::MapMetaData & grid_info,
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets)
+{
+  const int height = grid_info.height;
+  const auto to_cv_polygon = [&](const auto & area) {
+    std::vector<cv::Point> cv_polygon;
+    for (const auto & p : area) {
+      const int idx_x =
+        static_cast<int>((p.x() - grid_info.origin.position.x) / grid_info.resolution);
+      const int idx_y =
+        static_cast<int>((p.y() - grid_info.origin.position.y) / grid_info.resolution);
+      cv_polygon.emplace_back(idx_x, height - 1 - idx_y);
+    }
+    return cv_polygon;
+  };
+  cv::Mat mask(height, grid_info.width, CV_8UC1, cv::Scalar(0));
+  for (const auto & attention_area : attention_areas) {
+    cv::fillPoly(mask, to_cv_polygon(attention_area), cv::Scalar(255), cv::LINE_AA);
+  }
+  for (const auto & adjacent_lanelet : adjacent_lanelets) {
+    cv::fillPoly(
+      mask, to_cv_polygon(adjacent_lanelet.polygon2d().basicPolygon()), cv::Scalar(0),
+      cv::LINE_AA);
+  }
+  return mask;
+}
+}  // namespace
+
 TEST(TestUtil, retrievePathsBackward)
 {
   /*
@@ -90,6 +154,83 @@ TEST(TestUtil, retrievePathsBackward)
   }
 }
 
+TEST(TestUtil, occlusionAttentionRasterOnShiftedGrid)
+{
+  using autoware::behavior_velocity_planner::util::extractOcclusionAttentionMask;
+  using autoware::behavior_velocity_planner::util::getCellShift;
+  using autoware::behavior_velocity_planner::util::isOnSameLattice;
+  using autoware::behavior_velocity_planner::util::rasterizeOcclusionAttentionArea;
+
+  const auto attention_lanelet1 = createLanelet(
+    {{-5.3, 3.1}, {8.2, 4.4}, {20.7, 12.2}}, {{-5.1, -3.1}, {9.3, -1.7}, {19.9, 6.3}});
+  const auto attention_lanelet2 =
+    createLanelet({{2.2, 11.9}, {6.1, 4.3}}, {{-2.4, 10.7}, {1.7, 2.8}});
+  const auto adjacent_lanelet =
+    createLanelet({{-1.3, 1.1}, {12.2, 2.3}}, {{-1.2, -0.9}, {12.4, 0.2}});
+  const std::vector<lanelet::CompoundPolygon3d> attention_areas = {
+    attention_lanelet1.polygon3d(), attention_lanelet2.polygon3d()};
+  const lanelet::ConstLanelets adjacent_lanelets = {adjacent_lanelet};
+  const std::vector<lanelet::ConstLineString3d> lane_divisions = {
+    attention_lanelet1.centerline(), attention_lanelet2.centerline()};
+
+  const auto cached_grid_info = createGridInfo(-20.0, -20.0, 160, 120);
+  const auto cached_raster = rasterizeOcclusionAttentionArea(
+    cached_grid_info, attention_areas, adjacent_lanelets, lane_divisions);
+  ASSERT_FALSE(cached_raster.mask.empty());
+  ASSERT_EQ(cached_raster.division_cells.size(), lane_divisions.size());
+
+  const auto expect_same_as_fresh_raster = [&](const nav_msgs::msg::MapMetaData & grid_info) {
+    ASSERT_TRUE(isOnSameLattice(cached_raster, grid_info));
+    const auto fresh_raster = rasterizeOcclusionAttentionArea(
+      grid_info, attention_areas, adjacent_lanelets, lane_divisions);
+    const auto cached_mask = extractOcclusionAttentionMask(cached_raster, grid_info);
+    const auto fresh_mask = extractOcclusionAttentionMask(fresh_raster, grid_info);
+    ASSERT_EQ(cached_mask.has_value(), fresh_mask.has_value());
+    if (cached_mask) {
+      EXPECT_EQ(cached_mask->second, fresh_mask->second);
+      EXPECT_EQ(cv::countNonZero(cached_mask->first != fresh_mask->first), 0);
+    }
+
+    const auto cached_shift = getCellShift(cached_raster, grid_info);
+    const auto fresh_shift = getCellShift(fresh_raster, grid_info);
+    for (size_t i = 0; i < lane_divisions.size(); ++i) {
+      const auto & cached_cells = cached_raster.division_cells.at(i);
+      const auto & fresh_cells = fresh_raster.division_cells.at(i);
+      ASSERT_EQ(cached_cells.size(), fresh_cells.size());
+      for (size_t j = 0; j < cached_cells.size(); ++j) {
+        EXPECT_EQ(cached_cells.at(j) - cached_shift, fresh_cells.at(j) - fresh_shift);
+      }
+    }
+  };
+
+  // the grid contains the attention areas
+  const std::vector<std::pair<int, int>> shifts = {{0, 0}, {3, -5}, {17, 11}};
+  for (const auto & [shift_x, shift_y] : shifts) {
+    const auto grid_info = createGridInfo(-20.0 + 0.5 * shift_x, -20.0 + 0.5 * shift_y, 160, 120);
+    expect_same_as_fresh_raster(grid_info);
+
+    const auto mask = extractOcclusionAttentionMask(cached_raster, grid_info);
+    ASSERT_TRUE(mask.has_value());
+    EXPECT_GT(cv::countNonZero(mask->first), 0);
+    const auto mask_on_grid = rasterizeOnGrid(grid_info, attention_areas, adjacent_lanelets);
+    EXPECT_EQ(cv::countNonZero(mask->first != mask_on_grid), 0);
+  }
+
+  // the grid contains a part of the attention areas
+  expect_same_as_fresh_raster(createGridInfo(5.0, -20.0, 160, 120));
+
+  // the grid does not overlap with the attention areas
+  expect_same_as_fresh_raster(createGridInfo(200.0, 200.0, 160, 120));
+  EXPECT_FALSE(
+    extractOcclusionAttentionMask(cached_raster, createGridInfo(200.0, 200.0, 160, 120)));
+
+  // the raster is rebuilt if the grid is shifted by a fraction of a cell or has another resolution
+  EXPECT_FALSE(isOnSameLattice(cached_raster, createGridInfo(-19.8, -20.0, 160, 120)));
+  auto grid_info_with_other_resolution = cached_grid_info;
+  grid_info_with_other_resolution.resolution = 0.25;
+  EXPECT_FALSE(isOnSameLattice(cached_raster, grid_info_with_other_resolution));
+}
+
 /*
   TODO(Mamoru Sobue): instantiating intersection_module and PlannerData is a messy
 class TestWithMap : public ::testing::Test
@@ -86,6 +86,13 @@ public:
 
   virtual bool modifyPathVelocity(PathWithLaneId * path) = 0;
 
+  /**
+   * @brief whether modifyPathVelocity only inserts stop or slow down points into the path without
+   * changing its shape. Such modules of a manager can plan concurrently on copies of the same path,
+   * whose velocities are merged afterwards.
+   */
+  virtual bool isVelocityInsertOnly() const { return false; }
+
   virtual visualization_msgs::msg::MarkerArray createDebugMarkerArray() = 0;
   virtual std::vector<autoware::motion_utils::VirtualWall> createVirtualWalls() = 0;
 
@@ -205,6 +212,7 @@ protected:
   rclcpp::Clock::SharedPtr clock_;
   // Debug
   bool is_publish_debug_path_ = {false};  // note : this is very heavy debug topic option
+  int scene_module_thread_num_ = {1};       // threads to run velocity insert only modules
   rclcpp::Logger logger_;
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr pub_virtual_wall_;
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr pub_debug_;
@@ -227,6 +227,22 @@ std::optional<geometry_msgs::msg::Pose> insertStopPoint(
 std::optional<geometry_msgs::msg::Pose> insertStopPoint(
   const geometry_msgs::msg::Point & stop_point, const size_t stop_seg_idx, PathWithLaneId & output);
 
+/**
+ * @brief merge the paths modified by the scene modules which only insert stop or slow down points
+ * into the same input path, i.e. which do not change its shape.
+ * The points inserted by each module are added to the input path in the order of the arc length,
+ * and the velocity of each point is the minimum of the velocities of the modified paths at the
+ * point, where the velocity of a point is kept until the next point. The result does not depend on
+ * the order of the modified paths.
+ * @param input path given to all the modules
+ * @param modified_paths paths modified by the modules
+ * @param overlap_threshold distance below which an inserted point is merged with the existing one
+ * @return merged path
+ */
+PathWithLaneId mergeInsertedVelocities(
+  const PathWithLaneId & input, const std::vector<PathWithLaneId> & modified_paths,
+  const double overlap_threshold = 1e-3);
+
 /*
   @brief return 'associative' lanes in the intersection. 'associative' means that a lane shares same
   or lane-changeable parent lanes with `lane` and has same turn_direction value.
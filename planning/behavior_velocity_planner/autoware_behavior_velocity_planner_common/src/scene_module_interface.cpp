@@ -20,6 +20,7 @@
 #include <autoware/universe_utils/system/time_keeper.hpp>
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <memory>
 #include <string>
@@ -61,6 +62,7 @@ SceneModuleManagerInterface::SceneModuleManagerInterface(
   } else {
     is_publish_debug_path_ = node.get_parameter("is_publish_debug_path").as_bool();
   }
+  scene_module_thread_num_ = getOrDeclareParameter<int>(node, "scene_module_thread_num");
   if (is_publish_debug_path_) {
     pub_debug_path_ = node.create_publisher<tier4_planning_msgs::msg::PathWithLaneId>(
       std::string("~/debug/path_with_lane_id/") + module_name, 1);
@@ -114,11 +116,46 @@ void SceneModuleManagerInterface::modifyPathVelocity(
   tier4_v2x_msgs::msg::InfrastructureCommandArray infrastructure_command_array;
   infrastructure_command_array.stamp = clock_->now();
 
+  std::vector<std::shared_ptr<SceneModuleInterface>> velocity_insert_only_modules;
   for (const auto & scene_module : scene_modules_) {
     scene_module->resetVelocityFactor();
     scene_module->setPlannerData(planner_data_);
+    if (scene_module_thread_num_ > 1 && scene_module->isVelocityInsertOnly()) {
+      velocity_insert_only_modules.push_back(scene_module);
+      continue;
+    }
     scene_module->modifyPathVelocity(path);
+  }
+
+  // The modules which only insert velocities plan concurrently against the same input path, and
+  // their results are merged in the order of the arc length.
+  // NOTE: Only the modules of this manager run concurrently. The managers themselves still run one
+  // after another, since some of them reshape the path given to the next ones. Running the
+  // managers concurrently is deliberately out of scope.
+  if (!velocity_insert_only_modules.empty()) {
+    const auto input_path = *path;
+    std::vector<tier4_planning_msgs::msg::PathWithLaneId> modified_paths(
+      velocity_insert_only_modules.size(), input_path);
+    std::vector<std::exception_ptr> exceptions(velocity_insert_only_modules.size());
+
+#pragma omp parallel for num_threads(scene_module_thread_num_) schedule(dynamic, 1)
+    for (size_t i = 0; i < velocity_insert_only_modules.size(); ++i) {
+      try {
+        velocity_insert_only_modules.at(i)->modifyPathVelocity(&modified_paths.at(i));
+      } catch (...) {
+        exceptions.at(i) = std::current_exception();
+      }
+    }
 
+    for (const auto & exception : exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+    *path = planning_utils::mergeInsertedVelocities(input_path, modified_paths);
+  }
+
+  for (const auto & scene_module : scene_modules_) {
     // The velocity factor must be called after modifyPathVelocity.
     const auto velocity_factor = scene_module->getVelocityFactor();
     if (velocity_factor.behavior != PlanningBehavior::UNKNOWN) {
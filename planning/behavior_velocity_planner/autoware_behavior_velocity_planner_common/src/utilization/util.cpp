@@ -37,6 +37,7 @@
 #include <iostream>
 #include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace
@@ -695,4 +696,125 @@ lanelet::ConstLanelets getConstLaneletsFromIds(
   return ret;
 }
 
+PathWithLaneId mergeInsertedVelocities(
+  const PathWithLaneId & input, const std::vector<PathWithLaneId> & modified_paths,
+  const double overlap_threshold)
+{
+  if (input.points.empty() || modified_paths.empty()) {
+    return input;
+  }
+
+  std::vector<double> input_arc_lengths(input.points.size(), 0.0);
+  for (size_t i = 1; i < input.points.size(); ++i) {
+    input_arc_lengths.at(i) =
+      input_arc_lengths.at(i - 1) + calcDistance2d(input.points.at(i - 1), input.points.at(i));
+  }
+
+  // velocity profile of each modified path along the arc length of the input path
+  struct ProfilePoint
+  {
+    double s;
+    float velocity;
+  };
+  struct InsertedPoint
+  {
+    double s;
+    size_t path_idx;
+    size_t point_idx;
+  };
+  std::vector<std::vector<ProfilePoint>> profiles;
+  std::vector<InsertedPoint> inserted_points;
+  for (size_t k = 0; k < modified_paths.size(); ++k) {
+    const auto & points = modified_paths.at(k).points;
+    if (points.empty()) {
+      continue;
+    }
+    std::vector<ProfilePoint> profile;
+    profile.reserve(points.size());
+    size_t input_idx = 0;
+    double s = 0.0;
+    double matched_s = 0.0;
+    double matched_input_s = 0.0;
+    for (size_t j = 0; j < points.size(); ++j) {
+      if (j > 0) {
+        s += calcDistance2d(points.at(j - 1), points.at(j));
+      }
+      // the points of the input path appear in the same order in the modified path
+      const auto is_matched = [&](const size_t i) {
+        return i < input.points.size() &&
+               calcDistance2d(input.points.at(i), points.at(j)) < overlap_threshold;
+      };
+      if (is_matched(input_idx) || is_matched(input_idx + 1)) {
+        input_idx += is_matched(input_idx) ? 0 : 1;
+        matched_s = s;
+        matched_input_s = input_arc_lengths.at(input_idx);
+        profile.push_back({matched_input_s, points.at(j).point.longitudinal_velocity_mps});
+        ++input_idx;
+        continue;
+      }
+      const double inserted_s = matched_input_s + s - matched_s;
+      profile.push_back({inserted_s, points.at(j).point.longitudinal_velocity_mps});
+      inserted_points.push_back({inserted_s, k, j});
+    }
+    profiles.push_back(std::move(profile));
+  }
+
+  // NOTE: sort with the indices as well so that the merged path is deterministic
+  std::sort(
+    inserted_points.begin(), inserted_points.end(),
+    [](const InsertedPoint & a, const InsertedPoint & b) {
+      return std::tie(a.s, a.path_idx, a.point_idx) < std::tie(b.s, b.path_idx, b.point_idx);
+    });
+
+  PathWithLaneId output;
+  output.header = input.header;
+  output.left_bound = input.left_bound;
+  output.right_bound = input.right_bound;
+  output.points.reserve(input.points.size() + inserted_points.size());
+  std::vector<double> output_arc_lengths;
+  output_arc_lengths.reserve(input.points.size() + inserted_points.size());
+  const auto push_inserted_point = [&](const InsertedPoint & p) {
+    if (!output_arc_lengths.empty() && p.s - output_arc_lengths.back() < overlap_threshold) {
+      return;
+    }
+    output.points.push_back(modified_paths.at(p.path_idx).points.at(p.point_idx));
+    output_arc_lengths.push_back(p.s);
+  };
+  size_t inserted_idx = 0;
+  for (size_t i = 0; i < input.points.size(); ++i) {
+    const double s = input_arc_lengths.at(i);
+    for (; inserted_idx < inserted_points.size() &&
+           inserted_points.at(inserted_idx).s < s - overlap_threshold;
+         ++inserted_idx) {
+      push_inserted_point(inserted_points.at(inserted_idx));
+    }
+    // the inserted points overlapping with the input point are represented by the input point
+    for (; inserted_idx < inserted_points.size() &&
+           inserted_points.at(inserted_idx).s < s + overlap_threshold;
+         ++inserted_idx) {
+    }
+    output.points.push_back(input.points.at(i));
+    output_arc_lengths.push_back(s);
+  }
+  for (; inserted_idx < inserted_points.size(); ++inserted_idx) {
+    push_inserted_point(inserted_points.at(inserted_idx));
+  }
+
+  // the velocity of each profile is kept until its next point
+  std::vector<size_t> profile_indices(profiles.size(), 0);
+  for (size_t i = 0; i < output.points.size(); ++i) {
+    auto & velocity = output.points.at(i).point.longitudinal_velocity_mps;
+    for (size_t k = 0; k < profiles.size(); ++k) {
+      const auto & profile = profiles.at(k);
+      auto & idx = profile_indices.at(k);
+      while (idx + 1 < profile.size() &&
+             profile.at(idx + 1).s < output_arc_lengths.at(i) + overlap_threshold) {
+        ++idx;
+      }
+      velocity = std::min(velocity, profile.at(idx).velocity);
+    }
+  }
+  return output;
+}
+
 }  // namespace autoware::behavior_velocity_planner::planning_utils
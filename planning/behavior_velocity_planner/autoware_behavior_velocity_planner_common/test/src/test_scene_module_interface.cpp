@@ -0,0 +1,162 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_planner_common/scene_module_interface.hpp"
+#include "autoware/behavior_velocity_planner_common/utilization/util.hpp"
+#include "utils.hpp"
+
+#include <rclcpp/node.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware::behavior_velocity_planner::PlannerData;
+using autoware::behavior_velocity_planner::SceneModuleInterface;
+using autoware::behavior_velocity_planner::SceneModuleManagerInterface;
+using tier4_planning_msgs::msg::PathWithLaneId;
+
+struct ModuleSpec
+{
+  double x;                   // position of the inserted point
+  double velocity;            // inserted velocity, or a stop point if zero
+  bool velocity_insert_only;  // if false, the velocity of the whole path is limited instead
+};
+
+class TestSceneModule : public SceneModuleInterface
+{
+public:
+  TestSceneModule(
+    const int64_t module_id, const ModuleSpec & spec, rclcpp::Logger logger,
+    rclcpp::Clock::SharedPtr clock)
+  : SceneModuleInterface(module_id, logger, clock), spec_(spec)
+  {
+  }
+
+  bool modifyPathVelocity(PathWithLaneId * path) override
+  {
+    namespace planning_utils = autoware::behavior_velocity_planner::planning_utils;
+    if (!spec_.velocity_insert_only) {
+      for (auto & p : path->points) {
+        p.point.longitudinal_velocity_mps =
+          std::min(p.point.longitudinal_velocity_mps, static_cast<float>(spec_.velocity));
+      }
+      return true;
+    }
+    geometry_msgs::msg::Point point;
+    point.x = spec_.x;
+    if (spec_.velocity == 0.0) {
+      planning_utils::insertStopPoint(point, *path);
+    } else {
+      planning_utils::insertDecelPoint(point, *path, static_cast<float>(spec_.velocity));
+    }
+    return true;
+  }
+
+  bool isVelocityInsertOnly() const override { return spec_.velocity_insert_only; }
+
+  visualization_msgs::msg::MarkerArray createDebugMarkerArray() override { return {}; }
+
+  std::vector<autoware::motion_utils::VirtualWall> createVirtualWalls() override { return {}; }
+
+private:
+  ModuleSpec spec_;
+};
+
+class TestSceneModuleManager : public SceneModuleManagerInterface
+{
+public:
+  TestSceneModuleManager(rclcpp::Node & node, const std::vector<ModuleSpec> & specs)
+  : SceneModuleManagerInterface(node, "test_module"), specs_(specs)
+  {
+  }
+
+  const char * getModuleName() override { return "test_module"; }
+
+private:
+  void launchNewModules([[maybe_unused]] const PathWithLaneId & path) override
+  {
+    for (size_t i = 0; i < specs_.size(); ++i) {
+      const auto module_id = static_cast<int64_t>(i);
+      if (!isModuleRegistered(module_id)) {
+        registerModule(std::make_shared<TestSceneModule>(
+          module_id, specs_.at(i), logger_.get_child("test_module"), clock_));
+      }
+    }
+  }
+
+  std::function<bool(const std::shared_ptr<SceneModuleInterface> &)> getModuleExpiredFunction(
+    [[maybe_unused]] const PathWithLaneId & path) override
+  {
+    return [](const std::shared_ptr<SceneModuleInterface> &) { return false; };
+  }
+
+  std::vector<ModuleSpec> specs_;
+};
+
+PathWithLaneId plan(
+  const std::string & node_name, const int scene_module_thread_num,
+  const std::vector<ModuleSpec> & specs, const PathWithLaneId & input)
+{
+  rclcpp::NodeOptions options;
+  options.parameter_overrides(
+    {rclcpp::Parameter("is_publish_debug_path", false),
+     rclcpp::Parameter("scene_module_thread_num", scene_module_thread_num)});
+  auto node = std::make_shared<rclcpp::Node>(node_name, options);
+  TestSceneModuleManager manager(*node, specs);
+
+  // the test modules do not use the planner data
+  manager.updateSceneModuleInstances(std::shared_ptr<const PlannerData>(), input);
+  auto path = input;
+  manager.plan(&path);
+  return path;
+}
+}  // namespace
+
+TEST(SceneModuleManagerInterface, planVelocityInsertOnlyModulesConcurrently)
+{
+  if (!rclcpp::ok()) {
+    rclcpp::init(0, nullptr);
+  }
+
+  auto input = test::generatePath(0.0, 0.0, 9.0, 0.0, 10);
+  for (auto & p : input.points) {
+    p.point.longitudinal_velocity_mps = 10.0;
+  }
+  const std::vector<ModuleSpec> specs = {
+    {0.0, 8.0, false}, {6.5, 0.0, true}, {2.5, 5.0, true},
+    {6.5, 3.0, true},  {4.2, 2.0, true}, {8.9, 1.0, true}};
+
+  const auto serial_path = plan("serial_node", 1, specs, input);
+  const auto parallel_path = plan("parallel_node", 4, specs, input);
+
+  // the points inserted by all the modules are kept
+  ASSERT_GT(serial_path.points.size(), input.points.size());
+  ASSERT_EQ(parallel_path.points.size(), serial_path.points.size());
+  for (size_t i = 0; i < serial_path.points.size(); ++i) {
+    const auto & expected = serial_path.points.at(i).point;
+    const auto & actual = parallel_path.points.at(i).point;
+    EXPECT_NEAR(actual.pose.position.x, expected.pose.position.x, 1e-6);
+    EXPECT_NEAR(actual.pose.position.y, expected.pose.position.y, 1e-6);
+    EXPECT_FLOAT_EQ(actual.longitudinal_velocity_mps, expected.longitudinal_velocity_mps);
+  }
+
+  rclcpp::shutdown();
+}
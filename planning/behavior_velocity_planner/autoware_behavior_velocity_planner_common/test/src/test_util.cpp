@@ -212,6 +212,52 @@ TEST(PlanningUtilsTest, insertStopPoint)
   }
 }
 
+// Test for mergeInsertedVelocities
+TEST(PlanningUtilsTest, mergeInsertedVelocities)
+{
+  auto input = test::generatePath(0.0, 0.0, 9.0, 0.0, 10);
+  for (auto & p : input.points) {
+    p.point.longitudinal_velocity_mps = 10.0;
+  }
+  const auto make_point = [](const double x) {
+    geometry_msgs::msg::Point point;
+    point.x = x;
+    point.y = 0.0;
+    return point;
+  };
+
+  auto stop_path = input;
+  insertStopPoint(make_point(6.5), stop_path);
+  auto decel_path = input;
+  insertDecelPoint(make_point(2.5), decel_path, 5.0);
+  auto overlapping_decel_path = input;
+  insertDecelPoint(make_point(6.5), overlapping_decel_path, 3.0);
+
+  auto serial_path = input;
+  insertStopPoint(make_point(6.5), serial_path);
+  insertDecelPoint(make_point(2.5), serial_path, 5.0);
+  insertDecelPoint(make_point(6.5), serial_path, 3.0);
+
+  const auto merged_path =
+    mergeInsertedVelocities(input, {stop_path, decel_path, overlapping_decel_path});
+  const auto reversed_merged_path =
+    mergeInsertedVelocities(input, {overlapping_decel_path, decel_path, stop_path});
+
+  ASSERT_EQ(merged_path.points.size(), serial_path.points.size());
+  ASSERT_EQ(reversed_merged_path.points.size(), serial_path.points.size());
+  for (size_t i = 0; i < serial_path.points.size(); ++i) {
+    const auto & expected = serial_path.points.at(i).point;
+    for (const auto & path : {merged_path, reversed_merged_path}) {
+      EXPECT_NEAR(path.points.at(i).point.pose.position.x, expected.pose.position.x, 1e-6);
+      EXPECT_FLOAT_EQ(
+        path.points.at(i).point.longitudinal_velocity_mps, expected.longitudinal_velocity_mps);
+    }
+  }
+
+  // the input path is returned when no module modified it
+  EXPECT_EQ(mergeInsertedVelocities(input, {}).points.size(), input.points.size());
+}
+
 // Test for getAheadPose
 TEST(PlanningUtilsTest, getAheadPose)
 {
@@ -72,6 +72,8 @@ public:
 
   bool modifyPathVelocity(PathWithLaneId * path) override;
 
+  bool isVelocityInsertOnly() const override { return true; }
+
   /**
    * @brief Calculate ego position and stop point.
    * @param trajectory Current trajectory.
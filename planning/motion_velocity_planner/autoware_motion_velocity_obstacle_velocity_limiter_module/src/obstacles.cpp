@@ -75,7 +75,8 @@ multi_polygon_t createObjectPolygons(
 }
 
 void addSensorObstacles(
-  Obstacles & obstacles, const OccupancyGrid & occupancy_grid, const PointCloud & pointcloud,
+  Obstacles & obstacles, const OccupancyGrid & occupancy_grid,
+  const autoware::universe_utils::ObstaclePointIndex & pointcloud_index,
   const ObstacleMasks & masks, const ObstacleParameters & obstacle_params)
 {
   if (obstacle_params.dynamic_source == ObstacleParameters::OCCUPANCY_GRID) {
@@ -85,8 +86,7 @@ void addSensorObstacles(
     const auto obstacle_lines = extractObstacles(grid_map, occupancy_grid);
     obstacles.lines.insert(obstacles.lines.end(), obstacle_lines.begin(), obstacle_lines.end());
   } else if (obstacle_params.dynamic_source == ObstacleParameters::POINTCLOUD) {
-    filterPointCloud(pointcloud.makeShared(), masks);
-    obstacles.points = extractObstacles(pointcloud);
+    obstacles.points = extractObstacles(pointcloud_index, masks);
   }
 }
 }  // namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
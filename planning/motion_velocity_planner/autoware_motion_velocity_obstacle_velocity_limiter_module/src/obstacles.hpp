@@ -18,6 +18,7 @@
 #include "parameters.hpp"
 #include "types.hpp"
 
+#include <autoware/universe_utils/geometry/obstacle_point_index.hpp>
 #include <autoware/universe_utils/ros/transform_listener.hpp>
 
 #include <autoware_perception_msgs/msg/predicted_objects.hpp>
@@ -169,13 +170,14 @@ multi_polygon_t createObjectPolygons(
 /// @brief add obstacles obtained from sensors to the given Obstacles object
 /// @param[out] obstacles Obstacles object in which to add the sensor obstacles
 /// @param[in] occupancy_grid occupancy grid
-/// @param[in] pointcloud pointcloud
+/// @param[in] pointcloud_index index of the pointcloud
 /// @param[in] masks masks used to discard some obstacles
 /// @param[in] transform_listener object used to retrieve the latest transform
 /// @param[in] target_frame frame of the returned obstacles
 /// @param[in] obstacle_params obstacle parameters
 void addSensorObstacles(
-  Obstacles & obstacles, const OccupancyGrid & occupancy_grid, const PointCloud & pointcloud,
+  Obstacles & obstacles, const OccupancyGrid & occupancy_grid,
+  const autoware::universe_utils::ObstaclePointIndex & pointcloud_index,
   const ObstacleMasks & masks, const ObstacleParameters & obstacle_params);
 }  // namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
 #endif  // OBSTACLES_HPP_
@@ -14,67 +14,44 @@
 
 #include "pointcloud_utils.hpp"
 
-#include <pcl_ros/transforms.hpp>
-#include <tf2_eigen/tf2_eigen.hpp>
-
-#include <pcl/Vertices.h>
-#include <pcl/filters/crop_hull.h>
-#include <pcl_conversions/pcl_conversions.h>
-
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
 {
 
-void filterPointCloud(PointCloud::Ptr pointcloud, const ObstacleMasks & masks)
+multipoint_t extractObstacles(
+  const autoware::universe_utils::ObstaclePointIndex & pointcloud_index,
+  const ObstacleMasks & masks)
 {
-  PointCloud::Ptr polygon_cloud_ptr(new PointCloud);
-  if (!masks.positive_mask.outer().empty()) {
-    for (const auto & p : masks.positive_mask.outer())
-      polygon_cloud_ptr->push_back(pcl::PointXYZ(p.x(), p.y(), 0));
-    std::vector<pcl::Vertices> polygons_idx(1);
-    polygons_idx.front().vertices.resize(masks.positive_mask.outer().size());
-    std::iota(polygons_idx.front().vertices.begin(), polygons_idx.front().vertices.end(), 0);
-    pcl::CropHull<pcl::PointXYZ> crop;
-    crop.setInputCloud(pointcloud);
-    crop.setDim(2);
-    crop.setHullCloud(polygon_cloud_ptr);
-    crop.setHullIndices(polygons_idx);
-    crop.setCropOutside(true);
-    crop.filter(*pointcloud);
+  multipoint_t obstacles;
+  if (pointcloud_index.empty()) return obstacles;
+
+  std::vector<size_t> indices;
+  if (masks.positive_mask.outer().empty()) {
+    indices.resize(pointcloud_index.size());
+    std::iota(indices.begin(), indices.end(), 0UL);
+  } else {
+    indices = pointcloud_index.pointsWithinPolygon(masks.positive_mask);
   }
-
-  PointCloud::Ptr mask_cloud_ptr(new PointCloud);
-  std::vector<pcl::Vertices> masks_idx(masks.negative_masks.size());
-  size_t start_idx = 0;
-  for (size_t i = 0; i < masks.negative_masks.size(); ++i) {
-    const auto & polygon_mask = masks.negative_masks[i];
-    const auto mask_size = polygon_mask.outer().size();
-    for (const auto & p : polygon_mask.outer())
-      mask_cloud_ptr->push_back(pcl::PointXYZ(p.x(), p.y(), 0));
-    auto & mask_idx = masks_idx[i];
-    mask_idx.vertices.resize(mask_size);
-    std::iota(mask_idx.vertices.begin(), mask_idx.vertices.end(), start_idx);
-    start_idx += mask_size;
+  if (!masks.negative_masks.empty()) {
+    // both lists of indices are sorted
+    const auto masked_indices = pointcloud_index.pointsWithinPolygons(masks.negative_masks);
+    std::vector<size_t> unmasked_indices;
+    unmasked_indices.reserve(indices.size());
+    std::set_difference(
+      indices.begin(), indices.end(), masked_indices.begin(), masked_indices.end(),
+      std::back_inserter(unmasked_indices));
+    indices = std::move(unmasked_indices);
   }
-  pcl::CropHull<pcl::PointXYZ> crop_masks;
-  crop_masks.setInputCloud(pointcloud);
-  crop_masks.setDim(2);
-  crop_masks.setHullCloud(mask_cloud_ptr);
-  crop_masks.setHullIndices(masks_idx);
-  crop_masks.setCropOutside(false);
-  crop_masks.filter(*pointcloud);
-}
-
-multipoint_t extractObstacles(const PointCloud & pointcloud)
-{
-  multipoint_t obstacles;
-  if (pointcloud.empty()) return obstacles;
-  obstacles.reserve(pointcloud.size());
 
-  for (const auto & point : pointcloud) {
-    obstacles.push_back({point_t{point.x, point.y}});
+  obstacles.reserve(indices.size());
+  const auto & points = pointcloud_index.points();
+  for (const auto i : indices) {
+    obstacles.push_back({point_t{points[i].x, points[i].y}});
   }
   return obstacles;
 }
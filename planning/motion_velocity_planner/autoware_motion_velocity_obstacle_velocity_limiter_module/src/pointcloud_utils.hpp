@@ -15,6 +15,7 @@
 #ifndef POINTCLOUD_UTILS_HPP_
 #define POINTCLOUD_UTILS_HPP_
 
+#include "autoware/universe_utils/geometry/obstacle_point_index.hpp"
 #include "autoware/universe_utils/ros/transform_listener.hpp"
 #include "obstacles.hpp"
 #include "types.hpp"
@@ -27,15 +28,13 @@
 namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
 {
 
-/// @brief filter the pointcloud to keep only relevant points
-/// @param[in,out] pointcloud to filter
+/// @brief extract obstacles from the given pointcloud index
+/// @param[in] pointcloud_index index of the pointcloud
 /// @param[in] masks obstacle masks used to filter the pointcloud
-void filterPointCloud(PointCloud::Ptr pointcloud, const ObstacleMasks & masks);
-
-/// @brief extract obstacles from the given pointcloud
-/// @param[in] pointcloud input pointcloud
 /// @return extracted obstacles
-multipoint_t extractObstacles(const PointCloud & pointcloud);
+multipoint_t extractObstacles(
+  const autoware::universe_utils::ObstaclePointIndex & pointcloud_index,
+  const ObstacleMasks & masks);
 
 }  // namespace autoware::motion_velocity_planner::obstacle_velocity_limiter
 
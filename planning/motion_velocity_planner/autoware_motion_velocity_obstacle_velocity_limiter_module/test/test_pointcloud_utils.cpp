@@ -0,0 +1,106 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_utils.hpp"
+#include "../src/types.hpp"
+
+#include <boost/geometry/algorithms/correct.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using autoware::motion_velocity_planner::obstacle_velocity_limiter::ObstacleMasks;
+using autoware::motion_velocity_planner::obstacle_velocity_limiter::PointCloud;
+using autoware::motion_velocity_planner::obstacle_velocity_limiter::polygon_t;
+
+polygon_t createSquare(const double x, const double y, const double half_size)
+{
+  polygon_t square;
+  square.outer() = {
+    {x - half_size, y - half_size},
+    {x - half_size, y + half_size},
+    {x + half_size, y + half_size},
+    {x + half_size, y - half_size}};
+  boost::geometry::correct(square);
+  return square;
+}
+
+// points (x, y) for x and y in [0, 9]
+autoware::universe_utils::ObstaclePointIndex createPointCloudIndex()
+{
+  PointCloud pointcloud;
+  for (int x = 0; x < 10; ++x) {
+    for (int y = 0; y < 10; ++y) {
+      pointcloud.push_back(pcl::PointXYZ(x, y, 0.0));
+    }
+  }
+  return autoware::universe_utils::ObstaclePointIndex(std::move(pointcloud), 2.0);
+}
+
+std::vector<std::pair<double, double>> toPairs(
+  const autoware::motion_velocity_planner::obstacle_velocity_limiter::multipoint_t & points)
+{
+  std::vector<std::pair<double, double>> pairs;
+  for (const auto & p : points) {
+    pairs.emplace_back(p.x(), p.y());
+  }
+  return pairs;
+}
+}  // namespace
+
+TEST(TestPointCloudUtils, extractObstaclesWithoutMask)
+{
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::extractObstacles;
+  const auto pointcloud_index = createPointCloudIndex();
+
+  const auto obstacles = extractObstacles(pointcloud_index, ObstacleMasks{});
+  EXPECT_EQ(obstacles.size(), 100lu);
+}
+
+TEST(TestPointCloudUtils, extractObstaclesWithMasks)
+{
+  using autoware::motion_velocity_planner::obstacle_velocity_limiter::extractObstacles;
+  const auto pointcloud_index = createPointCloudIndex();
+
+  // only the points within the positive mask are kept
+  ObstacleMasks masks;
+  masks.positive_mask = createSquare(2.0, 2.0, 1.5);
+  std::vector<std::pair<double, double>> expected;
+  for (double x = 1.0; x <= 3.0; ++x) {
+    for (double y = 1.0; y <= 3.0; ++y) {
+      expected.emplace_back(x, y);
+    }
+  }
+  EXPECT_EQ(toPairs(extractObstacles(pointcloud_index, masks)), expected);
+
+  // the points within any of the negative masks are discarded
+  masks.negative_masks.push_back(createSquare(1.0, 1.0, 0.5));
+  masks.negative_masks.push_back(createSquare(3.0, 2.5, 0.6));
+  expected = {{1.0, 2.0}, {1.0, 3.0}, {2.0, 1.0}, {2.0, 2.0}, {2.0, 3.0}, {3.0, 1.0}};
+  EXPECT_EQ(toPairs(extractObstacles(pointcloud_index, masks)), expected);
+
+  // the negative masks also apply without a positive mask
+  masks.positive_mask.clear();
+  const auto obstacles = toPairs(extractObstacles(pointcloud_index, masks));
+  EXPECT_EQ(obstacles.size(), 100lu - 3lu);
+  for (const auto & masked :
+       std::vector<std::pair<double, double>>{{1.0, 1.0}, {3.0, 2.0}, {3.0, 3.0}}) {
+    EXPECT_EQ(std::count(obstacles.begin(), obstacles.end(), masked), 0);
+  }
+}
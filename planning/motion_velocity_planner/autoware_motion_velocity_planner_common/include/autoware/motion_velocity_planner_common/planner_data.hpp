@@ -19,6 +19,7 @@
 #include <autoware/motion_velocity_planner_common/collision_checker.hpp>
 #include <autoware/route_handler/route_handler.hpp>
 #include <autoware/universe_utils/geometry/boost_polygon_utils.hpp>
+#include <autoware/universe_utils/geometry/obstacle_point_index.hpp>
 #include <autoware/velocity_smoother/smoother/smoother_base.hpp>
 #include <autoware_vehicle_info_utils/vehicle_info_utils.hpp>
 
@@ -62,7 +63,10 @@ struct PlannerData
   nav_msgs::msg::Odometry current_odometry;
   geometry_msgs::msg::AccelWithCovarianceStamped current_acceleration;
   autoware_perception_msgs::msg::PredictedObjects predicted_objects;
-  pcl::PointCloud<pcl::PointXYZ> no_ground_pointcloud;
+  // index of the no ground pointcloud in the map frame, shared with the other planners
+  std::shared_ptr<const autoware::universe_utils::ObstaclePointIndex> no_ground_pointcloud_index =
+    std::make_shared<const autoware::universe_utils::ObstaclePointIndex>(
+      pcl::PointCloud<pcl::PointXYZ>{}, 1.0);
   nav_msgs::msg::OccupancyGrid occupancy_grid;
   std::shared_ptr<route_handler::RouteHandler> route_handler;
 
@@ -20,16 +20,12 @@
 #include <autoware/universe_utils/ros/update_param.hpp>
 #include <autoware/universe_utils/ros/wait_for_param.hpp>
 #include <autoware/universe_utils/system/stop_watch.hpp>
-#include <autoware/universe_utils/transform/transforms.hpp>
 #include <autoware/velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp>
 #include <autoware/velocity_smoother/trajectory_utils.hpp>
-#include <tf2_eigen/tf2_eigen.hpp>
 
 #include <autoware_planning_msgs/msg/trajectory_point.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
-#include <pcl/common/transforms.h>
-#include <pcl_conversions/pcl_conversions.h>
 #include <tf2/time.h>
 
 #include <chrono>
@@ -59,7 +55,7 @@ MotionVelocityPlannerNode::MotionVelocityPlannerNode(const rclcpp::NodeOptions &
 : Node("motion_velocity_planner_node", node_options),
   tf_buffer_(this->get_clock()),
   tf_listener_(tf_buffer_),
-  planner_data_(*this)
+  planner_data_(std::make_shared<PlannerData>(*this))
 {
   using std::placeholders::_1;
   using std::placeholders::_2;
@@ -93,10 +89,12 @@ MotionVelocityPlannerNode::MotionVelocityPlannerNode(const rclcpp::NodeOptions &
 
   // Parameters
   smooth_velocity_before_planning_ = declare_parameter<bool>("smooth_velocity_before_planning");
+  plugin_thread_num_ = declare_parameter<int>("plugin_thread_num");
+  pointcloud_index_cell_size_ = declare_parameter<double>("pointcloud_index_cell_size");
   // nearest search
-  planner_data_.ego_nearest_dist_threshold =
+  planner_data_->ego_nearest_dist_threshold =
     declare_parameter<double>("ego_nearest_dist_threshold");
-  planner_data_.ego_nearest_yaw_threshold = declare_parameter<double>("ego_nearest_yaw_threshold");
+  planner_data_->ego_nearest_yaw_threshold = declare_parameter<double>("ego_nearest_yaw_threshold");
   // set velocity smoother param
   set_velocity_smoother_params();
 
@@ -150,36 +148,37 @@ bool MotionVelocityPlannerNode::update_planner_data(
   universe_utils::StopWatch<std::chrono::milliseconds> sw;
   const auto ego_state_ptr = sub_vehicle_odometry_.takeData();
   if (check_with_log(ego_state_ptr, "Waiting for current odometry"))
-    planner_data_.current_odometry = *ego_state_ptr;
+    planner_data_->current_odometry = *ego_state_ptr;
   processing_times["update_planner_data.odom"] = sw.toc(true);
 
   const auto ego_accel_ptr = sub_acceleration_.takeData();
   if (check_with_log(ego_accel_ptr, "Waiting for current acceleration"))
-    planner_data_.current_acceleration = *ego_accel_ptr;
+    planner_data_->current_acceleration = *ego_accel_ptr;
   processing_times["update_planner_data.accel"] = sw.toc(true);
 
   const auto predicted_objects_ptr = sub_predicted_objects_.takeData();
   if (check_with_log(predicted_objects_ptr, "Waiting for predicted objects"))
-    planner_data_.predicted_objects = *predicted_objects_ptr;
+    planner_data_->predicted_objects = *predicted_objects_ptr;
   processing_times["update_planner_data.pred_obj"] = sw.toc(true);
 
   const auto no_ground_pointcloud_ptr = sub_no_ground_pointcloud_.takeData();
   if (check_with_log(no_ground_pointcloud_ptr, "Waiting for pointcloud")) {
-    const auto no_ground_pointcloud = process_no_ground_pointcloud(no_ground_pointcloud_ptr);
-    if (no_ground_pointcloud) planner_data_.no_ground_pointcloud = *no_ground_pointcloud;
+    const auto no_ground_pointcloud_index = process_no_ground_pointcloud(no_ground_pointcloud_ptr);
+    if (no_ground_pointcloud_index)
+      planner_data_->no_ground_pointcloud_index = no_ground_pointcloud_index;
   }
   processing_times["update_planner_data.pcd"] = sw.toc(true);
 
   const auto occupancy_grid_ptr = sub_occupancy_grid_.takeData();
   if (check_with_log(occupancy_grid_ptr, "Waiting for the occupancy grid"))
-    planner_data_.occupancy_grid = *occupancy_grid_ptr;
+    planner_data_->occupancy_grid = *occupancy_grid_ptr;
   processing_times["update_planner_data.occ_grid"] = sw.toc(true);
 
   // here we use bitwise operator to not short-circuit the logging messages
   is_ready &= check_with_log(map_ptr_, "Waiting for the map");
   processing_times["update_planner_data.map"] = sw.toc(true);
   is_ready &= check_with_log(
-    planner_data_.velocity_smoother_, "Waiting for the initialization of the velocity smoother");
+    planner_data_->velocity_smoother_, "Waiting for the initialization of the velocity smoother");
   processing_times["update_planner_data.smoother"] = sw.toc(true);
 
   // optional data
@@ -187,36 +186,31 @@ bool MotionVelocityPlannerNode::update_planner_data(
   if (traffic_signals_ptr) process_traffic_signals(traffic_signals_ptr);
   const auto virtual_traffic_light_states_ptr = sub_virtual_traffic_light_states_.takeData();
   if (virtual_traffic_light_states_ptr)
-    planner_data_.virtual_traffic_light_states = *virtual_traffic_light_states_ptr;
+    planner_data_->virtual_traffic_light_states = *virtual_traffic_light_states_ptr;
   processing_times["update_planner_data.traffic_lights"] = sw.toc(true);
 
   return is_ready;
 }
 
-std::optional<pcl::PointCloud<pcl::PointXYZ>>
+std::shared_ptr<const autoware::universe_utils::ObstaclePointIndex>
 MotionVelocityPlannerNode::process_no_ground_pointcloud(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
-  geometry_msgs::msg::TransformStamped transform;
   try {
-    transform = tf_buffer_.lookupTransform("map", msg->header.frame_id, tf2::TimePointZero);
+    // the index is shared with the other planners of the container receiving the same pointcloud.
+    // the transform is looked up at the stamp of the message so that they get the same one
+    return autoware::universe_utils::getSharedObstaclePointIndex(
+      sub_no_ground_pointcloud_.subscriber()->get_topic_name(), *msg, tf_buffer_, "map",
+      pointcloud_index_cell_size_);
   } catch (tf2::TransformException & e) {
     RCLCPP_WARN(get_logger(), "no transform found for no_ground_pointcloud: %s", e.what());
-    return {};
+    return nullptr;
   }
-
-  pcl::PointCloud<pcl::PointXYZ> pc;
-  pcl::fromROSMsg(*msg, pc);
-
-  Eigen::Affine3f affine = tf2::transformToEigen(transform.transform).cast<float>();
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pc_transformed(new pcl::PointCloud<pcl::PointXYZ>);
-  if (!pc.empty()) autoware::universe_utils::transformPointCloud(pc, *pc_transformed, affine);
-  return *pc_transformed;
 }
 
 void MotionVelocityPlannerNode::set_velocity_smoother_params()
 {
-  planner_data_.velocity_smoother_ =
+  planner_data_->velocity_smoother_ =
     std::make_shared<autoware::velocity_smoother::AnalyticalJerkConstrainedSmoother>(*this);
 }
 
@@ -233,15 +227,15 @@ void MotionVelocityPlannerNode::process_traffic_signals(
   const autoware_perception_msgs::msg::TrafficLightGroupArray::ConstSharedPtr msg)
 {
   // clear previous observation
-  planner_data_.traffic_light_id_map_raw_.clear();
+  planner_data_->traffic_light_id_map_raw_.clear();
   const auto traffic_light_id_map_last_observed_old =
-    planner_data_.traffic_light_id_map_last_observed_;
-  planner_data_.traffic_light_id_map_last_observed_.clear();
+    planner_data_->traffic_light_id_map_last_observed_;
+  planner_data_->traffic_light_id_map_last_observed_.clear();
   for (const auto & signal : msg->traffic_light_groups) {
     TrafficSignalStamped traffic_signal;
     traffic_signal.stamp = msg->stamp;
     traffic_signal.signal = signal;
-    planner_data_.traffic_light_id_map_raw_[signal.traffic_light_group_id] = traffic_signal;
+    planner_data_->traffic_light_id_map_raw_[signal.traffic_light_group_id] = traffic_signal;
     const bool is_unknown_observation =
       std::any_of(signal.elements.begin(), signal.elements.end(), [](const auto & element) {
         return element.color == autoware_perception_msgs::msg::TrafficLightElement::UNKNOWN;
@@ -252,13 +246,13 @@ void MotionVelocityPlannerNode::process_traffic_signals(
       traffic_light_id_map_last_observed_old.find(signal.traffic_light_group_id);
     if (is_unknown_observation && old_data != traffic_light_id_map_last_observed_old.end()) {
       // copy last observation
-      planner_data_.traffic_light_id_map_last_observed_[signal.traffic_light_group_id] =
+      planner_data_->traffic_light_id_map_last_observed_[signal.traffic_light_group_id] =
         old_data->second;
       // update timestamp
-      planner_data_.traffic_light_id_map_last_observed_[signal.traffic_light_group_id].stamp =
+      planner_data_->traffic_light_id_map_last_observed_[signal.traffic_light_group_id].stamp =
         msg->stamp;
     } else {
-      planner_data_.traffic_light_id_map_last_observed_[signal.traffic_light_group_id] =
+      planner_data_->traffic_light_id_map_last_observed_[signal.traffic_light_group_id] =
         traffic_signal;
     }
   }
@@ -284,7 +278,7 @@ void MotionVelocityPlannerNode::on_trajectory(
   }
 
   if (has_received_map_) {
-    planner_data_.route_handler = std::make_shared<route_handler::RouteHandler>(*map_ptr_);
+    planner_data_->route_handler = std::make_shared<route_handler::RouteHandler>(*map_ptr_);
     has_received_map_ = false;
     processing_times["make_RouteHandler"] = stop_watch.toc(true);
   }
@@ -400,7 +394,7 @@ autoware_planning_msgs::msg::Trajectory MotionVelocityPlannerNode::generate_traj
   output_trajectory_msg.points = {input_trajectory_points.begin(), input_trajectory_points.end()};
   if (smooth_velocity_before_planning_) {
     stop_watch.tic("smooth");
-    input_trajectory_points = smooth_trajectory(input_trajectory_points, planner_data_);
+    input_trajectory_points = smooth_trajectory(input_trajectory_points, *planner_data_);
     processing_times["velocity_smoothing"] = stop_watch.toc("smooth");
   }
   stop_watch.tic("resample");
@@ -421,11 +415,13 @@ autoware_planning_msgs::msg::Trajectory MotionVelocityPlannerNode::generate_traj
   processing_times["resample"] = stop_watch.toc("resample");
   stop_watch.tic("calculate_time_from_start");
   motion_utils::calculate_time_from_start(
-    resampled_trajectory, planner_data_.current_odometry.pose.pose.position);
+    resampled_trajectory, planner_data_->current_odometry.pose.pose.position);
   processing_times["calculate_time_from_start"] = stop_watch.toc("calculate_time_from_start");
   stop_watch.tic("plan_velocities");
+  // NOTE: the planner data is shared with the plugins without copy. It is not modified while
+  // planning since all its updates are done under mutex_.
   const auto planning_results = planner_manager_.plan_velocities(
-    resampled_trajectory, std::make_shared<const PlannerData>(planner_data_));
+    resampled_trajectory, planner_data_, plugin_thread_num_, processing_times);
   processing_times["plan_velocities"] = stop_watch.toc("plan_velocities");
 
   autoware_adapi_v1_msgs::msg::VelocityFactorArray velocity_factors;
@@ -451,13 +447,15 @@ rcl_interfaces::msg::SetParametersResult MotionVelocityPlannerNode::on_set_param
   using autoware::universe_utils::updateParam;
 
   {
-    std::unique_lock<std::mutex> lk(mutex_);  // for planner_manager_
+    std::unique_lock<std::mutex> lk(mutex_);  // for planner_manager_ and planner_data_
     planner_manager_.update_module_parameters(parameters);
+    updateParam(
+      parameters, "ego_nearest_dist_threshold", planner_data_->ego_nearest_dist_threshold);
+    updateParam(parameters, "ego_nearest_yaw_threshold", planner_data_->ego_nearest_yaw_threshold);
   }
 
   updateParam(parameters, "smooth_velocity_before_planning", smooth_velocity_before_planning_);
-  updateParam(parameters, "ego_nearest_dist_threshold", planner_data_.ego_nearest_dist_threshold);
-  updateParam(parameters, "ego_nearest_yaw_threshold", planner_data_.ego_nearest_yaw_threshold);
+  updateParam(parameters, "plugin_thread_num", plugin_thread_num_);
 
   // set_velocity_smoother_params(); TODO(Maxime): fix update parameters of the velocity smoother
 
@@ -18,6 +18,7 @@
 #include "planner_manager.hpp"
 
 #include <autoware/motion_velocity_planner_common/planner_data.hpp>
+#include <autoware/universe_utils/geometry/obstacle_point_index.hpp>
 #include <autoware/universe_utils/ros/logger_level_configure.hpp>
 #include <autoware/universe_utils/ros/polling_subscriber.hpp>
 #include <autoware/universe_utils/ros/published_time_publisher.hpp>
@@ -87,7 +88,7 @@ private:
 
   void on_trajectory(
     const autoware_planning_msgs::msg::Trajectory::ConstSharedPtr input_trajectory_msg);
-  std::optional<pcl::PointCloud<pcl::PointXYZ>> process_no_ground_pointcloud(
+  std::shared_ptr<const autoware::universe_utils::ObstaclePointIndex> process_no_ground_pointcloud(
     const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg);
   void on_lanelet_map(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr msg);
   void process_traffic_signals(
@@ -107,11 +108,13 @@ private:
   //  parameters
   rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr set_param_callback_;
   bool smooth_velocity_before_planning_{};
+  int plugin_thread_num_{1};  // number of threads to run the plugins concurrently
+  double pointcloud_index_cell_size_{0.5};  // [m] cell size of the no ground pointcloud index
   /// @brief set parameters of the velocity smoother
   void set_velocity_smoother_params();
 
   // members
-  PlannerData planner_data_;
+  std::shared_ptr<PlannerData> planner_data_;
   MotionVelocityPlannerManager planner_manager_;
   LaneletMapBin::ConstSharedPtr map_ptr_{nullptr};
   bool has_received_map_ = false;
@@ -14,8 +14,13 @@
 
 #include "planner_manager.hpp"
 
+#include <autoware/universe_utils/system/stop_watch.hpp>
+
 #include <boost/format.hpp>
 
+#include <chrono>
+#include <exception>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -95,12 +100,34 @@ std::shared_ptr<MetricArray> MotionVelocityPlannerManager::get_metrics(
 
 std::vector<VelocityPlanningResult> MotionVelocityPlannerManager::plan_velocities(
   const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & ego_trajectory_points,
-  const std::shared_ptr<const PlannerData> planner_data)
+  const std::shared_ptr<const PlannerData> planner_data, const int thread_num,
+  std::map<std::string, double> & processing_times)
 {
-  std::vector<VelocityPlanningResult> results;
-  for (auto & plugin : loaded_plugins_) {
-    VelocityPlanningResult res = plugin->plan(ego_trajectory_points, planner_data);
-    results.push_back(res);
+  // NOTE: the plugins only read the planner data and the trajectory, and return independent
+  // results, so they can be run concurrently. The results are stored in the order of the plugins.
+  const auto num_plugins = loaded_plugins_.size();
+  std::vector<VelocityPlanningResult> results(num_plugins);
+  std::vector<double> plugin_processing_times(num_plugins);
+  std::vector<std::exception_ptr> exceptions(num_plugins);
+
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 1) if (thread_num > 1)
+  for (size_t i = 0; i < num_plugins; ++i) {
+    autoware::universe_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+    try {
+      results[i] = loaded_plugins_[i]->plan(ego_trajectory_points, planner_data);
+    } catch (...) {
+      exceptions[i] = std::current_exception();
+    }
+    plugin_processing_times[i] = stop_watch.toc();
+  }
+
+  for (size_t i = 0; i < num_plugins; ++i) {
+    if (exceptions[i]) {
+      std::rethrow_exception(exceptions[i]);
+    }
+    const auto & plugin = loaded_plugins_[i];
+    const auto & res = results[i];
+    processing_times["plan_velocities." + plugin->get_module_name()] = plugin_processing_times[i];
 
     if (res.stop_points.size() > 0) {
       const auto stop_decision_metric = make_decision_metric(plugin->get_module_name(), "stop");
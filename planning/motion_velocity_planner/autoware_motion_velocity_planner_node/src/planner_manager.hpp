@@ -32,6 +32,7 @@
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -48,9 +49,19 @@ public:
   void load_module_plugin(rclcpp::Node & node, const std::string & name);
   void unload_module_plugin(rclcpp::Node & node, const std::string & name);
   void update_module_parameters(const std::vector<rclcpp::Parameter> & parameters);
+  /**
+   * @brief run the loaded plugins and collect their results
+   * @param ego_trajectory_points ego trajectory
+   * @param planner_data planner data shared by the plugins, not modified while planning
+   * @param thread_num number of threads used to run the plugins concurrently, 1 to run them in turn
+   * @param processing_times the processing time of each plugin is added with the key
+   * "plan_velocities.<module_name>"
+   * @return results of the plugins in the order they were loaded
+   */
   std::vector<VelocityPlanningResult> plan_velocities(
     const std::vector<autoware_planning_msgs::msg::TrajectoryPoint> & ego_trajectory_points,
-    const std::shared_ptr<const PlannerData> planner_data);
+    const std::shared_ptr<const PlannerData> planner_data, const int thread_num,
+    std::map<std::string, double> & processing_times);
 
   // Metrics
   std::shared_ptr<Metric> make_decision_metric(
@@ -22,6 +22,7 @@
 #include "autoware_vehicle_info_utils/vehicle_info_utils.hpp"
 #include "rclcpp/rclcpp.hpp"
 
+#include <autoware/motion_utils/resample/resample.hpp>
 #include <autoware/universe_utils/ros/polling_subscriber.hpp>
 #include <autoware_sampler_common/structures.hpp>
 
@@ -43,6 +44,7 @@ protected:  // for the static_centerline_generator package
   autoware::vehicle_info_utils::VehicleInfo vehicle_info_{};
   mutable DebugData debug_data_{};
   mutable std::shared_ptr<TimeKeeper> time_keeper_ptr_{nullptr};
+  mutable autoware::motion_utils::ResampleWorkspace resample_workspace_;
 
   // parameters
   TrajectoryParam traj_param_{};
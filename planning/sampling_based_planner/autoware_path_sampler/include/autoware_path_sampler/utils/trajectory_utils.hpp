@@ -18,6 +18,7 @@
 #include "autoware/interpolation/linear_interpolation.hpp"
 #include "autoware/interpolation/spline_interpolation.hpp"
 #include "autoware/interpolation/spline_interpolation_points_2d.hpp"
+#include "autoware/motion_utils/resample/resample.hpp"
 #include "autoware/motion_utils/trajectory/trajectory.hpp"
 #include "autoware_path_sampler/common_structs.hpp"
 #include "autoware_path_sampler/type_alias.hpp"
@@ -136,10 +137,12 @@ size_t findEgoSegmentIndex(
 }
 
 std::vector<TrajectoryPoint> resampleTrajectoryPoints(
-  const std::vector<TrajectoryPoint> & traj_points, const double interval);
+  const std::vector<TrajectoryPoint> & traj_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace);
 
 std::vector<TrajectoryPoint> resampleTrajectoryPointsWithoutStopPoint(
-  const std::vector<TrajectoryPoint> & traj_points, const double interval);
+  const std::vector<TrajectoryPoint> & traj_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace);
 
 template <typename T>
 std::optional<size_t> updateFrontPointForFix(
@@ -686,7 +686,7 @@ std::vector<TrajectoryPoint> PathSampler::extendTrajectory(
 
   // resample trajectory points
   auto resampled_traj_points = trajectory_utils::resampleTrajectoryPoints(
-    full_traj_points, traj_param_.output_delta_arc_length);
+    full_traj_points, traj_param_.output_delta_arc_length, resample_workspace_);
 
   // update velocity on joint
   for (size_t i = end_traj_seg_idx + 1; i <= end_upto_traj_point_idx; ++i) {
@@ -36,25 +36,29 @@ namespace autoware::path_sampler
 namespace trajectory_utils
 {
 std::vector<TrajectoryPoint> resampleTrajectoryPoints(
-  const std::vector<TrajectoryPoint> & traj_points, const double interval)
+  const std::vector<TrajectoryPoint> & traj_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace)
 {
   constexpr bool enable_resampling_stop_point = true;
 
   const auto traj = autoware::motion_utils::convertToTrajectory(traj_points);
-  const auto resampled_traj = autoware::motion_utils::resampleTrajectory(
-    traj, interval, false, true, true, enable_resampling_stop_point);
+  Trajectory resampled_traj;
+  autoware::motion_utils::resampleTrajectory(
+    traj, interval, workspace, resampled_traj, false, true, true, enable_resampling_stop_point);
   return autoware::motion_utils::convertToTrajectoryPointArray(resampled_traj);
 }
 
 // NOTE: stop point will not be resampled
 std::vector<TrajectoryPoint> resampleTrajectoryPointsWithoutStopPoint(
-  const std::vector<TrajectoryPoint> & traj_points, const double interval)
+  const std::vector<TrajectoryPoint> & traj_points, const double interval,
+  autoware::motion_utils::ResampleWorkspace & workspace)
 {
   constexpr bool enable_resampling_stop_point = false;
 
   const auto traj = autoware::motion_utils::convertToTrajectory(traj_points);
-  const auto resampled_traj = autoware::motion_utils::resampleTrajectory(
-    traj, interval, false, true, true, enable_resampling_stop_point);
+  Trajectory resampled_traj;
+  autoware::motion_utils::resampleTrajectory(
+    traj, interval, workspace, resampled_traj, false, true, true, enable_resampling_stop_point);
   return autoware::motion_utils::convertToTrajectoryPointArray(resampled_traj);
 }
 